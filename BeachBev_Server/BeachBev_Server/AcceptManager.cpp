@@ -1,15 +1,19 @@
 #include "AcceptManager.h"
 #include "BB_Server.h"
 #include "DBManager.h"
+#include "DBPool.h"
+#include "DBExecutor.h"
 #include "MasterManager.h"
 #include "EmailManager.h"
 #include <ClientManager.h>
 #include <WSIPacket.h>
 #include <WSOPacket.h>
 #include "Packets/BBPacks.pb.h"
+#include <algorithm>
 
 AcceptManager::AcceptManager(BB_Server * bbServer, MasterManager * masterManager, EmailManager * emailManager)
-	:PKeyOwner(), bbServer(bbServer), masterManager(masterManager), emailManager(emailManager)
+	:PKeyOwner(), bbServer(bbServer), masterManager(masterManager), emailManager(emailManager),
+	aStateVersion(1), dashboardVersion(0), dashboardHits(0), dashboardMisses(0), dashboardRebuilds(0)
 {
 	addKey(boost::make_shared<PKey>("E0", this, &AcceptManager::handleE0));
 	addKey(boost::make_shared<PKey>("E2", this, &AcceptManager::handleE2));
@@ -17,59 +21,194 @@ AcceptManager::AcceptManager(BB_Server * bbServer, MasterManager * masterManager
 	addKey(boost::make_shared<PKey>("E6", this, &AcceptManager::handleE6));
 }
 
+//Filled on a worker by handleE0 when the cached E1 is stale
+struct DashboardRebuild {
+	boost::shared_ptr<std::string> e1;
+	std::string msg;
+};
+
+//Filled on a worker by streamApplicants, pages that are already full are sent from the worker
+struct ApplicantPages {
+	//Last eID of the last page sent, a retried statement resumes after it
+	IDType sentCursor;
+	//Rows fetched since, sent by the completion once the listing ends
+	ProtobufPackets::PackE1 lastPage;
+};
+
 void AcceptManager::handleE0(boost::shared_ptr<IPacket> iPack)
 {
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	ProtobufPackets::PackE1 packE1;
-	packE1.set_success(false);
-	if (masterManager->isMaster(sender->getEmpID(), dbManager)) {
-		if (getEIDsWithAState(UNACCEPTED_ASTATE, dbManager, packE1.mutable_unacceptedeids())) {
-			if (getEIDsWithAState(ACCEPTED_ASTATE, dbManager, packE1.mutable_acceptedeids()))
-			{
-				packE1.set_success(true);
+	if (!masterManager->isMaster(sender)) {
+		ProtobufPackets::PackE1 packE1;
+		packE1.set_success(false);
+		packE1.set_msg("Not logged in as master");
+		sendE1(sender, boost::make_shared<std::string>(packE1.SerializeAsString()));
+		return;
+	}
+	ProtobufPackets::PackE0 packE0;
+	packE0.ParseFromString(*iPack->getData());
+	if (packE0.pagesize() > 0) {
+		streamApplicants(sender, packE0.cursor(), std::min(packE0.pagesize(), (google::protobuf::uint32)MAX_E1_PAGE_SIZE));
+		return;
+	}
+	boost::shared_ptr<std::string> cachedE1 = getDashboard();
+	if (cachedE1 != nullptr) {
+		dashboardHits++;
+		sendE1(sender, cachedE1);
+		return;
+	}
+	dashboardMisses++;
+	auto rebuild = boost::make_shared<DashboardRebuild>();
+	bbServer->getDBExecutor()->submit(sender, [this, rebuild](DBManager* dbManager) {
+		rebuild->e1 = rebuildDashboard(dbManager, rebuild->msg);
+	}, [this, sender, rebuild](DBJobStatus status) {
+		if (status == DBJobStatus::Completed && rebuild->e1 != nullptr) {
+			sendE1(sender, rebuild->e1);
+			return;
+		}
+		ProtobufPackets::PackE1 packE1;
+		packE1.set_success(false);
+		packE1.set_msg(status == DBJobStatus::Completed ? rebuild->msg : DBExecutor::GetStatusMsg(status));
+		sendE1(sender, boost::make_shared<std::string>(packE1.SerializeAsString()));
+	});
+}
+
+void AcceptManager::sendE1(BB_ClientPtr client, boost::shared_ptr<std::string> e1)
+{
+	auto oPack = boost::make_shared<WSOPacket>("E1");
+	oPack->setSenderID(0);
+	oPack->addSendToID(client->getID());
+	oPack->setData(e1);
+	bbServer->getClientManager()->send(oPack, client);
+}
+
+void AcceptManager::streamApplicants(BB_ClientPtr client, IDType cursor, int pageSize)
+{
+	auto pages = boost::make_shared<ApplicantPages>();
+	pages->sentCursor = cursor;
+	bbServer->getDBExecutor()->submit(client, [this, client, pageSize, pages](DBManager* dbManager) {
+		ProtobufPackets::PackE1& page = pages->lastPage;
+		bool success = dbManager->execute<STMT_GET_APPLICANTS_AFTER>([&](StatementStream<STMT_GET_APPLICANTS_AFTER>& stmt) {
+			//A retry after a lost connection drops the unsent rows and picks up after the last page sent
+			page.Clear();
+			stmt.bind(pages->sentCursor, (int)UNACCEPTED_ASTATE, (int)ACCEPTED_ASTATE);
+			int eID;
+			int aState;
+			while (stmt.fetch(eID, aState)) {
+				//A full page is held until the next row arrives so the last one is never sent empty
+				if (page.unacceptedeids_size() + page.acceptedeids_size() == pageSize) {
+					page.set_success(true);
+					page.set_morepages(true);
+					client->getStrand().post(std::bind(&AcceptManager::sendE1, this, client,
+						boost::make_shared<std::string>(page.SerializeAsString())));
+					pages->sentCursor = page.nextcursor();
+					page.Clear();
+				}
+				if (aState == ACCEPTED_ASTATE) {
+					page.add_acceptedeids(eID);
+				}
+				else
+				{
+					page.add_unacceptedeids(eID);
+				}
+				page.set_nextcursor(eID);
 			}
-			else
-			{
-				packE1.set_msg("Aquring eIDs of ACCEPTED_ASTATE failed");
+		});
+		if (success) {
+			page.set_success(true);
+			if (page.nextcursor() == 0) {
+				page.set_nextcursor(pages->sentCursor);
 			}
 		}
 		else
 		{
-			packE1.set_msg("Aquring eIDs of UNACCEPTED_ASTATE failed");
+			page.Clear();
+			page.set_msg("Listing applicants failed");
 		}
+	}, [this, client, pages](DBJobStatus status) {
+		ProtobufPackets::PackE1& page = pages->lastPage;
+		if (status != DBJobStatus::Completed) {
+			page.Clear();
+			page.set_msg(DBExecutor::GetStatusMsg(status));
+		}
+		if (!page.success()) {
+			page.set_nextcursor(pages->sentCursor);
+		}
+		sendE1(client, boost::make_shared<std::string>(page.SerializeAsString()));
+	});
+}
+
+boost::shared_ptr<std::string> AcceptManager::getDashboard()
+{
+	std::lock_guard<std::mutex> lock(dashboardMutex);
+	if (dashboardVersion != aStateVersion) {
+		return nullptr;
 	}
-	else
-	{
-		packE1.set_msg("Not logged in as master");
+	return dashboard;
+}
+
+boost::shared_ptr<std::string> AcceptManager::rebuildDashboard(DBManager * dbManager, std::string & msg)
+{
+	//Another master's E0 may have rebuilt it while this one was queued
+	boost::shared_ptr<std::string> cachedE1 = getDashboard();
+	if (cachedE1 != nullptr) {
+		return cachedE1;
 	}
-	auto oPack = boost::make_shared<WSOPacket>("E1");
-	oPack->setSenderID(0);
-	oPack->addSendToID(sender->getID());
-	oPack->setData(boost::make_shared<std::string>(packE1.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+	//Read before querying, a change committed during the queries leaves this E1 stale rather than cached as current
+	uint64_t version = aStateVersion;
+	ProtobufPackets::PackE1 packE1;
+	if (!getEIDsWithAState(UNACCEPTED_ASTATE, dbManager, packE1.mutable_unacceptedeids())) {
+		msg = "Aquring eIDs of UNACCEPTED_ASTATE failed";
+		return nullptr;
+	}
+	if (!getEIDsWithAState(ACCEPTED_ASTATE, dbManager, packE1.mutable_acceptedeids())) {
+		msg = "Aquring eIDs of ACCEPTED_ASTATE failed";
+		return nullptr;
+	}
+	packE1.set_success(true);
+	auto e1 = boost::make_shared<std::string>(packE1.SerializeAsString());
+	std::lock_guard<std::mutex> lock(dashboardMutex);
+	if (version > dashboardVersion) {
+		dashboard = e1;
+		dashboardVersion = version;
+		dashboardRebuilds++;
+	}
+	return e1;
+}
+
+void AcceptManager::invalidateDashboard(DBManager * dbManager)
+{
+	dbManager->afterCommit([this]() {
+		aStateVersion++;
+	});
+}
+
+DashboardStats AcceptManager::getDashboardStats()
+{
+	DashboardStats stats;
+	stats.aStateVersion = aStateVersion;
+	stats.hits = dashboardHits;
+	stats.misses = dashboardMisses;
+	stats.rebuilds = dashboardRebuilds;
+	std::lock_guard<std::mutex> lock(dashboardMutex);
+	stats.snapshotVersion = dashboardVersion;
+	stats.snapshotBytes = dashboard != nullptr ? dashboard->size() : 0;
+	return stats;
 }
 
 bool AcceptManager::getEIDsWithAState(int aState, DBManager * dbManager, google::protobuf::RepeatedField<google::protobuf::uint32>* eIDs)
 {
-	std::string query = "SELECT eID FROM Employees WHERE aState=:f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << aState;
-		while (!otlStream.eof()) {
-			int eID;
-			otlStream >> eID;
+	return dbManager->execute<STMT_GET_EIDS_WITH_ASTATE>([&](StatementStream<STMT_GET_EIDS_WITH_ASTATE>& stmt) {
+		eIDs->Clear();
+		stmt.bind(aState);
+		int eID;
+		while (stmt.fetch(eID)) {
 			eIDs->Add(eID);
 		}
-		return true;
-	}
-	catch (otl_exception ex) {
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
-	}
-	return false;
+	});
 }
 
 void AcceptManager::handleE2(boost::shared_ptr<IPacket> iPack)
@@ -78,48 +217,50 @@ void AcceptManager::handleE2(boost::shared_ptr<IPacket> iPack)
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	ProtobufPackets::PackE3 replyPacket;
-	replyPacket.set_success(false);
-	if (masterManager->isMaster(sender->getEmpID(), dbManager)) {
-		ProtobufPackets::PackE2 packE2;
-		packE2.ParseFromString(*iPack->getData());
-		if (setAState(packE2.eid(), packE2.astate(), dbManager)) {
-			replyPacket.set_success(true);
-			replyPacket.set_eid(packE2.eid());
-			if (packE2.astate() == ACCEPTED_ASTATE) {
-				sendAcceptEmail(packE2.eid(), sender->getDBManager());
+	auto packE2 = boost::make_shared<ProtobufPackets::PackE2>();
+	packE2->ParseFromString(*iPack->getData());
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackE3>();
+	replyPacket->set_success(false);
+	bbServer->getDBExecutor()->submit(sender, [this, sender, packE2, replyPacket](DBManager* dbManager) {
+		if (masterManager->isMaster(sender)) {
+			if (setAState(packE2->eid(), packE2->astate(), dbManager)) {
+				replyPacket->set_success(true);
+				replyPacket->set_eid(packE2->eid());
+				if (packE2->astate() == ACCEPTED_ASTATE) {
+					sendAcceptEmail(packE2->eid(), dbManager);
+				}
+			}
+			else
+			{
+				replyPacket->set_msg("Failed to set aState");
 			}
 		}
 		else
 		{
-			replyPacket.set_msg("Failed to set aState");
+			replyPacket->set_msg("Must be a master");
 		}
-	}
-	else
-	{
-		replyPacket.set_msg("Must be a master");
-	}
-	auto oPack = boost::make_shared<WSOPacket>("E3");
-	oPack->setSenderID(0);
-	oPack->addSendToID(sender->getID());
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+	}, [this, sender, replyPacket](DBJobStatus status) {
+		if (status != DBJobStatus::Completed) {
+			replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
+		}
+		auto oPack = boost::make_shared<WSOPacket>("E3");
+		oPack->setSenderID(0);
+		oPack->addSendToID(sender->getID());
+		oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+		bbServer->getClientManager()->send(oPack, sender);
+	});
 }
 
 bool AcceptManager::setAState(IDType eID, int aState, DBManager * dbManager)
 {
-	std::string query = "UPDATE Employees SET aState=:f1<int> WHERE eID=:f2<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << aState;
-		otlStream << (int)eID;
-		return true;
-	}
-	catch (otl_exception ex) {
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	if (!dbManager->execute<STMT_SET_ASTATE>([&](StatementStream<STMT_SET_ASTATE>& stmt) {
+		stmt.bind(aState, eID);
+	}))
+	{
+		return false;
 	}
-	return false;
+	invalidateDashboard(dbManager);
+	return true;
 }
 
 void AcceptManager::handleE4(boost::shared_ptr<IPacket> iPack)
@@ -128,53 +269,59 @@ void AcceptManager::handleE4(boost::shared_ptr<IPacket> iPack)
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	ProtobufPackets::PackE5 replyPacket;
-	replyPacket.set_astate(getAState(sender->getEmpID(), dbManager));
-	auto oPack = boost::make_shared<WSOPacket>("E5");
-	oPack->setSenderID(0);
-	oPack->addSendToID(sender->getID());
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackE5>();
+	replyPacket->set_astate(INVALID_ASTATE);
+	IDType senderEID = sender->getEmpID();
+	bbServer->getDBExecutor()->submit(sender, [this, senderEID, replyPacket](DBManager* dbManager) {
+		replyPacket->set_astate(getAState(senderEID, dbManager));
+	}, [this, sender, replyPacket](DBJobStatus status) {
+		auto oPack = boost::make_shared<WSOPacket>("E5");
+		oPack->setSenderID(0);
+		oPack->addSendToID(sender->getID());
+		oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+		bbServer->getClientManager()->send(oPack, sender);
+	});
 }
 
 int AcceptManager::getAState(IDType eID, DBManager * dbManager)
 {
-	std::string query = "SELECT aState FROM Employees WHERE eID=:f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		if (!otlStream.eof()) {
-			int aState;
-			otlStream >> aState;
-			return aState;
-		}
-	}
-	catch (otl_exception ex) {
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
-	}
-	return INVALID_ASTATE;
+	int aState = INVALID_ASTATE;
+	dbManager->execute<STMT_GET_ASTATE>([&](StatementStream<STMT_GET_ASTATE>& stmt) {
+		stmt.bind(eID);
+		stmt.fetch(aState);
+	});
+	return aState;
 }
 
 void AcceptManager::handleE6(boost::shared_ptr<IPacket> iPack)
 {
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
-	ProtobufPackets::PackE6 packE6;
-	packE6.ParseFromString(*iPack->getData());
-	ProtobufPackets::PackE7 replyPacket;
-	replyPacket.set_msg("Failed to set aState");
-	if (packE6.accept()) {
-		replyPacket.set_success(setAState(sender->getEmpID(), EMPLOYEE_ASTATE, sender->getDBManager()));
-	}
-	else
-	{
-		replyPacket.set_success(setAState(sender->getEmpID(), DECLINE_ASTATE, sender->getDBManager()));
+	if (sender == nullptr) {
+		return;
 	}
-	auto oPack = boost::make_shared<WSOPacket>("E7");
-	oPack->setSenderID(0);
-	oPack->addSendToID(sender->getID());
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+	auto packE6 = boost::make_shared<ProtobufPackets::PackE6>();
+	packE6->ParseFromString(*iPack->getData());
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackE7>();
+	replyPacket->set_msg("Failed to set aState");
+	IDType senderEID = sender->getEmpID();
+	bbServer->getDBExecutor()->submit(sender, [this, senderEID, packE6, replyPacket](DBManager* dbManager) {
+		if (packE6->accept()) {
+			replyPacket->set_success(setAState(senderEID, EMPLOYEE_ASTATE, dbManager));
+		}
+		else
+		{
+			replyPacket->set_success(setAState(senderEID, DECLINE_ASTATE, dbManager));
+		}
+	}, [this, sender, replyPacket](DBJobStatus status) {
+		if (status != DBJobStatus::Completed) {
+			replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
+		}
+		auto oPack = boost::make_shared<WSOPacket>("E7");
+		oPack->setSenderID(0);
+		oPack->addSendToID(sender->getID());
+		oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+		bbServer->getClientManager()->send(oPack, sender);
+	});
 }
 
 void AcceptManager::sendAcceptEmail(IDType eID, DBManager * dbManager)
@@ -4,11 +4,27 @@
 #include <google/protobuf/repeated_field.h>
 #include <aws/email/SESClient.h>
 #include "BB_Client.h"
+#include <mutex>
+#include <atomic>
 
 class BB_Server;
+class DBManager;
 class EmailManager;
 class MasterManager;
 
+struct DashboardStats {
+	//Bumped after every committed aState change
+	uint64_t aStateVersion;
+	//aStateVersion the cached E1 was built at, 0 if nothing is cached
+	uint64_t snapshotVersion;
+	size_t snapshotBytes;
+	//E0s answered straight from the cached E1
+	uint64_t hits;
+	//E0s that had to query the database, rebuilds counts the ones that replaced the cached E1
+	uint64_t misses;
+	uint64_t rebuilds;
+};
+
 class AcceptManager : public PKeyOwner
 {
 public:
@@ -18,14 +34,29 @@ public:
 	static const int ACCEPTED_ASTATE = 1;
 	static const int DECLINE_ASTATE = 2;
 	static const int EMPLOYEE_ASTATE = 3;
+	//Largest page an E0 can ask for, bigger requests are cut down to it
+	static const int MAX_E1_PAGE_SIZE = 500;
 	AcceptManager(BB_Server* bbServer, MasterManager* masterManager, EmailManager* emailManager);
 
+	/// <summary>
+	/// Replies to a master with the unaccepted and accepted eIDs. Without a pageSize every master
+	/// gets the same serialized E1, which is only rebuilt from the database after an aState change.
+	/// With one the eIDs above the cursor are streamed as pages, see streamApplicants.
+	/// </summary>
 	void handleE0(boost::shared_ptr<IPacket> iPack);
 	bool getEIDsWithAState(int aState, DBManager* dbManager, google::protobuf::RepeatedField<google::protobuf::uint32>* eIDs);
 
 	void handleE2(boost::shared_ptr<IPacket> iPack);
 	bool setAState(IDType eID, int aState, DBManager* dbManager);
 
+	/// <summary>
+	/// Marks the cached E1 stale once the current transaction commits, call after any write
+	/// that can move an employee into or out of the unaccepted or accepted lists
+	/// </summary>
+	void invalidateDashboard(DBManager* dbManager);
+
+	DashboardStats getDashboardStats();
+
 	void handleE4(boost::shared_ptr<IPacket> iPack);
 	int getAState(IDType eID, DBManager* dbManager);
 
@@ -41,5 +72,34 @@ private:
 	BB_Server* bbServer;
 	MasterManager* masterManager;
 	EmailManager* emailManager;
+
+	void sendE1(BB_ClientPtr client, boost::shared_ptr<std::string> e1);
+
+	/// <summary>
+	/// Sends the applicants above cursor in E1s of pageSize eIDs in eID order. Each page is posted to
+	/// the client's strand as soon as its rows are fetched, every page but the last has morePages set.
+	/// A failed listing ends with an unsuccessful E1 whose nextCursor is the last eID already sent.
+	/// </summary>
+	void streamApplicants(BB_ClientPtr client, IDType cursor, int pageSize);
+
+	/// <summary>
+	/// The cached E1 if no aState has changed since it was built, null otherwise
+	/// </summary>
+	boost::shared_ptr<std::string> getDashboard();
+
+	/// <summary>
+	/// Queries both lists and caches the result unless a newer one was cached meanwhile
+	/// </summary>
+	/// <returns>The serialized E1, null if a query failed and msg is set</returns>
+	boost::shared_ptr<std::string> rebuildDashboard(DBManager* dbManager, std::string& msg);
+
+	std::atomic<uint64_t> aStateVersion;
+	std::mutex dashboardMutex;
+	//Serialized PackE1 shared by every E0 reply, never modified once cached
+	boost::shared_ptr<std::string> dashboard;
+	uint64_t dashboardVersion;
+	std::atomic<uint64_t> dashboardHits;
+	std::atomic<uint64_t> dashboardMisses;
+	std::atomic<uint64_t> dashboardRebuilds;
 };
 
@@ -2,8 +2,8 @@
 #include "BB_Server.h"
 #include "EmployeeManager.h"
 
-BB_Client::BB_Client(boost::shared_ptr<TCPConnection> tcpConnection, DBManager* dbManager, Server * server, IDType id)
-	:Client(tcpConnection, server, id), dbManager(dbManager)
+BB_Client::BB_Client(boost::shared_ptr<TCPConnection> tcpConnection, Server * server, IDType id, boost::asio::io_service& strandService)
+	:Client(tcpConnection, server, id), empID(0), master(false), roleGeneration(0), strand(strandService)
 {
 	
 }
@@ -1,21 +1,16 @@
 #pragma once
 #include "stdafx.h"
 #include <Client.h>
-
-class DBManager;
-
+#include <boost/asio.hpp>
+#include <atomic>
 
 class BB_Client : public Client
 {
 public:
-	BB_Client(boost::shared_ptr <TCPConnection> tcpConnection, DBManager* dbManager, Server* server, IDType id);
+	BB_Client(boost::shared_ptr <TCPConnection> tcpConnection, Server* server, IDType id, boost::asio::io_service& strandService);
 
   void init() override;
 	
-	DBManager* getDBManager() {
-		return dbManager;
-	}
-
 	IDType getEmpID() {
 		return empID;
 	}
@@ -24,9 +19,33 @@ public:
 		this->empID = empID;
 	}
 
+	/// <summary>
+	/// Role stamped by MasterManager at login, only valid while generation matches MasterManager's
+	/// </summary>
+	void setRole(bool master, uint64_t roleGeneration) {
+		this->master = master;
+		this->roleGeneration = roleGeneration;
+	}
+
+	bool isMaster() {
+		return master;
+	}
+
+	uint64_t getRoleGeneration() {
+		return roleGeneration;
+	}
+
+	//Completions of work run off the io threads are serialized through this
+	boost::asio::io_service::strand& getStrand() {
+		return strand;
+	}
+
 	~BB_Client();
 
 private:
-	DBManager* dbManager;
-	IDType empID;
+	//Set by logins on DB workers and SES callbacks, read on every thread
+	std::atomic<IDType> empID;
+	std::atomic<bool> master;
+	std::atomic<uint64_t> roleGeneration;
+	boost::asio::io_service::strand strand;
 };
@@ -3,29 +3,46 @@
 #include "CommandHandler.h"
 #include "BB_ServicePool.h"
 #include "EmployeeManager.h"
+#include "MasterManager.h"
+#include "RateLimiter.h"
 #include <PacketManager.h>
 #include <ClientManager.h>
 
 BB_Server::BB_Server()
-	:WSS_Server(boost::asio::ip::tcp::v4())
+	:WSS_Server(boost::asio::ip::tcp::v4()), employeeManager(nullptr), dbPoolSize(DBPool::DEFAULT_POOL_SIZE), roleRefreshSeconds(MasterManager::DEFAULT_REFRESH_SECONDS)
 {
 	cmdHandler = new CommandHandler(this);
+	rateLimiter = new RateLimiter(this);
 }
 
 void BB_Server::createManagers()
 {
-	servicePool = new BB_ServicePool(certPath, pemPath, dbConInfo);
+	servicePool = new BB_ServicePool(certPath, pemPath, dbConInfo, 1, dbPoolSize);
 	cm = new ClientManager(this);
 }
 
 ClientPtr BB_Server::createClient(boost::shared_ptr<TCPConnection> tcpConnection, IDType id)
 {
-	DBManager* dbManager = ((BB_ServicePool*)servicePool)->getNextDBManager();
-	BB_ClientPtr bbClient = boost::make_shared<BB_Client>(tcpConnection, dbManager, this, id);
+	BB_ClientPtr bbClient = boost::make_shared<BB_Client>(tcpConnection, this, id, ((BB_ServicePool*)servicePool)->getStrandService());
 	bbClient->init();
 	return boost::static_pointer_cast<Client>(bbClient);	
 }
 
+DBPool* BB_Server::getDBPool()
+{
+	return ((BB_ServicePool*)servicePool)->getDBPool();
+}
+
+DBExecutor* BB_Server::getDBExecutor()
+{
+	return ((BB_ServicePool*)servicePool)->getDBExecutor();
+}
+
+CryptoExecutor* BB_Server::getCryptoExecutor()
+{
+	return ((BB_ServicePool*)servicePool)->getCryptoExecutor();
+}
+
 void BB_Server::run(uint16_t port)
 {
 	employeeManager = new EmployeeManager(this);
@@ -37,4 +54,14 @@ BB_Server::~BB_Server()
 {
 	delete cmdHandler;
 	cmdHandler = nullptr;
+	if (employeeManager != nullptr) {
+		//Drain the DB workers first so nothing queues a pwdToken after the writer's last flush,
+		//hashes still queued go before them since their completions submit DB jobs
+		getCryptoExecutor()->stop();
+		getDBExecutor()->stop();
+		delete employeeManager;
+		employeeManager = nullptr;
+	}
+	delete rateLimiter;
+	rateLimiter = nullptr;
 }
@@ -1,10 +1,14 @@
 #pragma once
 #include "stdafx.h"
 #include "DBManager.h"
+#include "DBPool.h"
+#include "DBExecutor.h"
+#include "CryptoExecutor.h"
 #include <WSS_Server.h>
 
 class CommandHandler;
 class EmployeeManager;
+class RateLimiter;
 
 class BB_Server : public WSS_Server
 {
@@ -19,6 +23,32 @@ public:
 		dbConInfo = conInformation;
 	}
 
+	const ConnectionInformation& getDBConnectionInformation() {
+		return dbConInfo;
+	}
+
+	void setDBPoolSize(int dbPoolSize) {
+		this->dbPoolSize = dbPoolSize;
+	}
+
+	void setRoleRefreshSeconds(int roleRefreshSeconds) {
+		this->roleRefreshSeconds = roleRefreshSeconds;
+	}
+
+	int getRoleRefreshSeconds() {
+		return roleRefreshSeconds;
+	}
+
+	DBPool* getDBPool();
+
+	DBExecutor* getDBExecutor();
+
+	CryptoExecutor* getCryptoExecutor();
+
+	RateLimiter* getRateLimiter() {
+		return rateLimiter;
+	}
+
 	EmployeeManager* getEmpManager() {
 		return employeeManager;
 	}
@@ -29,6 +59,9 @@ public:
 
 private:
 	CommandHandler* cmdHandler;
+	RateLimiter* rateLimiter;
 	EmployeeManager* employeeManager;
 	ConnectionInformation dbConInfo;
+	int dbPoolSize;
+	int roleRefreshSeconds;
 };
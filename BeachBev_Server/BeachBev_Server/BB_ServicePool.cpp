@@ -1,26 +1,48 @@
 #include "BB_ServicePool.h"
+#include <algorithm>
 
-BB_ServicePool::BB_ServicePool(const std::string & certFile, const std::string & keyFile, const std::string & dbConfigFile, int numUsedCores)
-	:BB_ServicePool(certFile, keyFile, ConnectionInformation(dbConfigFile), numUsedCores)
+int BB_ServicePool::GetDefaultNumStrandThreads()
 {
+	return std::max((int)std::thread::hardware_concurrency() / 2, (int)MIN_STRAND_THREADS);
 }
 
-BB_ServicePool::BB_ServicePool(const std::string & certFile, const std::string & keyFile, ConnectionInformation dbConfig, int numUsedCores)
+BB_ServicePool::BB_ServicePool(const std::string & certFile, const std::string & keyFile, const std::string & dbConfigFile, int numUsedCores, int dbPoolSize)
+	:BB_ServicePool(certFile, keyFile, ConnectionInformation(dbConfigFile), numUsedCores, dbPoolSize)
+{
+}
+
+BB_ServicePool::BB_ServicePool(const std::string & certFile, const std::string & keyFile, ConnectionInformation dbConfig, int numUsedCores, int dbPoolSize)
 	: WSS_ServicePool(certFile, keyFile, numUsedCores)
 {
 	DBManager::InitOTL();
-	for (int i = 0; i < numCores; i++) {
-		DBManager* dbManager = new DBManager();
-		dbManager->connect(dbConfig);
-		dbManagers.push_back(dbManager);
+	dbPool = new DBPool(dbConfig, dbPoolSize);
+	strandWork = new boost::asio::io_service::work(strandService);
+	for (int i = 0; i < GetDefaultNumStrandThreads(); i++) {
+		strandThreads.push_back(std::thread([this]() { strandService.run(); }));
 	}
-	dbManagerIter = dbManagers.begin();
+	dbExecutor = new DBExecutor(dbPool, dbPool->getSize());
+	cryptoExecutor = new CryptoExecutor(CryptoExecutor::GetDefaultNumWorkers());
 }
 
 BB_ServicePool::~BB_ServicePool()
 {
-	for (int i = 0; i < dbManagers.size(); i++) {
-		delete dbManagers.at(i);
+	if (cryptoExecutor != nullptr) {
+		delete cryptoExecutor;
+		cryptoExecutor = nullptr;
+	}
+	if (dbExecutor != nullptr) {
+		delete dbExecutor;
+		dbExecutor = nullptr;
+	}
+	if (strandWork != nullptr) {
+		delete strandWork;
+		strandWork = nullptr;
+	}
+	for (int i = 0; i < strandThreads.size(); i++) {
+		strandThreads.at(i).join();
+	}
+	if (dbPool != nullptr) {
+		delete dbPool;
+		dbPool = nullptr;
 	}
-	dbManagers.clear();
 }
\ No newline at end of file
@@ -2,6 +2,11 @@
 #include "stdafx.h"
 #include <WSS_ServicePool.h>
 #include "DBManager.h"
+#include "DBPool.h"
+#include "DBExecutor.h"
+#include "CryptoExecutor.h"
+#include <boost/asio.hpp>
+#include <thread>
 #include <vector>
 
 class DBManager;
@@ -10,20 +15,40 @@ class ConnectionInformation;
 class BB_ServicePool : public WSS_ServicePool
 {
 public:
-	BB_ServicePool(const std::string& certFile, const std::string& keyFile, const std::string& dbConfigFile, int numUsedCores = 1);
+	//Enough that one slow completion, such as serializing a large E1 page, never holds up every client's reply
+	static const int MIN_STRAND_THREADS = 2;
 
-	BB_ServicePool(const std::string& certFile, const std::string& keyFile, ConnectionInformation dbConfig, int numUsedCores = 1);
+	static int GetDefaultNumStrandThreads();
 
-	DBManager* getNextDBManager() {
-		if (dbManagerIter >= dbManagers.end()) {
-			dbManagerIter = dbManagers.begin();
-		}
-		return *(dbManagerIter++);
+	BB_ServicePool(const std::string& certFile, const std::string& keyFile, const std::string& dbConfigFile, int numUsedCores = 1, int dbPoolSize = DBPool::DEFAULT_POOL_SIZE);
+
+	BB_ServicePool(const std::string& certFile, const std::string& keyFile, ConnectionInformation dbConfig, int numUsedCores = 1, int dbPoolSize = DBPool::DEFAULT_POOL_SIZE);
+
+	DBPool* getDBPool() {
+		return dbPool;
+	}
+
+	DBExecutor* getDBExecutor() {
+		return dbExecutor;
+	}
+
+	CryptoExecutor* getCryptoExecutor() {
+		return cryptoExecutor;
+	}
+
+	//Runs the completions posted to client strands, kept separate from the socket io_services. Run by
+	//several threads, each strand still runs its own client's completions one at a time.
+	boost::asio::io_service& getStrandService() {
+		return strandService;
 	}
 
 	~BB_ServicePool();
 
 private:
-	std::vector <DBManager*> dbManagers;
-	std::vector <DBManager*>::iterator dbManagerIter;
+	DBPool* dbPool;
+	DBExecutor* dbExecutor;
+	CryptoExecutor* cryptoExecutor;
+	boost::asio::io_service strandService;
+	boost::asio::io_service::work* strandWork;
+	std::vector <std::thread> strandThreads;
 };
@@ -0,0 +1,369 @@
+#include "Base64Url.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define BASE64_SIMD 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+//MSVC lets any function use any intrinsic
+#define BASE64_TARGET(isa)
+#else
+//Lets GCC emit the instructions in these functions only, the rest of the build stays baseline x86
+#define BASE64_TARGET(isa) __attribute__((target(isa)))
+#endif
+#else
+#define BASE64_SIMD 0
+#endif
+
+static const char ENCODE_TABLE[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+//6-bit value of each character, -1 outside the alphabet
+static const int8_t DECODE_TABLE[256] = {
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1,
+	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
+	-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, 63,
+	-1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+static size_t TrimPadding(const char* encoded, size_t encodedSize)
+{
+	for (int i = 0; i < 2 && encodedSize > 0 && encoded[encodedSize - 1] == '='; i++) {
+		encodedSize--;
+	}
+	return encodedSize;
+}
+
+static void EncodeScalar(char* encoded, const BYTE* data, size_t dataSize)
+{
+	size_t i = 0;
+	for (; i + 3 <= dataSize; i += 3) {
+		uint32_t bits = ((uint32_t)data[i] << 16) | ((uint32_t)data[i + 1] << 8) | data[i + 2];
+		encoded[0] = ENCODE_TABLE[bits >> 18];
+		encoded[1] = ENCODE_TABLE[(bits >> 12) & 0x3f];
+		encoded[2] = ENCODE_TABLE[(bits >> 6) & 0x3f];
+		encoded[3] = ENCODE_TABLE[bits & 0x3f];
+		encoded += 4;
+	}
+	if (i + 1 == dataSize) {
+		encoded[0] = ENCODE_TABLE[data[i] >> 2];
+		encoded[1] = ENCODE_TABLE[(data[i] & 0x03) << 4];
+	}
+	else if (i + 2 == dataSize)
+	{
+		encoded[0] = ENCODE_TABLE[data[i] >> 2];
+		encoded[1] = ENCODE_TABLE[((data[i] & 0x03) << 4) | (data[i + 1] >> 4)];
+		encoded[2] = ENCODE_TABLE[(data[i + 1] & 0x0f) << 2];
+	}
+}
+
+//encodedSize is already trimmed of padding and not 1 more than a multiple of 4
+static bool DecodeScalar(BYTE* decoded, const char* encoded, size_t encodedSize)
+{
+	size_t i = 0;
+	for (; i + 4 <= encodedSize; i += 4) {
+		int8_t a = DECODE_TABLE[(BYTE)encoded[i]];
+		int8_t b = DECODE_TABLE[(BYTE)encoded[i + 1]];
+		int8_t c = DECODE_TABLE[(BYTE)encoded[i + 2]];
+		int8_t d = DECODE_TABLE[(BYTE)encoded[i + 3]];
+		//An invalid character's -1 sets the sign bit
+		if ((a | b | c | d) < 0) {
+			return false;
+		}
+		uint32_t bits = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | (uint32_t)d;
+		decoded[0] = (BYTE)(bits >> 16);
+		decoded[1] = (BYTE)(bits >> 8);
+		decoded[2] = (BYTE)bits;
+		decoded += 3;
+	}
+	size_t tail = encodedSize - i;
+	if (tail == 0) {
+		return true;
+	}
+	int8_t a = DECODE_TABLE[(BYTE)encoded[i]];
+	int8_t b = DECODE_TABLE[(BYTE)encoded[i + 1]];
+	int8_t c = tail == 3 ? DECODE_TABLE[(BYTE)encoded[i + 2]] : 0;
+	if ((a | b | c) < 0) {
+		return false;
+	}
+	uint32_t bits = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6);
+	decoded[0] = (BYTE)(bits >> 16);
+	if (tail == 3) {
+		decoded[1] = (BYTE)(bits >> 8);
+	}
+	return true;
+}
+
+#if BASE64_SIMD
+
+//The SSSE3 and AVX2 paths follow Mula and Lemire's "Faster Base64 Encoding and Decoding using AVX2
+//Instructions", with the two url characters swapped in. AVX2 runs the same steps on two 128-bit lanes.
+
+//Spreads 12 bytes at the start of input into 16 bytes holding one 6-bit value each
+BASE64_TARGET("ssse3")
+static __m128i SplitSSSE3(__m128i input)
+{
+	input = _mm_shuffle_epi8(input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+	__m128i high = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+	__m128i low = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+	return _mm_or_si128(high, low);
+}
+
+//Adds to each 6-bit value the offset of its range in the alphabet
+BASE64_TARGET("ssse3")
+static __m128i ToAsciiSSSE3(__m128i values)
+{
+	//0 for a-z, 1 to 12 for 0-9, '-' and '_', 13 for A-Z
+	__m128i range = _mm_subs_epu8(values, _mm_set1_epi8(51));
+	range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), values), _mm_set1_epi8(13)));
+	__m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0);
+	return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, range));
+}
+
+/// <summary>
+/// Reverses ToAscii, valid is set to the characters inside the alphabet
+/// </summary>
+BASE64_TARGET("ssse3")
+static __m128i FromAsciiSSSE3(__m128i input, __m128i& valid)
+{
+	__m128i upper = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(input, _mm_set1_epi8('Z' + 1)));
+	__m128i lower = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(input, _mm_set1_epi8('z' + 1)));
+	__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(input, _mm_set1_epi8('9' + 1)));
+	__m128i dash = _mm_cmpeq_epi8(input, _mm_set1_epi8('-'));
+	__m128i underscore = _mm_cmpeq_epi8(input, _mm_set1_epi8('_'));
+	valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, dash)), underscore);
+	__m128i shift = _mm_or_si128(_mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')), _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+		_mm_or_si128(_mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52 - '0')), _mm_and_si128(dash, _mm_set1_epi8(62 - '-'))),
+			_mm_and_si128(underscore, _mm_set1_epi8(63 - '_'))));
+	return _mm_add_epi8(input, shift);
+}
+
+//Packs 16 6-bit values into 12 bytes at the start of the result
+BASE64_TARGET("ssse3")
+static __m128i JoinSSSE3(__m128i values)
+{
+	__m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+	__m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+	return _mm_shuffle_epi8(quads, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+BASE64_TARGET("ssse3")
+static size_t EncodeSSSE3(char* encoded, const BYTE* data, size_t dataSize)
+{
+	size_t i = 0;
+	//Each load reads 16 bytes to use 12
+	for (; i + 16 <= dataSize; i += 12) {
+		__m128i input = _mm_loadu_si128((const __m128i*)(data + i));
+		_mm_storeu_si128((__m128i*)encoded, ToAsciiSSSE3(SplitSSSE3(input)));
+		encoded += 16;
+	}
+	return i;
+}
+
+BASE64_TARGET("ssse3")
+static bool DecodeSSSE3(BYTE* decoded, size_t decodedSize, const char* encoded, size_t encodedSize, size_t& consumed)
+{
+	size_t i = 0;
+	size_t written = 0;
+	//Each store writes 16 bytes of which 12 are kept
+	for (; i + 16 <= encodedSize && written + 16 <= decodedSize; i += 16) {
+		__m128i valid;
+		__m128i values = FromAsciiSSSE3(_mm_loadu_si128((const __m128i*)(encoded + i)), valid);
+		if (_mm_movemask_epi8(valid) != 0xffff) {
+			return false;
+		}
+		_mm_storeu_si128((__m128i*)(decoded + written), JoinSSSE3(values));
+		written += 12;
+	}
+	consumed = i;
+	return true;
+}
+
+BASE64_TARGET("avx2")
+static size_t EncodeAVX2(char* encoded, const BYTE* data, size_t dataSize)
+{
+	const __m256i shuffle = _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+		10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+	const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0,
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0);
+	size_t i = 0;
+	//Each lane reads 16 bytes to use 12, the second lane starts 12 bytes after the first
+	for (; i + 28 <= dataSize; i += 24) {
+		__m256i input = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(data + i))),
+			_mm_loadu_si128((const __m128i*)(data + i + 12)), 1);
+		input = _mm256_shuffle_epi8(input, shuffle);
+		__m256i high = _mm256_mulhi_epu16(_mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+		__m256i low = _mm256_mullo_epi16(_mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+		__m256i values = _mm256_or_si256(high, low);
+		__m256i range = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+		range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), values), _mm256_set1_epi8(13)));
+		_mm256_storeu_si256((__m256i*)encoded, _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, range)));
+		encoded += 32;
+	}
+	return i;
+}
+
+BASE64_TARGET("avx2")
+static bool DecodeAVX2(BYTE* decoded, size_t decodedSize, const char* encoded, size_t encodedSize, size_t& consumed)
+{
+	const __m256i join = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	size_t i = 0;
+	size_t written = 0;
+	//Each store writes 32 bytes of which 24 are kept
+	for (; i + 32 <= encodedSize && written + 32 <= decodedSize; i += 32) {
+		__m256i input = _mm256_loadu_si256((const __m256i*)(encoded + i));
+		__m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), input));
+		__m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), input));
+		__m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), input));
+		__m256i dash = _mm256_cmpeq_epi8(input, _mm256_set1_epi8('-'));
+		__m256i underscore = _mm256_cmpeq_epi8(input, _mm256_set1_epi8('_'));
+		__m256i valid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, dash)), underscore);
+		if (_mm256_movemask_epi8(valid) != -1) {
+			return false;
+		}
+		__m256i shift = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')), _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+			_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')), _mm256_and_si256(dash, _mm256_set1_epi8(62 - '-'))),
+				_mm256_and_si256(underscore, _mm256_set1_epi8(63 - '_'))));
+		__m256i values = _mm256_add_epi8(input, shift);
+		__m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+		__m256i quads = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+		//12 bytes at the start of each lane, moved together into the low 24
+		__m256i joined = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(quads, join), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+		_mm256_storeu_si256((__m256i*)(decoded + written), joined);
+		written += 24;
+	}
+	consumed = i;
+	return true;
+}
+
+#endif
+
+static Base64Path DetectPath()
+{
+#if BASE64_SIMD
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+	__cpuid(info, 1);
+	bool ssse3 = (info[2] & (1 << 9)) != 0;
+	//The OS must also save the ymm registers on a context switch
+	bool avx2 = false;
+	if (maxLeaf >= 7 && (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6) {
+		__cpuidex(info, 7, 0);
+		avx2 = (info[1] & (1 << 5)) != 0;
+	}
+#else
+	__builtin_cpu_init();
+	bool ssse3 = __builtin_cpu_supports("ssse3");
+	bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+	if (avx2) {
+		return Base64Path::AVX2;
+	}
+	if (ssse3) {
+		return Base64Path::SSSE3;
+	}
+#endif
+	return Base64Path::Scalar;
+}
+
+size_t Base64Url::EncodedSize(size_t dataSize)
+{
+	return dataSize / 3 * 4 + (dataSize % 3 == 0 ? 0 : dataSize % 3 + 1);
+}
+
+size_t Base64Url::DecodedSize(const char* encoded, size_t encodedSize)
+{
+	encodedSize = TrimPadding(encoded, encodedSize);
+	return encodedSize / 4 * 3 + (encodedSize % 4 <= 1 ? 0 : encodedSize % 4 - 1);
+}
+
+void Base64Url::Encode(char * encoded, const BYTE * data, size_t dataSize)
+{
+	Encode(encoded, data, dataSize, GetBestPath());
+}
+
+bool Base64Url::Decode(BYTE * decoded, const char * encoded, size_t encodedSize)
+{
+	return Decode(decoded, encoded, encodedSize, GetBestPath());
+}
+
+void Base64Url::Encode(char * encoded, const BYTE * data, size_t dataSize, Base64Path path)
+{
+	size_t done = 0;
+#if BASE64_SIMD
+	if (path > GetBestPath()) {
+		path = GetBestPath();
+	}
+	if (path == Base64Path::AVX2) {
+		done = EncodeAVX2(encoded, data, dataSize);
+	}
+	if (path >= Base64Path::SSSE3) {
+		done += EncodeSSSE3(encoded + done / 3 * 4, data + done, dataSize - done);
+	}
+#endif
+	EncodeScalar(encoded + done / 3 * 4, data + done, dataSize - done);
+}
+
+bool Base64Url::Decode(BYTE * decoded, const char * encoded, size_t encodedSize, Base64Path path)
+{
+	encodedSize = TrimPadding(encoded, encodedSize);
+	if (encodedSize % 4 == 1) {
+		return false;
+	}
+	size_t done = 0;
+#if BASE64_SIMD
+	size_t decodedSize = DecodedSize(encoded, encodedSize);
+	size_t consumed = 0;
+	if (path > GetBestPath()) {
+		path = GetBestPath();
+	}
+	if (path == Base64Path::AVX2) {
+		if (!DecodeAVX2(decoded, decodedSize, encoded, encodedSize, consumed)) {
+			return false;
+		}
+		done = consumed;
+	}
+	if (path >= Base64Path::SSSE3) {
+		if (!DecodeSSSE3(decoded + done / 4 * 3, decodedSize - done / 4 * 3, encoded + done, encodedSize - done, consumed)) {
+			return false;
+		}
+		done += consumed;
+	}
+#endif
+	return DecodeScalar(decoded + done / 4 * 3, encoded + done, encodedSize - done);
+}
+
+Base64Path Base64Url::GetBestPath()
+{
+	static const Base64Path bestPath = DetectPath();
+	return bestPath;
+}
+
+const char* Base64Url::GetPathName(Base64Path path)
+{
+	switch (path) {
+	case Base64Path::AVX2:
+		return "AVX2";
+	case Base64Path::SSSE3:
+		return "SSSE3";
+	default:
+		return "scalar";
+	}
+}
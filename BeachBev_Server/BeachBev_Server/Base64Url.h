@@ -0,0 +1,54 @@
+#pragma once
+#include "stdafx.h"
+#include <stdint.h>
+#include <stddef.h>
+
+typedef unsigned char BYTE;
+
+enum class Base64Path {
+	Scalar,
+	SSSE3,
+	AVX2
+};
+
+/// <summary>
+/// Unpadded base64url (RFC 4648 section 5) straight into caller buffers, the same text CryptoPP's
+/// Base64URLEncoder produces. Whole blocks go through SSSE3 or AVX2 when the CPU has them, picked
+/// once at startup, and the tail through a lookup table.
+/// </summary>
+class Base64Url
+{
+public:
+	static size_t EncodedSize(size_t dataSize);
+
+	/// <summary>
+	/// Bytes encodedSize characters decode to, trailing '=' padding counts as nothing
+	/// </summary>
+	static size_t DecodedSize(const char* encoded, size_t encodedSize);
+
+	/// <summary>
+	/// Writes EncodedSize(dataSize) characters to encoded, without padding or a terminator
+	/// </summary>
+	static void Encode(char* encoded, const BYTE* data, size_t dataSize);
+
+	/// <summary>
+	/// Writes DecodedSize(encoded, encodedSize) bytes to decoded
+	/// </summary>
+	/// <returns>False if a character is outside the alphabet or the length cannot be base64,
+	/// what was written to decoded is meaningless in that case</returns>
+	static bool Decode(BYTE* decoded, const char* encoded, size_t encodedSize);
+
+	/// <summary>
+	/// Encode and Decode limited to path, for checking the vector paths against the scalar one.
+	/// A path the CPU does not have falls back to the best one it does.
+	/// </summary>
+	static void Encode(char* encoded, const BYTE* data, size_t dataSize, Base64Path path);
+	static bool Decode(BYTE* decoded, const char* encoded, size_t encodedSize, Base64Path path);
+
+	/// <summary>
+	/// Fastest path this CPU supports
+	/// </summary>
+	static Base64Path GetBestPath();
+
+	static const char* GetPathName(Base64Path path);
+};
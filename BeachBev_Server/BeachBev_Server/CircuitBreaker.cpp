@@ -0,0 +1,101 @@
+#include "CircuitBreaker.h"
+#include <algorithm>
+
+const char* CircuitBreaker::GetStateName(BreakerState state)
+{
+	switch (state) {
+	case BreakerState::Closed:
+		return "closed";
+	case BreakerState::Open:
+		return "open";
+	default:
+		return "half open";
+	}
+}
+
+CircuitBreaker::CircuitBreaker()
+	:state(BreakerState::Closed)
+{
+	stats = CircuitBreakerStats();
+	stats.openMillis = MIN_OPEN_MILLIS;
+}
+
+bool CircuitBreaker::isOpen()
+{
+	std::lock_guard<std::mutex> lock(breakerMutex);
+	return state != BreakerState::Closed && std::chrono::steady_clock::now() < nextTrialTime;
+}
+
+bool CircuitBreaker::allowRequest()
+{
+	std::lock_guard<std::mutex> lock(breakerMutex);
+	if (state == BreakerState::Closed) {
+		return true;
+	}
+	auto now = std::chrono::steady_clock::now();
+	if (now < nextTrialTime) {
+		return false;
+	}
+	//Also covers a trial that never reported, such as a job that turned out not to need the database
+	state = BreakerState::HalfOpen;
+	nextTrialTime = now + std::chrono::milliseconds(stats.openMillis);
+	stats.trials++;
+	return true;
+}
+
+void CircuitBreaker::recordSuccess()
+{
+	std::lock_guard<std::mutex> lock(breakerMutex);
+	stats.consecutiveFailures = 0;
+	if (state == BreakerState::Closed) {
+		return;
+	}
+	state = BreakerState::Closed;
+	stats.openMillis = MIN_OPEN_MILLIS;
+	std::cerr << "Database reachable again, circuit breaker closed" << std::endl;
+}
+
+void CircuitBreaker::recordFailure()
+{
+	std::lock_guard<std::mutex> lock(breakerMutex);
+	stats.consecutiveFailures++;
+	if (state == BreakerState::HalfOpen) {
+		stats.failedTrials++;
+		stats.openMillis = std::min(stats.openMillis * 2, (int)MAX_OPEN_MILLIS);
+		open();
+	}
+	else if (state == BreakerState::Closed && stats.consecutiveFailures >= FAILURE_THRESHOLD)
+	{
+		stats.trips++;
+		stats.lastTripTime = std::time(NULL);
+		open();
+		std::cerr << "Database unreachable after " << stats.consecutiveFailures << " connection failures, circuit breaker open" << std::endl;
+	}
+}
+
+void CircuitBreaker::releaseTrial()
+{
+	std::lock_guard<std::mutex> lock(breakerMutex);
+	if (state == BreakerState::HalfOpen) {
+		nextTrialTime = std::chrono::steady_clock::now();
+	}
+}
+
+CircuitBreakerStats CircuitBreaker::getStats()
+{
+	std::lock_guard<std::mutex> lock(breakerMutex);
+	CircuitBreakerStats breakerStats = stats;
+	breakerStats.state = state;
+	breakerStats.remainingMillis = 0;
+	auto now = std::chrono::steady_clock::now();
+	if (state == BreakerState::Open && now < nextTrialTime) {
+		breakerStats.remainingMillis = std::chrono::duration_cast<std::chrono::milliseconds>(nextTrialTime - now).count();
+	}
+	return breakerStats;
+}
+
+void CircuitBreaker::open()
+{
+	state = BreakerState::Open;
+	nextTrialTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(stats.openMillis);
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "stdafx.h"
+#include <mutex>
+#include <chrono>
+#include <ctime>
+
+enum class BreakerState {
+	//Requests go to the database
+	Closed,
+	//The database is unreachable, requests fail fast until openMillis has passed
+	Open,
+	//One trial request is let through to see if the database is back
+	HalfOpen
+};
+
+struct CircuitBreakerStats {
+	BreakerState state;
+	int consecutiveFailures;
+	//Times the breaker went from closed to open
+	uint64_t trips;
+	uint64_t trials;
+	uint64_t failedTrials;
+	//How long the breaker stays open before the next trial, doubles with each failed trial
+	int openMillis;
+	//Until the next trial is allowed, 0 unless open
+	int remainingMillis;
+	std::time_t lastTripTime;
+};
+
+/// <summary>
+/// Tracks whether the database is reachable so handlers can be turned away immediately during
+/// an outage instead of each one blocking until the driver times out. DBManager reports every
+/// statement and asks allowRequest before each one, only connection failures count against the database.
+/// </summary>
+class CircuitBreaker
+{
+public:
+	//Connection failures in a row that open the breaker
+	static const int FAILURE_THRESHOLD = 3;
+	static const int MIN_OPEN_MILLIS = 1000;
+	static const int MAX_OPEN_MILLIS = 30000;
+
+	static const char* GetStateName(BreakerState state);
+
+	CircuitBreaker();
+
+	/// <summary>
+	/// True while requests should fail fast, open with no trial due or half open with the trial still
+	/// out. Does not change the state, so a check ahead of DBManager does not use up the trial.
+	/// </summary>
+	bool isOpen();
+
+	/// <summary>
+	/// Call before touching the database. Once openMillis has passed the breaker goes half open and
+	/// the first caller is let through as the trial, everyone else is refused until it reports back
+	/// or another openMillis passes without a report.
+	/// </summary>
+	bool allowRequest();
+
+	/// <summary>
+	/// The database answered, even with an error, so the breaker closes
+	/// </summary>
+	void recordSuccess();
+
+	/// <summary>
+	/// A connection was lost or could not be opened
+	/// </summary>
+	void recordFailure();
+
+	/// <summary>
+	/// The trial ended without reaching the database, so the next caller may take it right away
+	/// </summary>
+	void releaseTrial();
+
+	CircuitBreakerStats getStats();
+
+private:
+	//Callers must hold breakerMutex
+	void open();
+
+	std::mutex breakerMutex;
+	BreakerState state;
+	std::chrono::steady_clock::time_point nextTrialTime;
+	CircuitBreakerStats stats;
+};
@@ -1,7 +1,26 @@
 #include "CommandHandler.h"
+#include "BB_Server.h"
+#include "DBPool.h"
+#include "DBExecutor.h"
+#include "EmployeeManager.h"
+#include "EmployeeDirectory.h"
+#include "AcceptManager.h"
+#include "MasterManager.h"
+#include "PwdTokenWriter.h"
+#include "SessionCache.h"
+#include "RateLimiter.h"
+#include "TokenSweeper.h"
+#include "CryptoManager.h"
+#include "Base64Url.h"
 #include <Logger.h>
+#include <cryptopp/osrng.h>
+#include <cryptopp/base64.h>
 #include <iostream>
 #include <thread>
+#include <chrono>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
 
 bool ExitCommand(BB_Server* bbServer) {
 	std::cout << "Exiting..." << std::endl;
@@ -21,6 +40,633 @@ Selection: ";
 	return true;
 }
 
+bool DBPoolCommand(BB_Server* bbServer) {
+	DBPoolStats stats = bbServer->getDBPool()->getStats();
+	std::cout << "Backend: " << DBBackend::Get(bbServer->getDBConnectionInformation().backend)->getName() << std::endl;
+	std::cout << "DBPool size: " << stats.size << std::endl;
+	std::cout << "In use: " << stats.inUse << " (peak " << stats.peakInUse << ")" << std::endl;
+	std::cout << "Checkouts: " << stats.checkouts << std::endl;
+	std::cout << "Affinity hits: " << stats.affinityHits << std::endl;
+	std::cout << "Statement cache hits: " << stats.statementCacheHits << ", misses: " << stats.statementCacheMisses << std::endl;
+	std::cout << "Waits: " << stats.waits << std::endl;
+	if (stats.waits > 0) {
+		std::cout << "Avg wait: " << (stats.totalWaitMicros / stats.waits) << "us, max wait: " << stats.maxWaitMicros << "us" << std::endl;
+	}
+	return true;
+}
+
+bool DBHealthCommand(BB_Server* bbServer) {
+	std::vector <DBHealth> poolHealth = bbServer->getDBPool()->getHealth();
+	for (int i = 0; i < poolHealth.size(); i++) {
+		const DBHealth& health = poolHealth.at(i);
+		std::cout << "Connection " << i << ": " << (health.connected ? "up" : "DOWN");
+		if (!health.connected) {
+			std::cout << " (" << health.failedAttempts << " failed reconnects, retry in up to " << health.backoffMillis << "ms)";
+		}
+		std::cout << std::endl;
+		std::cout << "\tLost: " << health.lostConnections << ", reconnects: " << health.reconnects << ", retried statements: " << health.retries << std::endl;
+		std::cout << "\tProbes: " << health.probes << ", failed: " << health.failedProbes;
+		if (health.lastProbeTime != 0) {
+			std::cout << ", last " << (std::time(NULL) - health.lastProbeTime) << "s ago";
+		}
+		std::cout << std::endl;
+	}
+	return true;
+}
+
+bool DBReplicasCommand(BB_Server* bbServer) {
+	uint64_t fallbacks = 0;
+	std::vector <DBReplicaStats> replicaStats = bbServer->getDBPool()->getReplicaStats(fallbacks);
+	if (replicaStats.empty()) {
+		std::cout << "No replicas configured, all reads go to the primary" << std::endl;
+		return true;
+	}
+	for (int i = 0; i < replicaStats.size(); i++) {
+		const DBReplicaStats& stats = replicaStats.at(i);
+		std::cout << stats.server << ": " << stats.connected << "/" << stats.connections << " connected, "
+			<< stats.statements << " statements, lag ";
+		if (stats.maxLagSeconds >= 0) {
+			std::cout << stats.maxLagSeconds << "s";
+		}
+		else
+		{
+			std::cout << "unknown";
+		}
+		std::cout << std::endl;
+	}
+	std::cout << "Reads that fell back to the primary: " << fallbacks << std::endl;
+	return true;
+}
+
+bool DBQueueCommand(BB_Server* bbServer) {
+	DBExecutorStats stats = bbServer->getDBExecutor()->getStats();
+	std::cout << "DB workers: " << stats.numWorkers << std::endl;
+	std::cout << "Queue depth: " << stats.queueDepth << " (peak " << stats.peakQueueDepth << ", max " << stats.maxQueueDepth << ")" << std::endl;
+	std::cout << "Submitted: " << stats.submitted << ", completed: " << stats.completed << ", rejected: " << stats.rejected << std::endl;
+	std::cout << "Group commit size: " << stats.groupCommitSize << ", group commits: " << stats.groupCommits;
+	if (stats.groupCommits > 0) {
+		std::cout << " (avg " << ((double)stats.groupedJobs / stats.groupCommits) << " jobs)";
+	}
+	std::cout << std::endl;
+	return true;
+}
+
+bool CryptoQueueCommand(BB_Server* bbServer) {
+	CryptoExecutorStats stats = bbServer->getCryptoExecutor()->getStats();
+	std::cout << "Crypto workers: " << stats.numWorkers << std::endl;
+	std::cout << "Queue depth: " << stats.queueDepth << " (peak " << stats.peakQueueDepth << ", max " << stats.maxQueueDepth << ")" << std::endl;
+	std::cout << "Submitted: " << stats.submitted << ", completed: " << stats.completed << ", rejected: " << stats.rejected;
+	if (stats.completed > 0) {
+		std::cout << " (avg " << (stats.totalMicros / stats.completed) << "us)";
+	}
+	std::cout << std::endl;
+	return true;
+}
+
+bool DBBreakerCommand(BB_Server* bbServer) {
+	CircuitBreakerStats stats = bbServer->getDBPool()->getCircuitBreaker()->getStats();
+	std::cout << "Circuit breaker: " << CircuitBreaker::GetStateName(stats.state);
+	if (stats.remainingMillis > 0) {
+		std::cout << ", next trial in " << stats.remainingMillis << "ms";
+	}
+	std::cout << std::endl;
+	std::cout << "Connection failures in a row: " << stats.consecutiveFailures << " (opens at " << (int)CircuitBreaker::FAILURE_THRESHOLD << ")" << std::endl;
+	std::cout << "Trips: " << stats.trips;
+	if (stats.lastTripTime != 0) {
+		std::cout << ", last " << (std::time(NULL) - stats.lastTripTime) << "s ago";
+	}
+	std::cout << std::endl;
+	std::cout << "Trials: " << stats.trials << ", failed: " << stats.failedTrials << ", open for " << stats.openMillis << "ms between trials" << std::endl;
+	std::cout << "Jobs turned away: " << bbServer->getDBExecutor()->getStats().degraded << std::endl;
+	return true;
+}
+
+static void PrintLatency(const LatencySnapshot& snapshot)
+{
+	std::cout << snapshot.count << " runs, p50 " << snapshot.getPercentile(50) << "us, p99 " << snapshot.getPercentile(99)
+		<< "us, max " << snapshot.maxMicros << "us" << std::endl;
+}
+
+bool DBStatsCommand(BB_Server* bbServer) {
+	std::vector <DBConnectionLatencies> poolLatencies = bbServer->getDBPool()->getLatencies();
+	std::vector <LatencySnapshot> statementTotals(NUM_STATEMENTS);
+	std::cout << "By connection:" << std::endl;
+	for (int i = 0; i < poolLatencies.size(); i++) {
+		const DBConnectionLatencies& latencies = poolLatencies.at(i);
+		LatencySnapshot connectionTotal;
+		for (int j = 0; j < latencies.statements.size(); j++) {
+			connectionTotal.merge(latencies.statements.at(j));
+			statementTotals.at(j).merge(latencies.statements.at(j));
+		}
+		std::cout << "\tConnection " << latencies.connection << (latencies.replica ? " replica: " : ": ");
+		PrintLatency(connectionTotal);
+	}
+	std::cout << "By statement:" << std::endl;
+	for (int i = 0; i < statementTotals.size(); i++) {
+		if (statementTotals.at(i).count == 0) {
+			continue;
+		}
+		std::cout << "\t" << GetStatementDef((StatementID)i).name << ": ";
+		PrintLatency(statementTotals.at(i));
+	}
+	uint64_t slowQueries = 0;
+	std::vector <DBHealth> poolHealth = bbServer->getDBPool()->getHealth();
+	for (int i = 0; i < poolHealth.size(); i++) {
+		slowQueries += poolHealth.at(i).slowQueries;
+	}
+	uint64_t fallbacks = 0;
+	std::vector <DBReplicaStats> replicaStats = bbServer->getDBPool()->getReplicaStats(fallbacks);
+	for (int i = 0; i < replicaStats.size(); i++) {
+		slowQueries += replicaStats.at(i).slowQueries;
+	}
+	std::cout << "Slow queries: " << slowQueries << " (over " << DBManager::GetSlowQueryMillis() << "ms)" << std::endl;
+	return true;
+}
+
+bool SlowQueryCommand(BB_Server* bbServer) {
+	int slowQueryMillis = 0;
+	std::cout << "Log statements slower than (ms): ";
+	std::cin >> slowQueryMillis;
+	DBManager::SetSlowQueryMillis(slowQueryMillis);
+	return true;
+}
+
+bool DirectoryCommand(BB_Server* bbServer) {
+	DirectoryStats stats = bbServer->getEmpManager()->getDirectory()->getStats();
+	std::cout << "Employees: " << stats.entries << std::endl;
+	std::cout << "Hits: " << stats.hits << ", misses: " << stats.misses;
+	if (stats.hits + stats.misses > 0) {
+		std::cout << " (" << (stats.hits * 100 / (stats.hits + stats.misses)) << "% hit rate)";
+	}
+	std::cout << std::endl;
+	std::cout << "Approx memory: " << (stats.memoryBytes / 1024) << "KB" << std::endl;
+	return true;
+}
+
+bool DashboardCommand(BB_Server* bbServer) {
+	DashboardStats stats = bbServer->getEmpManager()->getAcceptManager()->getDashboardStats();
+	std::cout << "aState version: " << stats.aStateVersion << ", cached E1 version: " << stats.snapshotVersion;
+	if (stats.snapshotVersion == stats.aStateVersion) {
+		std::cout << " (current, " << stats.snapshotBytes << " bytes)";
+	}
+	else
+	{
+		std::cout << " (stale)";
+	}
+	std::cout << std::endl;
+	std::cout << "Hits: " << stats.hits << ", misses: " << stats.misses << ", rebuilds: " << stats.rebuilds;
+	if (stats.hits + stats.misses > 0) {
+		std::cout << " (" << (stats.hits * 100 / (stats.hits + stats.misses)) << "% hit rate)";
+	}
+	std::cout << std::endl;
+	return true;
+}
+
+bool SessionsCommand(BB_Server* bbServer) {
+	SessionCacheStats stats = bbServer->getEmpManager()->getSessionCache()->getStats();
+	std::cout << "Cached sessions: " << stats.entries << " / " << stats.capacity << std::endl;
+	std::cout << "Hits: " << stats.hits << ", misses: " << stats.misses;
+	if (stats.hits + stats.misses > 0) {
+		std::cout << " (" << (stats.hits * 100 / (stats.hits + stats.misses)) << "% hit rate)";
+	}
+	std::cout << std::endl;
+	std::cout << "Evictions: " << stats.evictions << ", invalidations: " << stats.invalidations << std::endl;
+	return true;
+}
+
+bool RateLimitCommand(BB_Server* bbServer) {
+	RateLimiter* rateLimiter = bbServer->getRateLimiter();
+	RateLimiterStats stats = rateLimiter->getStats();
+	std::cout << "Allowed: " << stats.allowed << std::endl;
+	for (int i = 0; i < NUM_RATE_LIMIT_SCOPES; i++) {
+		RateLimit limit = rateLimiter->getLimit((RateLimitScope)i);
+		std::cout << RateLimiter::GetScopeName((RateLimitScope)i) << ": " << limit.rate << "/s, burst " << limit.burst
+			<< ", " << stats.buckets[i] << " buckets, throttled " << stats.throttled[i] << std::endl;
+	}
+	for (auto throttledIter = stats.throttledByKey.begin(); throttledIter != stats.throttledByKey.end(); throttledIter++) {
+		std::cout << throttledIter->first << " (cost " << rateLimiter->getCost(throttledIter->first) << ") throttled: " << throttledIter->second << std::endl;
+	}
+	return true;
+}
+
+bool SetRateLimitCommand(BB_Server* bbServer) {
+	std::cout << "Select scope:\n\
+0) Client\n\
+1) Account\n\
+Selection: ";
+	int scope = 0;
+	std::cin >> scope;
+	if (scope < 0 || scope >= NUM_RATE_LIMIT_SCOPES) {
+		std::cout << "Invalid scope" << std::endl;
+		return true;
+	}
+	double rate = 0;
+	double burst = 0;
+	std::cout << "Refill per second (0 turns the scope off): ";
+	std::cin >> rate;
+	std::cout << "Burst: ";
+	std::cin >> burst;
+	bbServer->getRateLimiter()->setLimit((RateLimitScope)scope, rate, burst);
+	return true;
+}
+
+bool SetPKeyCostCommand(BB_Server* bbServer) {
+	std::string pKey;
+	double cost = 0;
+	std::cout << "PKey: ";
+	std::cin >> pKey;
+	std::cout << "Cost (currently " << bbServer->getRateLimiter()->getCost(pKey) << "): ";
+	std::cin >> cost;
+	bbServer->getRateLimiter()->setCost(pKey, cost);
+	return true;
+}
+
+bool TokenQueueCommand(BB_Server* bbServer) {
+	PwdTokenWriterStats stats = bbServer->getEmpManager()->getPwdTokenWriter()->getStats();
+	std::cout << "Pending pwdTokens: " << stats.pending << std::endl;
+	std::cout << "Queued: " << stats.queued << ", coalesced: " << stats.coalesced << ", discarded: " << stats.discarded << std::endl;
+	std::cout << "Flushes: " << stats.flushes << ", rows written: " << stats.rowsWritten << ", failed flushes: " << stats.failedFlushes;
+	if (stats.flushes > 0) {
+		std::cout << " (avg " << ((double)stats.rowsWritten / stats.flushes) << " rows)";
+	}
+	std::cout << std::endl;
+	return true;
+}
+
+bool SweeperCommand(BB_Server* bbServer) {
+	TokenSweepStats stats = bbServer->getEmpManager()->getTokenSweeper()->getStats();
+	std::cout << "Sweeps: " << stats.sweeps << " (" << stats.abandonedSweeps << " stopped early)";
+	if (stats.lastSweepTime != 0) {
+		std::cout << ", last " << (std::time(NULL) - stats.lastSweepTime) << "s ago taking " << stats.lastSweepMicros << "us";
+	}
+	std::cout << std::endl;
+	std::cout << "Removed pwdTokens: " << stats.pwdTokensRemoved << ", pwdResetTokens: " << stats.pwdResetTokensRemoved
+		<< ", unverifiedEmails: " << stats.unverifiedEmailsRemoved << std::endl;
+	std::cout << "Time spent: " << stats.totalMicros << "us, deferred batches: " << stats.deferrals << std::endl;
+	return true;
+}
+
+bool SweepCommand(BB_Server* bbServer) {
+	bbServer->getEmpManager()->getTokenSweeper()->sweepNow();
+	std::cout << "Sweeping expired tokens, use sweeper for the results" << std::endl;
+	return true;
+}
+
+bool InvalidateRolesCommand(BB_Server* bbServer) {
+	bbServer->getEmpManager()->getMasterManager()->invalidate();
+	std::cout << "Reloading masters" << std::endl;
+	return true;
+}
+
+//Times the applicant list query fetching one row per round trip against the bulk fetch size
+bool BenchFetchCommand(BB_Server* bbServer) {
+	int aState = 0;
+	int iterations = 0;
+	std::cout << "aState: ";
+	std::cin >> aState;
+	std::cout << "Iterations: ";
+	std::cin >> iterations;
+	DBLease dbLease(bbServer->getDBPool());
+	const StatementDef& statementDef = dbLease.get()->getBackend()->getStatementDef(STMT_GET_EIDS_WITH_ASTATE);
+	int bufferSizes[] = { SINGLE_ROW_BUFFER_SIZE, statementDef.bufferSize };
+	for (int bufferSize : bufferSizes) {
+		uint64_t rows = 0;
+		auto start = std::chrono::steady_clock::now();
+		try {
+			otl_stream otlStream(bufferSize, statementDef.query, *dbLease.get()->getConnection());
+			StatementStream<STMT_GET_EIDS_WITH_ASTATE> stmt(otlStream);
+			for (int i = 0; i < iterations; i++) {
+				stmt.bind(aState);
+				int eID;
+				while (stmt.fetch(eID)) {
+					rows++;
+				}
+			}
+		}
+		catch (otl_exception ex)
+		{
+			std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+			return true;
+		}
+		auto micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "Buffer size " << bufferSize << ": " << rows << " rows in " << micros << "us";
+		if (iterations > 0) {
+			std::cout << " (" << (micros / iterations) << "us per query)";
+		}
+		std::cout << std::endl;
+	}
+	return true;
+}
+
+//What OutputBytes did before RawBytes: a heap buffer per value, filled a byte at a time
+static void LegacyOutputBytes(otl_stream& otlStream, const BYTE* data, uint16_t size)
+{
+	otl_long_string otlStr(size);
+	for (int i = 0; i < size; i++) {
+		otlStr[i] = data[i];
+	}
+	otlStr.set_len(size);
+	otlStream << otlStr;
+}
+
+//What InputBytes did before RawBytes: a heap buffer per value, read back a byte at a time
+static void LegacyInputBytes(otl_stream& otlStream, BYTE* data, uint16_t size)
+{
+	otl_long_string otlStr(size);
+	otlStream >> otlStr;
+	for (int i = 0; i < size; i++) {
+		data[i] = otlStr[i];
+	}
+}
+
+//Times binding a token hash to checkPwdResetToken and fetching eID's hash and salt with getPwdData, the old way against RawBytes.
+//Both statements only read, and the bound hash is random so it matches no reset token.
+bool BenchRawBindCommand(BB_Server* bbServer) {
+	int eIDInt = 0;
+	int iterations = 0;
+	std::cout << "eID with a password: ";
+	std::cin >> eIDInt;
+	std::cout << "Iterations: ";
+	std::cin >> iterations;
+	BYTE tokenHash[TOKEN_SIZE];
+	CryptoManager::GenerateRandomData(tokenHash, TOKEN_SIZE);
+	BYTE hashes[2][HASH_SIZE] = {};
+	BYTE salts[2][SALT_SIZE] = {};
+	const char* pathNames[] = { "legacy", "RawBytes" };
+	DBLease dbLease(bbServer->getDBPool());
+	const DBBackend* backend = dbLease.get()->getBackend();
+	try {
+		otl_stream bindStream(SINGLE_ROW_BUFFER_SIZE, backend->getStatementDef(STMT_CHECK_PWD_RESET_TOKEN).query, *dbLease.get()->getConnection());
+		otl_stream fetchStream(SINGLE_ROW_BUFFER_SIZE, backend->getStatementDef(STMT_GET_PWD_DATA).query, *dbLease.get()->getConnection());
+		StatementStream<STMT_CHECK_PWD_RESET_TOKEN> bindStmt(bindStream);
+		StatementStream<STMT_GET_PWD_DATA> fetchStmt(fetchStream);
+		for (int path = 0; path < 2; path++) {
+			auto start = std::chrono::steady_clock::now();
+			for (int i = 0; i < iterations; i++) {
+				if (path == 0) {
+					LegacyOutputBytes(bindStream, tokenHash, TOKEN_SIZE);
+				}
+				else
+				{
+					bindStmt.bind(tokenHash);
+				}
+				int resetEID;
+				OTL_BIGINT tokenTime;
+				while (bindStmt.fetch(resetEID, tokenTime)) {
+				}
+			}
+			auto bindNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+			int rows = 0;
+			start = std::chrono::steady_clock::now();
+			for (int i = 0; i < iterations; i++) {
+				fetchStmt.bind(eIDInt);
+				if (path == 0) {
+					if (!fetchStream.eof()) {
+						LegacyInputBytes(fetchStream, hashes[path], HASH_SIZE);
+						LegacyInputBytes(fetchStream, salts[path], SALT_SIZE);
+						rows++;
+					}
+				}
+				else if (fetchStmt.fetch(hashes[path], salts[path]))
+				{
+					rows++;
+				}
+			}
+			auto fetchNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+			std::cout << pathNames[path] << ": bind " << bindNanos << "ns, fetch " << fetchNanos << "ns (" << rows << " rows)";
+			if (iterations > 0) {
+				std::cout << ", " << ((double)bindNanos / iterations) << "ns per bind query, " << ((double)fetchNanos / iterations) << "ns per fetch query";
+			}
+			std::cout << std::endl;
+		}
+	}
+	catch (otl_exception ex)
+	{
+		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+		return true;
+	}
+	bool same = std::equal(hashes[0], hashes[0] + HASH_SIZE, hashes[1]) && std::equal(salts[0], salts[0] + SALT_SIZE, salts[1]);
+	std::cout << "Both paths read the same hash and salt: " << (same ? "yes" : "no") << std::endl;
+	return true;
+}
+
+//What GenerateRandomData did before each thread kept its own pool: seed a new pool from the OS every call
+static void LegacyRandomData(BYTE* rngData, uint32_t rngDataSize)
+{
+	CryptoPP::AutoSeededRandomPool rng;
+	rng.GenerateBlock(rngData, rngDataSize);
+}
+
+//Compares the per-call pool against the buffered thread-local one for salt and token sized requests
+bool BenchRandomCommand(BB_Server* bbServer) {
+	int iterations = 0;
+	std::cout << "Iterations: ";
+	std::cin >> iterations;
+	BYTE data[TOKEN_SIZE];
+	uint32_t sizes[] = { SALT_SIZE, TOKEN_SIZE };
+	for (uint32_t size : sizes) {
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			LegacyRandomData(data, size);
+		}
+		auto legacyNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			CryptoManager::GenerateRandomData(data, size);
+		}
+		auto bufferedNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		std::cout << size << " bytes: per-call pool " << legacyNanos << "ns, thread-local " << bufferedNanos << "ns";
+		if (iterations > 0) {
+			std::cout << ", " << ((double)legacyNanos / iterations) << " vs " << ((double)bufferedNanos / iterations) << "ns per call";
+		}
+		std::cout << std::endl;
+	}
+	return true;
+}
+
+//What UrlEncode and UrlDecode did before Base64Url: run the bytes through CryptoPP's filters
+static void LegacyUrlEncode(std::string& encoded, const BYTE* data, uint32_t dataSize)
+{
+	CryptoPP::Base64URLEncoder encoder;
+	encoder.Put(data, dataSize);
+	encoder.MessageEnd();
+	CryptoPP::word64 size = encoder.MaxRetrievable();
+	encoded.clear();
+	if (size) {
+		encoded.resize(size);
+		encoder.Get((byte*)encoded.data(), encoded.size());
+	}
+}
+
+static void LegacyUrlDecode(std::vector <BYTE>& decoded, const std::string& encoded)
+{
+	CryptoPP::Base64URLDecoder decoder;
+	decoder.Put((byte*)encoded.data(), encoded.size());
+	decoder.MessageEnd();
+	CryptoPP::word64 size = decoder.MaxRetrievable();
+	decoded.clear();
+	if (size) {
+		decoded.resize(size);
+		decoder.Get((byte*)decoded.data(), decoded.size());
+	}
+}
+
+//Round trips random data of every length up to a few vector blocks through each Base64Url path and CryptoPP,
+//and checks every path rejects a character outside the alphabet
+bool CheckBase64Command(BB_Server* bbServer) {
+	const int MAX_LENGTH = 200;
+	const int ROUNDS = 16;
+	Base64Path paths[] = { Base64Path::Scalar, Base64Path::SSSE3, Base64Path::AVX2 };
+	std::cout << "Best path: " << Base64Url::GetPathName(Base64Url::GetBestPath()) << std::endl;
+	int failures = 0;
+	BYTE data[MAX_LENGTH];
+	BYTE decoded[MAX_LENGTH];
+	for (int length = 0; length <= MAX_LENGTH; length++) {
+		for (int round = 0; round < ROUNDS; round++) {
+			CryptoManager::GenerateRandomData(data, length);
+			std::string expected;
+			LegacyUrlEncode(expected, data, length);
+			std::vector <BYTE> expectedDecoded;
+			LegacyUrlDecode(expectedDecoded, expected);
+			if (expectedDecoded.size() != (size_t)length || !std::equal(expectedDecoded.begin(), expectedDecoded.end(), data)) {
+				std::cout << "CryptoPP did not round trip " << length << " bytes" << std::endl;
+				failures++;
+			}
+			for (Base64Path path : paths) {
+				std::string encoded(Base64Url::EncodedSize(length), '\0');
+				Base64Url::Encode(&encoded[0], data, length, path);
+				if (encoded != expected) {
+					std::cout << Base64Url::GetPathName(path) << " encoded " << length << " bytes as " << encoded << " not " << expected << std::endl;
+					failures++;
+				}
+				if (Base64Url::DecodedSize(expected.data(), expected.size()) != (size_t)length
+					|| !Base64Url::Decode(decoded, expected.data(), expected.size(), path) || !std::equal(decoded, decoded + length, data)) {
+					std::cout << Base64Url::GetPathName(path) << " did not decode " << expected << std::endl;
+					failures++;
+				}
+				if (length > 0) {
+					std::string corrupted = expected;
+					corrupted[(round * 7) % corrupted.size()] = (round % 2 == 0) ? '+' : '/';
+					if (Base64Url::Decode(decoded, corrupted.data(), corrupted.size(), path)) {
+						std::cout << Base64Url::GetPathName(path) << " accepted " << corrupted << std::endl;
+						failures++;
+					}
+				}
+			}
+		}
+	}
+	std::cout << "Base64Url check finished, " << failures << " failures" << std::endl;
+	return true;
+}
+
+//Compares CryptoPP's filters against the scalar and best Base64Url paths on token sized data
+bool BenchBase64Command(BB_Server* bbServer) {
+	int iterations = 0;
+	std::cout << "Iterations: ";
+	std::cin >> iterations;
+	BYTE data[TOKEN_SIZE];
+	CryptoManager::GenerateRandomData(data, TOKEN_SIZE);
+	std::string encoded;
+	std::vector <BYTE> decoded;
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; i++) {
+		LegacyUrlEncode(encoded, data, TOKEN_SIZE);
+		LegacyUrlDecode(decoded, encoded);
+	}
+	auto legacyNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "CryptoPP: " << legacyNanos << "ns";
+	if (iterations > 0) {
+		std::cout << ", " << ((double)legacyNanos / iterations) << "ns per round trip";
+	}
+	std::cout << std::endl;
+	char encodedToken[TOKEN_SIZE * 2];
+	size_t encodedSize = Base64Url::EncodedSize(TOKEN_SIZE);
+	BYTE decodedToken[TOKEN_SIZE];
+	Base64Path paths[] = { Base64Path::Scalar, Base64Url::GetBestPath() };
+	for (Base64Path path : paths) {
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			Base64Url::Encode(encodedToken, data, TOKEN_SIZE, path);
+			Base64Url::Decode(decodedToken, encodedToken, encodedSize, path);
+		}
+		auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		std::cout << Base64Url::GetPathName(path) << ": " << nanos << "ns";
+		if (iterations > 0) {
+			std::cout << ", " << ((double)nanos / iterations) << "ns per round trip";
+		}
+		std::cout << std::endl;
+	}
+	return true;
+}
+
+//Creates and then deletes bench_ accounts through the DB workers, once committing each signup on its own and once group committed.
+//Every account gets the same password hash so only the database work is timed. The accounts go through the real signup
+//path, so this only runs on a scratch database started with --sqlite, never the MySQL server.
+bool BenchSignupCommand(BB_Server* bbServer) {
+	if (bbServer->getDBConnectionInformation().backend != BACKEND_SQLITE) {
+		std::cout << "benchSignup only runs against a scratch database, restart with --sqlite <file>" << std::endl;
+		return true;
+	}
+	int numSignups = 0;
+	int groupCommitSize = 0;
+	std::cout << "This adds and removes employees named bench_<n> in " << bbServer->getDBConnectionInformation().database << std::endl;
+	std::cout << "Concurrent signups: ";
+	std::cin >> numSignups;
+	std::cout << "Group commit size: ";
+	std::cin >> groupCommitSize;
+	EmployeeManager* employeeManager = bbServer->getEmpManager();
+	DBExecutor* dbExecutor = bbServer->getDBExecutor();
+	PwdHash pwdHash;
+	CryptoManager::HashPwd(pwdHash, "bench");
+	int previousGroupCommitSize = dbExecutor->getStats().groupCommitSize;
+	int groupCommitSizes[] = { 1, groupCommitSize };
+	for (int run = 0; run < 2; run++) {
+		dbExecutor->setGroupCommitSize(groupCommitSizes[run]);
+		std::mutex doneMutex;
+		std::condition_variable doneCondition;
+		int done = 0;
+		int created = 0;
+		std::vector <IDType> eIDs(numSignups, 0);
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < numSignups; i++) {
+			std::string name = "bench_" + std::to_string(run) + "_" + std::to_string(i);
+			IDType* eID = &eIDs.at(i);
+			dbExecutor->submit(nullptr, [employeeManager, name, eID, pwdHash](DBManager* dbManager) {
+				DeviceID devID = 0;
+				std::string urlEncodedPwdToken;
+				if (!employeeManager->createEmployee(name, pwdHash, *eID, devID, urlEncodedPwdToken, dbManager)) {
+					*eID = 0;
+				}
+			}, [&doneMutex, &doneCondition, &done, &created, eID](DBJobStatus status) {
+				std::lock_guard<std::mutex> lock(doneMutex);
+				if (status == DBJobStatus::Completed && *eID != 0) {
+					created++;
+				}
+				done++;
+				doneCondition.notify_one();
+			}, true);
+		}
+		{
+			std::unique_lock<std::mutex> lock(doneMutex);
+			doneCondition.wait(lock, [&done, numSignups]() { return done == numSignups; });
+		}
+		auto micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "Group commit size " << groupCommitSizes[run] << ": " << created << "/" << numSignups << " signups in " << micros << "us";
+		if (micros > 0) {
+			std::cout << " (" << (created * 1000000.0 / micros) << " signups/sec)";
+		}
+		std::cout << std::endl;
+		DBLease dbLease(bbServer->getDBPool());
+		for (int i = 0; i < eIDs.size(); i++) {
+			if (eIDs.at(i) != 0) {
+				employeeManager->deleteEmployee(eIDs.at(i), dbLease.get());
+			}
+		}
+	}
+	dbExecutor->setGroupCommitSize(previousGroupCommitSize);
+	return true;
+}
+
 bool CommandHandler::StopInputCommand(BB_Server* bbServer) {
 	std::cout << "No longer accepting input" << std::endl;
 	readInput = false;
@@ -38,6 +684,30 @@ void CommandHandler::createCommands()
 	commands.emplace(std::make_pair("stopInput", (CommandFunc)std::bind(&CommandHandler::StopInputCommand, this, std::placeholders::_1)));
 	commands.emplace(std::make_pair("exit", CommandFunc(&ExitCommand)));
 	commands.emplace(std::make_pair("setLog", CommandFunc(&SetLogCommand)));
+	commands.emplace(std::make_pair("dbPool", CommandFunc(&DBPoolCommand)));
+	commands.emplace(std::make_pair("dbHealth", CommandFunc(&DBHealthCommand)));
+	commands.emplace(std::make_pair("dbReplicas", CommandFunc(&DBReplicasCommand)));
+	commands.emplace(std::make_pair("dbQueue", CommandFunc(&DBQueueCommand)));
+	commands.emplace(std::make_pair("cryptoQueue", CommandFunc(&CryptoQueueCommand)));
+	commands.emplace(std::make_pair("dbStats", CommandFunc(&DBStatsCommand)));
+	commands.emplace(std::make_pair("dbBreaker", CommandFunc(&DBBreakerCommand)));
+	commands.emplace(std::make_pair("slowQuery", CommandFunc(&SlowQueryCommand)));
+	commands.emplace(std::make_pair("directory", CommandFunc(&DirectoryCommand)));
+	commands.emplace(std::make_pair("dashboard", CommandFunc(&DashboardCommand)));
+	commands.emplace(std::make_pair("sessions", CommandFunc(&SessionsCommand)));
+	commands.emplace(std::make_pair("rateLimit", CommandFunc(&RateLimitCommand)));
+	commands.emplace(std::make_pair("setRateLimit", CommandFunc(&SetRateLimitCommand)));
+	commands.emplace(std::make_pair("setPKeyCost", CommandFunc(&SetPKeyCostCommand)));
+	commands.emplace(std::make_pair("tokenQueue", CommandFunc(&TokenQueueCommand)));
+	commands.emplace(std::make_pair("sweeper", CommandFunc(&SweeperCommand)));
+	commands.emplace(std::make_pair("sweep", CommandFunc(&SweepCommand)));
+	commands.emplace(std::make_pair("invalidateRoles", CommandFunc(&InvalidateRolesCommand)));
+	commands.emplace(std::make_pair("benchFetch", CommandFunc(&BenchFetchCommand)));
+	commands.emplace(std::make_pair("benchSignup", CommandFunc(&BenchSignupCommand)));
+	commands.emplace(std::make_pair("benchRawBind", CommandFunc(&BenchRawBindCommand)));
+	commands.emplace(std::make_pair("benchRandom", CommandFunc(&BenchRandomCommand)));
+	commands.emplace(std::make_pair("checkBase64", CommandFunc(&CheckBase64Command)));
+	commands.emplace(std::make_pair("benchBase64", CommandFunc(&BenchBase64Command)));
 }
 
 void CommandHandler::run()
@@ -0,0 +1,118 @@
+#include "CryptoExecutor.h"
+#include "BB_Client.h"
+#include <algorithm>
+#include <chrono>
+
+const char* CryptoExecutor::GetStatusMsg(CryptoJobStatus status)
+{
+	switch (status) {
+	case CryptoJobStatus::Completed:
+		return "";
+	default:
+		return "Server busy, try again";
+	}
+}
+
+int CryptoExecutor::GetDefaultNumWorkers()
+{
+	return std::max((int)std::thread::hardware_concurrency() / 2, 1);
+}
+
+CryptoExecutor::CryptoExecutor(int numWorkers, int maxQueueDepth)
+	:maxQueueDepth(maxQueueDepth), stopping(false)
+{
+	stats = CryptoExecutorStats();
+	if (numWorkers <= 0) {
+		numWorkers = 1;
+	}
+	for (int i = 0; i < numWorkers; i++) {
+		workers.push_back(std::thread(&CryptoExecutor::workerLoop, this));
+	}
+}
+
+bool CryptoExecutor::submit(BB_ClientPtr client, const CryptoTask & task, const CryptoCompletion & completion)
+{
+	CryptoJob job;
+	job.client = client;
+	job.task = task;
+	job.completion = completion;
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		if (stopping || jobs.size() >= maxQueueDepth) {
+			stats.rejected++;
+		}
+		else
+		{
+			jobs.push_back(job);
+			stats.submitted++;
+			stats.peakQueueDepth = std::max(stats.peakQueueDepth, (int)jobs.size());
+			queueCondition.notify_one();
+			return true;
+		}
+	}
+	complete(job, CryptoJobStatus::Rejected);
+	return false;
+}
+
+CryptoExecutorStats CryptoExecutor::getStats()
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+	CryptoExecutorStats executorStats = stats;
+	executorStats.numWorkers = workers.size();
+	executorStats.maxQueueDepth = maxQueueDepth;
+	executorStats.queueDepth = jobs.size();
+	return executorStats;
+}
+
+void CryptoExecutor::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		stopping = true;
+	}
+	queueCondition.notify_all();
+	for (int i = 0; i < workers.size(); i++) {
+		if (workers.at(i).joinable()) {
+			workers.at(i).join();
+		}
+	}
+}
+
+CryptoExecutor::~CryptoExecutor()
+{
+	stop();
+}
+
+void CryptoExecutor::workerLoop()
+{
+	while (true) {
+		CryptoJob job;
+		{
+			std::unique_lock<std::mutex> lock(queueMutex);
+			queueCondition.wait(lock, [this]() { return stopping || !jobs.empty(); });
+			if (jobs.empty()) {
+				return;
+			}
+			job = jobs.front();
+			jobs.pop_front();
+		}
+		auto start = std::chrono::steady_clock::now();
+		job.task();
+		uint64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+			stats.completed++;
+			stats.totalMicros += micros;
+		}
+		complete(job, CryptoJobStatus::Completed);
+	}
+}
+
+void CryptoExecutor::complete(const CryptoJob & job, CryptoJobStatus status)
+{
+	if (job.client == nullptr) {
+		job.completion(status);
+		return;
+	}
+	job.client->getStrand().post(std::bind(job.completion, status));
+}
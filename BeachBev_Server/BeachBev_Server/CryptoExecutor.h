@@ -0,0 +1,89 @@
+#pragma once
+#include "stdafx.h"
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+enum class CryptoJobStatus {
+	Completed,
+	//The queue was full so the task never ran
+	Rejected
+};
+
+typedef std::function<void()> CryptoTask;
+typedef std::function<void(CryptoJobStatus)> CryptoCompletion;
+
+struct CryptoExecutorStats {
+	int numWorkers;
+	int maxQueueDepth;
+	int queueDepth;
+	int peakQueueDepth;
+	uint64_t submitted;
+	uint64_t rejected;
+	uint64_t completed;
+	//Time spent running tasks, not counting the wait in the queue
+	uint64_t totalMicros;
+};
+
+/// <summary>
+/// Runs password hashing on its own bounded set of threads. PBKDF2 takes tens of milliseconds,
+/// on a DB worker it would hold a connection and sometimes a group commit open for all of it.
+/// Like DBExecutor each completion is posted to the submitting client's strand.
+/// </summary>
+class CryptoExecutor
+{
+public:
+	//Beyond this the oldest queued hash already waits over a second, a login burst is turned away instead
+	static const int DEFAULT_MAX_QUEUE_DEPTH = 64;
+
+	static const char* GetStatusMsg(CryptoJobStatus status);
+
+	/// <summary>
+	/// Half the cores so a burst of logins leaves the io threads and DB workers room to run
+	/// </summary>
+	static int GetDefaultNumWorkers();
+
+	CryptoExecutor(int numWorkers, int maxQueueDepth = DEFAULT_MAX_QUEUE_DEPTH);
+
+	/// <summary>
+	/// Queues task to run on a worker, completion always runs on the client's strand,
+	/// or on the worker when client is null
+	/// </summary>
+	/// <returns>False if the queue was full, completion is still posted with Rejected straight away</returns>
+	bool submit(BB_ClientPtr client, const CryptoTask& task, const CryptoCompletion& completion);
+
+	void setMaxQueueDepth(int maxQueueDepth) {
+		this->maxQueueDepth = maxQueueDepth;
+	}
+
+	CryptoExecutorStats getStats();
+
+	/// <summary>
+	/// Runs every queued task and joins the workers
+	/// </summary>
+	void stop();
+
+	~CryptoExecutor();
+
+private:
+	struct CryptoJob {
+		BB_ClientPtr client;
+		CryptoTask task;
+		CryptoCompletion completion;
+	};
+
+	void workerLoop();
+
+	void complete(const CryptoJob& job, CryptoJobStatus status);
+
+	std::deque <CryptoJob> jobs;
+	std::vector <std::thread> workers;
+	std::mutex queueMutex;
+	std::condition_variable queueCondition;
+	CryptoExecutorStats stats;
+	int maxQueueDepth;
+	bool stopping;
+};
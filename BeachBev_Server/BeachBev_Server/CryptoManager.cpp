@@ -1,14 +1,103 @@
 #include "CryptoManager.h"
 #include "DBManager.h"
+#include "Base64Url.h"
 #include <cryptopp/pwdbased.h>
 #include <cryptopp/osrng.h>
 #include <cryptopp/secblock.h>
-#include <cryptopp/base64.h>
+#include <cryptopp/misc.h>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+//Bumped in the child after a fork, a thread that sees it change reseeds so parent and child
+//never hand out the same bytes from a copied pool and buffer
+static std::atomic<uint64_t> ForkGeneration(0);
+
+#ifndef _WIN32
+static void OnFork()
+{
+	ForkGeneration++;
+}
+#endif
+
+/// <summary>
+/// A thread's generator and the bytes it has produced but not yet handed out,
+/// which sit at the end of buffer
+/// </summary>
+struct ThreadRandom {
+	CryptoPP::AutoSeededRandomPool pool;
+	BYTE buffer[CryptoManager::RANDOM_BUFFER_SIZE];
+	size_t available;
+	size_t sinceReseed;
+	uint64_t forkGeneration;
+
+	ThreadRandom()
+		:available(0), sinceReseed(0), forkGeneration(ForkGeneration)
+	{
+	}
+
+	~ThreadRandom()
+	{
+		CryptoPP::SecureWipeBuffer(buffer, sizeof(buffer));
+	}
+
+	void generate(BYTE* data, size_t size) {
+		if (forkGeneration != ForkGeneration) {
+			forkGeneration = ForkGeneration;
+			CryptoPP::SecureWipeBuffer(buffer, sizeof(buffer));
+			available = 0;
+			reseed();
+		}
+		if (size > sizeof(buffer)) {
+			generateBlock(data, size);
+			return;
+		}
+		if (size > available) {
+			//Anything left over is dropped rather than split across a refill
+			generateBlock(buffer, sizeof(buffer));
+			available = sizeof(buffer);
+		}
+		BYTE* next = buffer + sizeof(buffer) - available;
+		std::copy(next, next + size, data);
+		CryptoPP::SecureWipeBuffer(next, size);
+		available -= size;
+	}
+
+private:
+	void generateBlock(BYTE* data, size_t size) {
+		if (sinceReseed >= CryptoManager::RANDOM_RESEED_BYTES) {
+			reseed();
+		}
+		pool.GenerateBlock(data, size);
+		sinceReseed += size;
+	}
+
+	void reseed() {
+		pool.Reseed();
+		sinceReseed = 0;
+	}
+};
 
 void CryptoManager::GenerateHash(BYTE * hash, uint32_t hashSize, const BYTE * data, size_t dataSize, const BYTE * salt, uint32_t saltSize)
 {
 	CryptoPP::PKCS5_PBKDF2_HMAC <CryptoPP::SHA256> pbkdf2;
-	pbkdf2.DeriveKey(hash, hashSize, 0, data, dataSize, salt, saltSize, 80020);
+	pbkdf2.DeriveKey(hash, hashSize, 0, data, dataSize, salt, saltSize, PWD_ITERATIONS);
+}
+
+void CryptoManager::HashPwd(PwdHash & pwdHash, const std::string & pwd)
+{
+	GenerateRandomData(pwdHash.salt, SALT_SIZE);
+	GenerateHash(pwdHash.hash, HASH_SIZE, (const BYTE*)pwd.data(), pwd.size(), pwdHash.salt, SALT_SIZE);
+}
+
+bool CryptoManager::VerifyPwd(const std::string & pwd, const BYTE * hash, const BYTE * salt)
+{
+	BYTE pwdHash[HASH_SIZE];
+	GenerateHash(pwdHash, HASH_SIZE, (const BYTE*)pwd.data(), pwd.size(), salt, SALT_SIZE);
+	return CryptoPP::VerifyBufsEqual(pwdHash, hash, HASH_SIZE);
 }
 
 void CryptoManager::GenerateHash(BYTE * hash, uint32_t hashSize, const BYTE * data, size_t dataSize)
@@ -30,49 +119,36 @@ void CryptoManager::GenerateHash(BYTE * hash, uint32_t hashSize, const BYTE * da
 
 void CryptoManager::GenerateRandomData(BYTE * rngData, uint32_t rngDataSize)
 {
-	CryptoPP::AutoSeededRandomPool rng;
-	rng.GenerateBlock(rngData, rngDataSize);
+#ifndef _WIN32
+	static std::once_flag forkHandlerFlag;
+	std::call_once(forkHandlerFlag, []() {
+		pthread_atfork(nullptr, nullptr, &OnFork);
+	});
+#endif
+	static thread_local ThreadRandom threadRandom;
+	threadRandom.generate(rngData, rngDataSize);
 }
 
 void CryptoManager::UrlEncode(std::string & encoded, const BYTE * data, uint32_t dataSize)
 {
-	CryptoPP::Base64URLEncoder encoder;
-	encoder.Put(data, dataSize);
-	encoder.MessageEnd();
-	CryptoPP::word64 size = encoder.MaxRetrievable();
-	if (size) {
-		encoded.resize(size);
-		encoder.Get((byte*)encoded.data(), encoded.size());
-	}
+	encoded.resize(Base64Url::EncodedSize(dataSize));
+	Base64Url::Encode(&encoded[0], data, dataSize);
 }
 
 void CryptoManager::UrlDecode(std::vector <BYTE>& decoded, const std::string& encoded)
 {
-	CryptoPP::Base64URLDecoder decoder;
-	decoder.Put((byte*)encoded.data(), encoded.size());
-	decoder.MessageEnd();
-	CryptoPP::word64 size = decoder.MaxRetrievable();
-	if (size) {
-		decoded.resize(size);
-		decoder.Get((byte*)decoded.data(), decoded.size());
+	decoded.resize(Base64Url::DecodedSize(encoded.data(), encoded.size()));
+	if (!Base64Url::Decode(decoded.data(), encoded.data(), encoded.size())) {
+		decoded.clear();
 	}
 }
 
-void CryptoManager::OutputBytes(otl_stream & stream, BYTE * data, uint16_t size)
+bool CryptoManager::UrlDecode(BYTE * decoded, size_t & decodedSize, size_t maxSize, const std::string & encoded)
 {
-	otl_long_string otlStr(size);
-	for (int i = 0; i < size; i++) {
-		otlStr[i] = data[i];
+	decodedSize = Base64Url::DecodedSize(encoded.data(), encoded.size());
+	if (decodedSize > maxSize || !Base64Url::Decode(decoded, encoded.data(), encoded.size())) {
+		decodedSize = 0;
+		return false;
 	}
-	otlStr.set_len(size);
-	stream << otlStr;
+	return true;
 }
-
-void CryptoManager::InputBytes(otl_stream & stream, BYTE * data, uint16_t size)
-{
-	otl_long_string otlStr(size);
-	stream >> otlStr;
-	for (int i = 0; i < size; i++) {
-		data[i] = otlStr[i];
-	}
-}
\ No newline at end of file
@@ -5,22 +5,52 @@
 #include <vector>
 #include "DBManager.h"
 
-typedef unsigned char BYTE;
+/// <summary>
+/// A password as the Employees table stores it
+/// </summary>
+struct PwdHash {
+	BYTE hash[HASH_SIZE];
+	BYTE salt[SALT_SIZE];
+};
 
 class CryptoManager
 {
 public:
+	//PBKDF2 rounds, each hash takes tens of milliseconds so run it on the CryptoExecutor
+	static const int PWD_ITERATIONS = 80020;
+	//Random bytes each thread generates ahead and serves small requests from
+	static const int RANDOM_BUFFER_SIZE = 4096;
+	//Bytes a thread's generator produces before it mixes in fresh OS entropy
+	static const int RANDOM_RESEED_BYTES = 1 << 20;
+
 	static void GenerateHash(BYTE* hash, uint32_t hashSize, const BYTE* data, size_t dataSize, const BYTE* salt, uint32_t saltSize);
 
 	static void GenerateHash(BYTE * hash, uint32_t hashSize, const BYTE * data, size_t dataSize);
 
+	/// <summary>
+	/// Hashes pwd with a new random salt
+	/// </summary>
+	static void HashPwd(PwdHash& pwdHash, const std::string& pwd);
+
+	/// <summary>
+	/// True if pwd hashed with salt gives hash, compared in constant time
+	/// </summary>
+	static bool VerifyPwd(const std::string& pwd, const BYTE* hash, const BYTE* salt);
+
+	/// <summary>
+	/// Fills rngData from the calling thread's generator. Each thread seeds its own pool from the OS
+	/// once, reseeds it every RANDOM_RESEED_BYTES and after a fork, and hands out bytes from a buffer
+	/// it refills RANDOM_BUFFER_SIZE at a time. Bytes are wiped from the buffer as they are handed out.
+	/// </summary>
 	static void GenerateRandomData(BYTE* rngData, uint32_t rngDataSize);
 
 	static void UrlEncode(std::string& encoded, const BYTE* data, uint32_t dataSize);
 
 	static void UrlDecode(std::vector <BYTE>& decoded, const std::string& encoded);
 
-	static void OutputBytes(otl_stream& stream, BYTE* data, uint16_t size);
-
-	static void InputBytes(otl_stream& stream, BYTE* data, uint16_t size);
+	/// <summary>
+	/// Decodes into a caller buffer of maxSize bytes, for tokens that fit on the stack
+	/// </summary>
+	/// <returns>False and decodedSize 0 if encoded is not base64url or decodes to more than maxSize</returns>
+	static bool UrlDecode(BYTE* decoded, size_t& decodedSize, size_t maxSize, const std::string& encoded);
 };
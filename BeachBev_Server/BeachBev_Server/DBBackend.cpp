@@ -0,0 +1,13 @@
+#include "DBBackend.h"
+#include "MySQLBackend.h"
+#include "SQLiteBackend.h"
+
+const DBBackend * DBBackend::Get(DBBackendType backendType)
+{
+	static const MySQLBackend MySQL;
+	static const SQLiteBackend SQLite;
+	if (backendType == BACKEND_SQLITE) {
+		return &SQLite;
+	}
+	return &MySQL;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "stdafx.h"
+#include "DBStatements.h"
+#include <string>
+
+struct ConnectionInformation;
+
+/// <summary>
+/// What differs between the databases the server can run on: how to reach them, the SQL dialect
+/// of each statement, which errors mean the connection is gone and whether the schema has to be
+/// created by the server. Handlers only see StatementIDs and StatementStreams so they run unchanged on any backend.
+/// </summary>
+class DBBackend
+{
+public:
+	static const DBBackend* Get(DBBackendType backendType);
+
+	virtual DBBackendType getType() const = 0;
+
+	virtual const char* getName() const = 0;
+
+	virtual std::string makeConnectStr(const ConnectionInformation& connectionInfo) const = 0;
+
+	virtual bool isConnectionLost(const otl_exception& ex) const = 0;
+
+	/// <summary>
+	/// False when there is no such thing as a replica, replicaServers are ignored in that case
+	/// </summary>
+	virtual bool supportsReplicas() const = 0;
+
+	/// <summary>
+	/// True if connections run in autocommit mode outside of transactions rather than
+	/// leaving a transaction open after reads
+	/// </summary>
+	virtual bool autoCommits() const = 0;
+
+	/// <summary>
+	/// Creates every table the statements use if it does not exist yet
+	/// </summary>
+	/// <returns>False if a table could not be created</returns>
+	virtual bool createSchema(otl_connect& connection) const = 0;
+
+	/// <summary>
+	/// Adds a non-unique index, doing nothing if one with that name is already on the table
+	/// </summary>
+	virtual bool createIndex(otl_connect& connection, const std::string& indexName, const std::string& table, const std::string& columns) const = 0;
+
+	const StatementDef& getStatementDef(StatementID statementID) const {
+		return GetStatementDef(statementID, getType());
+	}
+
+	virtual ~DBBackend() {}
+};
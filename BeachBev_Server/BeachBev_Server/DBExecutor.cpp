@@ -0,0 +1,195 @@
+#include "DBExecutor.h"
+#include "BB_Client.h"
+#include <algorithm>
+
+const char* DBExecutor::GetStatusMsg(DBJobStatus status)
+{
+	switch (status) {
+	case DBJobStatus::Completed:
+		return "";
+	case DBJobStatus::Rejected:
+		return "Server busy, try again";
+	case DBJobStatus::Degraded:
+		return "Service degraded, try again shortly";
+	default:
+		return "Database error";
+	}
+}
+
+DBExecutor::DBExecutor(DBPool * dbPool, int numWorkers, int maxQueueDepth)
+	:dbPool(dbPool), circuitBreaker(dbPool->getCircuitBreaker()), maxQueueDepth(maxQueueDepth), groupCommitSize(1), stopping(false)
+{
+	stats = DBExecutorStats();
+	if (numWorkers <= 0) {
+		numWorkers = 1;
+	}
+	for (int i = 0; i < numWorkers; i++) {
+		workers.push_back(std::thread(&DBExecutor::workerLoop, this));
+	}
+}
+
+bool DBExecutor::submit(BB_ClientPtr client, const DBQuery & query, const DBCompletion & completion, bool writes)
+{
+	DBJob job;
+	job.client = client;
+	job.query = query;
+	job.completion = completion;
+	job.writes = writes;
+	if (circuitBreaker->isOpen()) {
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+			stats.degraded++;
+		}
+		complete(job, DBJobStatus::Degraded);
+		return false;
+	}
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		if (stopping || jobs.size() >= maxQueueDepth) {
+			stats.rejected++;
+		}
+		else
+		{
+			jobs.push_back(job);
+			stats.submitted++;
+			stats.peakQueueDepth = std::max(stats.peakQueueDepth, (int)jobs.size());
+			queueCondition.notify_one();
+			return true;
+		}
+	}
+	complete(job, DBJobStatus::Rejected);
+	return false;
+}
+
+DBExecutorStats DBExecutor::getStats()
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+	DBExecutorStats executorStats = stats;
+	executorStats.numWorkers = workers.size();
+	executorStats.maxQueueDepth = maxQueueDepth;
+	executorStats.queueDepth = jobs.size();
+	executorStats.groupCommitSize = groupCommitSize;
+	return executorStats;
+}
+
+void DBExecutor::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		stopping = true;
+	}
+	queueCondition.notify_all();
+	for (int i = 0; i < workers.size(); i++) {
+		if (workers.at(i).joinable()) {
+			workers.at(i).join();
+		}
+	}
+}
+
+DBExecutor::~DBExecutor()
+{
+	stop();
+}
+
+void DBExecutor::workerLoop()
+{
+	while (true) {
+		std::vector <DBJob> batch;
+		{
+			std::unique_lock<std::mutex> lock(queueMutex);
+			queueCondition.wait(lock, [this]() { return stopping || !jobs.empty(); });
+			if (jobs.empty()) {
+				return;
+			}
+			batch.push_back(jobs.front());
+			jobs.pop_front();
+			//Only a run of write jobs at the front is taken, so no job is reordered past a read
+			if (batch.front().writes) {
+				while (batch.size() < groupCommitSize && !jobs.empty() && jobs.front().writes) {
+					batch.push_back(jobs.front());
+					jobs.pop_front();
+				}
+			}
+		}
+		//Jobs queued before the breaker opened are turned away here too. The trial itself is claimed
+		//by the job's first statement in DBManager, so a due trial still gets through.
+		if (circuitBreaker->isOpen()) {
+			{
+				std::lock_guard<std::mutex> lock(queueMutex);
+				stats.degraded += batch.size();
+			}
+			for (int i = 0; i < batch.size(); i++) {
+				complete(batch.at(i), DBJobStatus::Degraded);
+			}
+			continue;
+		}
+		std::vector <DBJobStatus> statuses(batch.size(), DBJobStatus::Completed);
+		try {
+			DBLease dbLease(dbPool);
+			if (batch.size() == 1) {
+				batch.front().query(dbLease.get());
+			}
+			else
+			{
+				statuses = runGroup(batch, dbLease.get());
+			}
+		}
+		catch (std::exception& ex)
+		{
+			std::cerr << "DBExecutor query failed: " << ex.what() << std::endl;
+			statuses.assign(batch.size(), DBJobStatus::Failed);
+		}
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+			stats.completed += batch.size();
+			if (batch.size() > 1) {
+				stats.groupCommits++;
+				stats.groupedJobs += batch.size();
+			}
+		}
+		for (int i = 0; i < batch.size(); i++) {
+			complete(batch.at(i), statuses.at(i));
+		}
+	}
+}
+
+std::vector<DBJobStatus> DBExecutor::runGroup(const std::vector<DBJob>& batch, DBManager * dbManager)
+{
+	std::vector <DBJobStatus> statuses(batch.size(), DBJobStatus::Completed);
+	DBTransaction groupTransaction(dbManager);
+	if (!groupTransaction.isActive()) {
+		statuses.assign(batch.size(), DBJobStatus::Failed);
+		return statuses;
+	}
+	for (int i = 0; i < batch.size(); i++) {
+		DBTransaction jobTransaction(dbManager);
+		if (!jobTransaction.isActive()) {
+			statuses.at(i) = DBJobStatus::Failed;
+			continue;
+		}
+		try {
+			batch.at(i).query(dbManager);
+		}
+		catch (std::exception& ex)
+		{
+			std::cerr << "DBExecutor query failed: " << ex.what() << std::endl;
+			statuses.at(i) = DBJobStatus::Failed;
+			continue;
+		}
+		//A job reports its own statement failures, only a broken scope fails it here
+		jobTransaction.commit();
+	}
+	if (!groupTransaction.commit()) {
+		statuses.assign(batch.size(), DBJobStatus::Failed);
+	}
+	return statuses;
+}
+
+void DBExecutor::complete(const DBJob & job, DBJobStatus status)
+{
+	if (job.client == nullptr) {
+		job.completion(status);
+		return;
+	}
+	job.client->getStrand().post(std::bind(job.completion, status));
+}
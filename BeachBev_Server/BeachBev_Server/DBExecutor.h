@@ -0,0 +1,116 @@
+#pragma once
+#include "stdafx.h"
+#include "DBPool.h"
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <algorithm>
+
+enum class DBJobStatus {
+	Completed,
+	//The queue was full so the query never ran
+	Rejected,
+	//The query threw something other than an otl_exception
+	Failed,
+	//The database is unreachable and the circuit breaker is open, so the query never ran
+	Degraded
+};
+
+typedef std::function<void(DBManager*)> DBQuery;
+typedef std::function<void(DBJobStatus)> DBCompletion;
+
+struct DBExecutorStats {
+	int numWorkers;
+	int maxQueueDepth;
+	int queueDepth;
+	int peakQueueDepth;
+	uint64_t submitted;
+	uint64_t rejected;
+	//Jobs turned away without running because the circuit breaker was open
+	uint64_t degraded;
+	uint64_t completed;
+	//Size the worker batches consecutive write jobs to, 1 when group commit is off
+	int groupCommitSize;
+	//Batches of more than one write job committed together
+	uint64_t groupCommits;
+	uint64_t groupedJobs;
+};
+
+/// <summary>
+/// Runs blocking database work on its own worker threads so the io threads only
+/// parse packets and write frames. Each query runs with a DBManager leased from
+/// the pool and its completion is posted to the submitting client's strand.
+/// </summary>
+class DBExecutor
+{
+public:
+	static const int DEFAULT_MAX_QUEUE_DEPTH = 512;
+
+	static const char* GetStatusMsg(DBJobStatus status);
+
+	DBExecutor(DBPool* dbPool, int numWorkers, int maxQueueDepth = DEFAULT_MAX_QUEUE_DEPTH);
+
+	/// <summary>
+	/// Queues query to run on a worker, completion always runs on the client's strand,
+	/// or on the worker when client is null
+	/// </summary>
+	/// <param name="writes">True for queries that only write inside their own transactions,
+	/// these may be group committed with other queued write jobs</param>
+	/// <returns>False if the queue was full or the circuit breaker is open, completion is still
+	/// posted with Rejected or Degraded straight away</returns>
+	bool submit(BB_ClientPtr client, const DBQuery& query, const DBCompletion& completion, bool writes = false);
+
+	void setMaxQueueDepth(int maxQueueDepth) {
+		this->maxQueueDepth = maxQueueDepth;
+	}
+
+	/// <summary>
+	/// Lets a worker run up to groupCommitSize queued write jobs in one transaction on one
+	/// connection, each in its own savepoint, so they share a single commit. 1 turns it off.
+	/// </summary>
+	void setGroupCommitSize(int groupCommitSize) {
+		this->groupCommitSize = std::max(groupCommitSize, 1);
+	}
+
+	DBExecutorStats getStats();
+
+	/// <summary>
+	/// Runs every queued job and joins the workers
+	/// </summary>
+	void stop();
+
+	~DBExecutor();
+
+private:
+	struct DBJob {
+		BB_ClientPtr client;
+		DBQuery query;
+		DBCompletion completion;
+		bool writes;
+	};
+
+	void workerLoop();
+
+	/// <summary>
+	/// Runs every job in batch in one outer transaction, a job whose own scope fails is rolled
+	/// back to its savepoint without affecting the rest
+	/// </summary>
+	std::vector<DBJobStatus> runGroup(const std::vector<DBJob>& batch, DBManager* dbManager);
+
+	void complete(const DBJob& job, DBJobStatus status);
+
+	DBPool* dbPool;
+	CircuitBreaker* circuitBreaker;
+	std::deque <DBJob> jobs;
+	std::vector <std::thread> workers;
+	std::mutex queueMutex;
+	std::condition_variable queueCondition;
+	DBExecutorStats stats;
+	int maxQueueDepth;
+	std::atomic<int> groupCommitSize;
+	bool stopping;
+};
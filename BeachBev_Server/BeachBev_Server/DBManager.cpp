@@ -2,12 +2,16 @@
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <Logger.h>
+#include <algorithm>
+#include <cstring>
 
 typedef boost::archive::text_oarchive ArchiveOut;
 typedef boost::archive::text_iarchive ArchiveIn;
 
 const std::string ConnectionInformation::UNUSED_INFO = "i";
 
+std::atomic<int> DBManager::SlowQueryMillis(DBManager::DEFAULT_SLOW_QUERY_MILLIS);
+
 ConnectionInformation::ConnectionInformation()
 {
 	dsn = UNUSED_INFO;
@@ -16,6 +20,7 @@ ConnectionInformation::ConnectionInformation()
 	uid = UNUSED_INFO;
 	pwd = UNUSED_INFO;
 	database = UNUSED_INFO;
+	backend = BACKEND_MYSQL;
 }
 
 ConnectionInformation::ConnectionInformation(const std::string & filePath)
@@ -26,9 +31,18 @@ ConnectionInformation::ConnectionInformation(const std::string & filePath)
 	uid = UNUSED_INFO;
 	pwd = UNUSED_INFO;
 	database = UNUSED_INFO;
+	backend = BACKEND_MYSQL;
 	loadFromFile(filePath);
 }
 
+ConnectionInformation ConnectionInformation::getReplicaInfo(int replicaIndex) const
+{
+	ConnectionInformation replicaInfo = *this;
+	replicaInfo.server = replicaServers.at(replicaIndex);
+	replicaInfo.replicaServers.clear();
+	return replicaInfo;
+}
+
 bool ConnectionInformation::loadFromFile(const std::string & filePath)
 {
 	std::ifstream fileIn(filePath);
@@ -65,73 +79,535 @@ bool ConnectionInformation::saveToFile(const std::string & filePath)
 }
 
 DBManager::DBManager()
-	:dbConnection(nullptr)
+	:dbConnection(nullptr), backend(DBBackend::Get(BACKEND_MYSQL)), statementCache(NUM_STATEMENTS, nullptr), latencies(NUM_STATEMENTS), statementCacheHits(0), statementCacheMisses(0),
+	replica(nullptr), circuitBreaker(nullptr), primaryPinned(false), transactionLost(false), commits(0)
 {
+	health = DBHealth();
+	health.replicationLagSeconds = -1;
 }
 
 bool DBManager::connect(const ConnectionInformation& connectionInfo)
 {
-	std::string connectStr;
-	if (connectionInfo.dsn != ConnectionInformation::UNUSED_INFO)
+	backend = DBBackend::Get(connectionInfo.backend);
+	return connect(backend->makeConnectStr(connectionInfo));
+}
+
+bool DBManager::createSchema()
+{
+	if (!isConnected() && !reconnect()) {
+		return false;
+	}
+	return backend->createSchema(*dbConnection);
+}
+
+bool DBManager::connect(const std::string & connectStr)
+{
+	Logger::Log(LOG_LEVEL::DebugHigh, "Connecting to database with connectStr of: " + connectStr);
+	this->connectStr = connectStr;
+	clearStatementCache();
+	if (dbConnection != nullptr) {
+		delete dbConnection;
+	}
+	dbConnection = new otl_connect();
+	try
+	{
+		dbConnection->rlogon(connectStr.c_str(), backend->autoCommits() ? 1 : 0);
+	}
+	catch (otl_exception& ex)
 	{
-		connectStr += "DSN=";
-		connectStr += connectionInfo.dsn;
-		connectStr += "; ";
+		std::cerr << ex.msg << std::endl;
+		std::cerr << ex.code << std::endl;
+		std::cerr << ex.var_info << std::endl;
+		std::lock_guard<std::mutex> lock(healthMutex);
+		health.connected = false;
+		health.backoffMillis = (health.failedAttempts == 0) ? MIN_BACKOFF_MILLIS : std::min(health.backoffMillis * 2, MAX_BACKOFF_MILLIS);
+		health.failedAttempts++;
+		nextReconnectTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(health.backoffMillis);
+		return false;
+	}
+	std::lock_guard<std::mutex> lock(healthMutex);
+	health.connected = true;
+	health.failedAttempts = 0;
+	health.backoffMillis = 0;
+	return true;
+}
+
+bool DBManager::setReplica(const ConnectionInformation & replicaInfo)
+{
+	if (replica != nullptr) {
+		delete replica;
+	}
+	replica = new DBManager();
+	if (!replica->connect(replicaInfo)) {
+		return false;
+	}
+	return replica->checkReplicationLag();
+}
+
+bool DBManager::execute(StatementID statementID, const StatementFunc & func)
+{
+	StatementAccess access = backend->getStatementDef(statementID).access;
+	if (access == ACCESS_WRITE) {
+		primaryPinned = true;
+	}
+	else if (access == ACCESS_READ && replica != nullptr && !primaryPinned) {
+		if (isReplicaUsable() && replica->executeLocal(statementID, func)) {
+			return true;
+		}
+		std::lock_guard<std::mutex> lock(healthMutex);
+		health.replicaFallbacks++;
+	}
+	return executeLocal(statementID, func);
+}
+
+bool DBManager::executeLocal(StatementID statementID, const StatementFunc & func)
+{
+	//Checked here rather than by each caller so background work on a lease fails fast during an outage too
+	if (circuitBreaker != nullptr && !circuitBreaker->allowRequest()) {
+		if (inTransaction()) {
+			scopeFailed.back() = true;
+		}
+		return false;
+	}
+	if (inTransaction()) {
+		if (transactionLost) {
+			scopeFailed.back() = true;
+			return false;
+		}
+	}
+	else if (!isConnected() && !reconnectReported()) {
+		return false;
 	}
-	if (connectionInfo.driver != ConnectionInformation::UNUSED_INFO)
 	{
-		connectStr += "Driver={";
-		connectStr += connectionInfo.driver;
-		connectStr += "}; ";
+		std::lock_guard<std::mutex> lock(healthMutex);
+		health.statements++;
+	}
+	//Covers preparing, every fetch func makes and a retry after a reconnect, which is what the caller waited for
+	auto start = std::chrono::steady_clock::now();
+	bool success = runStatement(statementID, func);
+	recordLatency(statementID, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count(), success);
+	if (circuitBreaker != nullptr) {
+		//A statement that failed on a live connection still got an answer from the server
+		if (success || isConnected()) {
+			circuitBreaker->recordSuccess();
+		}
+		else
+		{
+			circuitBreaker->recordFailure();
+		}
+	}
+	return success;
+}
+
+bool DBManager::runStatement(StatementID statementID, const StatementFunc & func)
+{
+	for (int attempt = 0; attempt < 2; attempt++) {
+		try {
+			otl_stream& otlStream = getStream(statementID);
+			//Cached streams are shared by both modes, so the commit mode is set on every run
+			otlStream.set_commit(inTransaction() ? 0 : 1);
+			func(otlStream);
+			//Sends any rows still sitting in an array-bound write buffer, no-op for selects
+			otlStream.flush();
+			return true;
+		}
+		catch (otl_exception ex)
+		{
+			std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+			std::cerr << "Statement: " << backend->getStatementDef(statementID).name << std::endl;
+			evictStream(statementID);
+			if (inTransaction()) {
+				scopeFailed.back() = true;
+				if (backend->isConnectionLost(ex)) {
+					transactionLost = true;
+					std::lock_guard<std::mutex> lock(healthMutex);
+					health.connected = false;
+					health.lostConnections++;
+				}
+				return false;
+			}
+			if (attempt > 0 || !backend->isConnectionLost(ex)) {
+				return false;
+			}
+			{
+				std::lock_guard<std::mutex> lock(healthMutex);
+				health.connected = false;
+				health.lostConnections++;
+			}
+			if (!reconnect()) {
+				return false;
+			}
+			std::lock_guard<std::mutex> lock(healthMutex);
+			health.retries++;
+		}
+	}
+	return false;
+}
+
+bool DBManager::beginTransaction()
+{
+	if (!inTransaction()) {
+		//Reconnecting would block until the driver times out
+		if (!isConnected() && circuitBreaker != nullptr && circuitBreaker->isOpen()) {
+			return false;
+		}
+		if (!isConnected() && !reconnectReported()) {
+			return false;
+		}
+		if (backend->autoCommits()) {
+			try {
+				dbConnection->auto_commit_off();
+			}
+			catch (otl_exception ex)
+			{
+				std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+				return false;
+			}
+		}
+		transactionLost = false;
+		//Reads in a transaction have to see its uncommitted writes
+		primaryPinned = true;
 	}
-	if (connectionInfo.server != ConnectionInformation::UNUSED_INFO)
+	else if (!transactionLost)
 	{
-		connectStr += "Server=";
-		connectStr += connectionInfo.server;
-		connectStr += "; ";
+		try {
+			dbConnection->direct_exec(("SAVEPOINT sp" + std::to_string(scopeFailed.size())).c_str());
+		}
+		catch (otl_exception ex)
+		{
+			std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+			return false;
+		}
+	}
+	scopeFailed.push_back(false);
+	scopeHookStart.push_back(afterCommitHooks.size());
+	return true;
+}
+
+bool DBManager::commitTransaction()
+{
+	if (!inTransaction()) {
+		return false;
+	}
+	if (scopeFailed.back() || transactionLost) {
+		rollbackTransaction();
+		return false;
+	}
+	if (scopeFailed.size() > 1) {
+		try {
+			dbConnection->direct_exec(("RELEASE SAVEPOINT sp" + std::to_string(scopeFailed.size() - 1)).c_str());
+		}
+		catch (otl_exception ex)
+		{
+			std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+			rollbackTransaction();
+			return false;
+		}
+		//Hooks stay queued until the outermost scope commits
+		scopeFailed.pop_back();
+		scopeHookStart.pop_back();
+		return true;
+	}
+	return endTransaction(true);
+}
+
+void DBManager::rollbackTransaction()
+{
+	if (!inTransaction()) {
+		return;
+	}
+	if (scopeFailed.size() == 1) {
+		endTransaction(false);
+		return;
+	}
+	if (!transactionLost) {
+		try {
+			dbConnection->direct_exec(("ROLLBACK TO SAVEPOINT sp" + std::to_string(scopeFailed.size() - 1)).c_str());
+		}
+		catch (otl_exception ex)
+		{
+			std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+			//The outer scope can no longer tell what survived
+			scopeFailed.at(scopeFailed.size() - 2) = true;
+		}
+	}
+	afterCommitHooks.resize(scopeHookStart.back());
+	scopeFailed.pop_back();
+	scopeHookStart.pop_back();
+}
+
+bool DBManager::endTransaction(bool commit)
+{
+	bool success = false;
+	if (!transactionLost) {
+		try {
+			if (commit) {
+				dbConnection->commit();
+				commits++;
+				success = true;
+			}
+			else
+			{
+				dbConnection->rollback();
+			}
+		}
+		catch (otl_exception ex)
+		{
+			std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+			if (backend->isConnectionLost(ex)) {
+				std::lock_guard<std::mutex> lock(healthMutex);
+				health.connected = false;
+				health.lostConnections++;
+			}
+			if (commit) {
+				try {
+					dbConnection->rollback();
+				}
+				catch (otl_exception ex)
+				{
+				}
+			}
+		}
+		if (backend->autoCommits()) {
+			try {
+				dbConnection->auto_commit_on();
+			}
+			catch (otl_exception ex)
+			{
+				std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+			}
+		}
+	}
+	std::vector <std::function<void()>> hooks;
+	hooks.swap(afterCommitHooks);
+	scopeFailed.clear();
+	scopeHookStart.clear();
+	transactionLost = false;
+	if (success) {
+		for (int i = 0; i < hooks.size(); i++) {
+			hooks.at(i)();
+		}
+	}
+	return success;
+}
+
+void DBManager::afterCommit(const std::function<void()>& hook)
+{
+	if (inTransaction()) {
+		afterCommitHooks.push_back(hook);
 	}
-	if (connectionInfo.uid != ConnectionInformation::UNUSED_INFO)
+	else
 	{
-		connectStr += "UID=";
-		connectStr += connectionInfo.uid;
-		connectStr += "; ";
+		hook();
 	}
-	if (connectionInfo.pwd != ConnectionInformation::UNUSED_INFO)
+}
+
+bool DBManager::probe()
+{
+	bool success = execute<STMT_PING>([](StatementStream<STMT_PING>& stmt) {
+		int one;
+		stmt.fetch(one);
+	});
 	{
-		connectStr += "PWD=";
-		connectStr += connectionInfo.pwd;
-		connectStr += "; ";
+		std::lock_guard<std::mutex> lock(healthMutex);
+		health.probes++;
+		if (!success) {
+			health.failedProbes++;
+		}
+		health.lastProbeTime = std::time(NULL);
+	}
+	if (replica != nullptr) {
+		replica->probe();
+		replica->checkReplicationLag();
 	}
-	if (connectionInfo.database != ConnectionInformation::UNUSED_INFO)
+	return success;
+}
+
+bool DBManager::checkReplicationLag()
+{
+	lastLagCheck = std::chrono::steady_clock::now();
+	if (!isConnected() && !reconnect()) {
+		return false;
+	}
+	int lagSeconds = 0;
+	try {
+		otl_stream otlStream;
+		//Status columns are read by name, so read every one of them as a string
+		otlStream.set_all_column_types(otl_all_num2str | otl_all_date2str);
+		otlStream.open(1, "SHOW SLAVE STATUS", *dbConnection);
+		int descLen = 0;
+		otl_column_desc* columnDescs = otlStream.describe_select(descLen);
+		if (!otlStream.eof()) {
+			for (int i = 0; i < descLen; i++) {
+				std::string value;
+				otlStream >> value;
+				if (std::strcmp(columnDescs[i].name, "Seconds_Behind_Master") == 0) {
+					lagSeconds = otlStream.is_null() ? -1 : std::atoi(value.c_str());
+				}
+			}
+		}
+	}
+	catch (otl_exception ex)
 	{
-		connectStr += "Database=";
-		connectStr += connectionInfo.database;
-		connectStr += "; ";
+		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+		lagSeconds = -1;
+		if (backend->isConnectionLost(ex)) {
+			std::lock_guard<std::mutex> lock(healthMutex);
+			health.connected = false;
+			health.lostConnections++;
+		}
 	}
-	connectStr += '\0';
-	return connect(connectStr);
+	std::lock_guard<std::mutex> lock(healthMutex);
+	health.replicationLagSeconds = lagSeconds;
+	return lagSeconds >= 0;
 }
 
-bool DBManager::connect(const std::string & connectStr)
+bool DBManager::isReplicaUsable()
 {
-	Logger::Log(LOG_LEVEL::DebugHigh, "Connecting to database with connectStr of: " + connectStr);
-	dbConnection = new otl_connect();
-	try
+	if (std::chrono::steady_clock::now() - replica->lastLagCheck > std::chrono::seconds(LAG_CHECK_INTERVAL_SECONDS)) {
+		replica->checkReplicationLag();
+	}
+	if (!replica->isConnected()) {
+		return false;
+	}
+	DBHealth replicaHealth = replica->getHealth();
+	return replicaHealth.replicationLagSeconds >= 0 && replicaHealth.replicationLagSeconds <= MAX_REPLICA_LAG_SECONDS;
+}
+
+bool DBManager::isConnected()
+{
+	std::lock_guard<std::mutex> lock(healthMutex);
+	return health.connected;
+}
+
+DBHealth DBManager::getHealth()
+{
+	std::lock_guard<std::mutex> lock(healthMutex);
+	return health;
+}
+
+std::vector<LatencySnapshot> DBManager::getLatencies()
+{
+	std::vector <LatencySnapshot> snapshots;
+	snapshots.reserve(latencies.size());
+	for (int i = 0; i < latencies.size(); i++) {
+		snapshots.push_back(latencies.at(i).getSnapshot());
+	}
+	return snapshots;
+}
+
+void DBManager::recordLatency(StatementID statementID, uint64_t micros, bool success)
+{
+	latencies.at(statementID).record(micros);
+	int slowQueryMillis = SlowQueryMillis;
+	if (micros < (uint64_t)slowQueryMillis * 1000) {
+		return;
+	}
 	{
-		dbConnection->rlogon(connectStr.c_str());
+		std::lock_guard<std::mutex> lock(healthMutex);
+		health.slowQueries++;
+	}
+	//Only the query text is logged, bind values stay in the stream since they include hashes, tokens and emails
+	const StatementDef& statementDef = backend->getStatementDef(statementID);
+	std::cerr << "Slow query: " << statementDef.name << " took " << (micros / 1000) << "ms"
+		<< (success ? "" : " and failed") << (inTransaction() ? " in a transaction" : "") << std::endl;
+	std::cerr << "\t" << statementDef.query << std::endl;
+}
+
+bool DBManager::reconnect(bool* attempted)
+{
+	if (attempted != nullptr) {
+		*attempted = false;
 	}
-	catch (otl_exception& ex)
 	{
-		std::cerr << ex.msg << std::endl;
-		std::cerr << ex.code << std::endl;
-		std::cerr << ex.var_info << std::endl;
+		std::lock_guard<std::mutex> lock(healthMutex);
+		if (health.failedAttempts > 0 && std::chrono::steady_clock::now() < nextReconnectTime) {
+			return false;
+		}
+	}
+	if (attempted != nullptr) {
+		*attempted = true;
+	}
+	if (!connect(connectStr)) {
 		return false;
 	}
+	std::lock_guard<std::mutex> lock(healthMutex);
+	health.reconnects++;
 	return true;
 }
 
+bool DBManager::reconnectReported()
+{
+	bool attempted = false;
+	if (reconnect(&attempted)) {
+		return true;
+	}
+	if (circuitBreaker != nullptr) {
+		if (attempted) {
+			circuitBreaker->recordFailure();
+		}
+		else
+		{
+			circuitBreaker->releaseTrial();
+		}
+	}
+	return false;
+}
+
+void DBManager::clearStatementCache()
+{
+	for (int i = 0; i < statementCache.size(); i++) {
+		evictStream((StatementID)i);
+	}
+}
+
+otl_stream & DBManager::getStream(StatementID statementID)
+{
+	otl_stream* otlStream = statementCache.at(statementID);
+	const StatementDef& statementDef = backend->getStatementDef(statementID);
+	if (otlStream != nullptr) {
+		statementCacheHits++;
+		if (!statementDef.hasInput) {
+			otlStream->rewind();
+		}
+		return *otlStream;
+	}
+	statementCacheMisses++;
+	otlStream = new otl_stream();
+	try {
+		otlStream->open(statementDef.bufferSize, statementDef.query, *dbConnection);
+	}
+	catch (otl_exception ex)
+	{
+		delete otlStream;
+		throw;
+	}
+	statementCache.at(statementID) = otlStream;
+	return *otlStream;
+}
+
+void DBManager::evictStream(StatementID statementID)
+{
+	otl_stream* otlStream = statementCache.at(statementID);
+	if (otlStream != nullptr) {
+		statementCache.at(statementID) = nullptr;
+		try {
+			otlStream->close();
+		}
+		catch (otl_exception ex)
+		{
+		}
+		delete otlStream;
+	}
+}
+
 DBManager::~DBManager()
 {
+	if (replica != nullptr) {
+		delete replica;
+		replica = nullptr;
+	}
+	clearStatementCache();
 	if (dbConnection != nullptr) {
 		delete dbConnection;
 		dbConnection = nullptr;
@@ -1,9 +1,19 @@
 #pragma once
 #include "stdafx.h"
+#include "DBStatements.h"
+#include "DBBackend.h"
+#include "LatencyHistogram.h"
+#include "CircuitBreaker.h"
 #include <fstream>
+#include <functional>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <ctime>
 #include <boost/serialization/access.hpp>
-
-static const int OTL_BUFFER_SIZE = 1;
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 
 struct ConnectionInformation {
 	friend class boost::serialization::access;
@@ -17,7 +27,16 @@ struct ConnectionInformation {
 	std::string server;
 	std::string uid;
 	std::string pwd;
+	//The database file for BACKEND_SQLITE
 	std::string database;
+	DBBackendType backend;
+	//Servers replicating from server, every other field is shared with the primary
+	std::vector <std::string> replicaServers;
+
+	/// <summary>
+	/// Copy of this information that connects to replicaServers[replicaIndex] instead of server
+	/// </summary>
+	ConnectionInformation getReplicaInfo(int replicaIndex) const;
 
 	bool loadFromFile(const std::string& filePath);
 
@@ -31,18 +50,71 @@ struct ConnectionInformation {
 		ar & uid;
 		ar & pwd;
 		ar & database;
+		if (version > 0) {
+			ar & replicaServers;
+		}
+		if (version > 1) {
+			ar & backend;
+		}
 	}
 };
 
+BOOST_CLASS_VERSION(ConnectionInformation, 2)
+
+typedef std::function<void(otl_stream&)> StatementFunc;
+
+struct DBHealth {
+	bool connected;
+	//Reconnect attempts that have failed in a row, drives the backoff
+	int failedAttempts;
+	int backoffMillis;
+	uint64_t lostConnections;
+	uint64_t reconnects;
+	//Statements that were run again after a lost connection was restored
+	uint64_t retries;
+	uint64_t probes;
+	uint64_t failedProbes;
+	std::time_t lastProbeTime;
+	//Statements run on this connection
+	uint64_t statements;
+	//Reads that went to the primary because the replica was down, lagging or failed the read
+	uint64_t replicaFallbacks;
+	//Seconds_Behind_Master when this connection is a replica, -1 if unknown or replication is stopped
+	int replicationLagSeconds;
+	//Statements that took longer than the slow query threshold
+	uint64_t slowQueries;
+};
+
 class DBManager
 {
 public:
+	static const int MIN_BACKOFF_MILLIS = 250;
+	static const int MAX_BACKOFF_MILLIS = 30000;
+	//Replicas further behind than this are skipped until they catch up
+	static const int MAX_REPLICA_LAG_SECONDS = 5;
+	static const int LAG_CHECK_INTERVAL_SECONDS = 5;
+	static const int DEFAULT_SLOW_QUERY_MILLIS = 250;
+
 	static void InitOTL() {
 		otl_connect::otl_initialize(1);
 	}
 
+	/// <summary>
+	/// Statements slower than this are logged with their query text, 0 logs every statement
+	/// </summary>
+	static void SetSlowQueryMillis(int slowQueryMillis) {
+		SlowQueryMillis = slowQueryMillis;
+	}
+
+	static int GetSlowQueryMillis() {
+		return SlowQueryMillis;
+	}
+
 	DBManager();
 
+	/// <summary>
+	/// Connects to connectionInfo's backend, which decides the SQL dialect of every statement run afterwards
+	/// </summary>
 	bool connect(const ConnectionInformation& connectionInfo);
 
 	bool connect(const std::string& connectStr);
@@ -52,8 +124,225 @@ public:
 		return dbConnection;
 	}
 
+	const DBBackend* getBackend() {
+		return backend;
+	}
+
+	/// <summary>
+	/// Lets the backend create any tables it is missing
+	/// </summary>
+	bool createSchema();
+
+	/// <summary>
+	/// Opens a second connection that ACCESS_READ statements are routed to while it is caught up
+	/// </summary>
+	bool setReplica(const ConnectionInformation& replicaInfo);
+
+	DBManager* getReplica() {
+		return replica;
+	}
+
+	/// <summary>
+	/// Reports whether each statement reached the database to circuitBreaker, only set on primaries
+	/// since a replica going down just sends reads to the primary
+	/// </summary>
+	void setCircuitBreaker(CircuitBreaker* circuitBreaker) {
+		this->circuitBreaker = circuitBreaker;
+	}
+
+	/// <summary>
+	/// Lets reads go back to the replica, called when the DBManager is returned to its pool.
+	/// Until then every read after a write stays on the primary so a caller sees its own writes.
+	/// </summary>
+	void releasePrimaryPin() {
+		primaryPinned = false;
+	}
+
+	/// <summary>
+	/// Runs func against the cached stream for ID, preparing it on first use. func gets a
+	/// StatementStream<ID>, so only the statement's Bind and Fetch columns will compile.
+	/// Each bind re-executes the stream. Rows bound past the statement's buffer size are sent
+	/// in batches and the remainder is flushed after func.
+	/// If the connection was lost it is reestablished and func runs once more, so func
+	/// must not accumulate results across runs.
+	/// </summary>
+	/// <returns>False if an otl_exception was thrown, the stream is evicted in that case</returns>
+	template<StatementID ID, typename Func>
+	bool execute(const Func& func) {
+		return execute(ID, [&func](otl_stream& otlStream) {
+			StatementStream<ID> statementStream(otlStream);
+			func(statementStream);
+		});
+	}
+
+	/// <summary>
+	/// Starts a transaction, or a savepoint when one is already open, so the statements
+	/// that follow commit or roll back together. Statements inside a transaction are not
+	/// retried after a lost connection since the work before them is gone with it.
+	/// </summary>
+	bool beginTransaction();
+
+	/// <summary>
+	/// Commits the innermost scope, the outermost one commits to the server and runs afterCommit hooks
+	/// </summary>
+	/// <returns>False if a statement in the scope failed or the commit threw, the scope is rolled back in that case</returns>
+	bool commitTransaction();
+
+	/// <summary>
+	/// Rolls back the innermost scope and drops the afterCommit hooks it registered
+	/// </summary>
+	void rollbackTransaction();
+
+	bool inTransaction() {
+		return !scopeFailed.empty();
+	}
+
+	/// <summary>
+	/// Runs hook once the current transaction commits, or straight away outside of one.
+	/// Used for cache write-through and emails that must not happen for rolled back work.
+	/// </summary>
+	void afterCommit(const std::function<void()>& hook);
+
+	uint64_t getCommits() {
+		return commits;
+	}
+
+	/// <summary>
+	/// Runs a trivial query so a connection dropped while idle is noticed and reopened
+	/// before a handler needs it
+	/// </summary>
+	bool probe();
+
+	/// <summary>
+	/// Reads Seconds_Behind_Master from SHOW SLAVE STATUS, a server that returns no status is not lagging
+	/// </summary>
+	bool checkReplicationLag();
+
+	bool isConnected();
+
+	DBHealth getHealth();
+
+	void clearStatementCache();
+
+	uint64_t getStatementCacheHits() {
+		return statementCacheHits;
+	}
+
+	uint64_t getStatementCacheMisses() {
+		return statementCacheMisses;
+	}
+
+	/// <summary>
+	/// How long each statement has taken on this connection, indexed by StatementID.
+	/// A replica's statements are timed on the replica's own DBManager.
+	/// </summary>
+	std::vector <LatencySnapshot> getLatencies();
+
 	~DBManager();
 
 protected:
+	static std::atomic<int> SlowQueryMillis;
+
+	/// <summary>
+	/// Picks the replica or primary for statementID and runs func there
+	/// </summary>
+	bool execute(StatementID statementID, const StatementFunc& func);
+
+	/// <summary>
+	/// Runs the statement on this DBManager's own connection, reconnecting and retrying once if it was lost
+	/// </summary>
+	bool executeLocal(StatementID statementID, const StatementFunc& func);
+
+	/// <summary>
+	/// The part of executeLocal that is timed, runs func and handles a lost connection
+	/// </summary>
+	bool runStatement(StatementID statementID, const StatementFunc& func);
+
+	/// <summary>
+	/// Adds a run of statementID to its histogram and logs it if it was slow
+	/// </summary>
+	void recordLatency(StatementID statementID, uint64_t micros, bool success);
+
+	/// <summary>
+	/// True if the replica is connected and within MAX_REPLICA_LAG_SECONDS, rechecks the lag when it is stale
+	/// </summary>
+	bool isReplicaUsable();
+
+	otl_stream& getStream(StatementID statementID);
+	void evictStream(StatementID statementID);
+
+	/// <summary>
+	/// Ends the outermost transaction and puts the connection back in autocommit mode
+	/// </summary>
+	bool endTransaction(bool commit);
+
+	/// <summary>
+	/// Reconnects with the last connect string unless the backoff from the previous failure is still running
+	/// </summary>
+	/// <param name="attempted">Set to whether a connection was actually tried, false while the backoff held it off</param>
+	bool reconnect(bool* attempted = nullptr);
+
+	/// <summary>
+	/// reconnect, reporting the outcome to circuitBreaker. Only a connection that was tried counts as a failure,
+	/// one held off by the backoff never reached the server so a half open breaker gets its trial back instead.
+	/// </summary>
+	bool reconnectReported();
+
 	otl_connect* dbConnection;
+	const DBBackend* backend;
+	std::string connectStr;
+	std::mutex healthMutex;
+	DBHealth health;
+	std::chrono::steady_clock::time_point nextReconnectTime;
+	std::chrono::steady_clock::time_point lastLagCheck;
+	DBManager* replica;
+	CircuitBreaker* circuitBreaker;
+	bool primaryPinned;
+	std::vector <otl_stream*> statementCache;
+	std::vector <LatencyHistogram> latencies;
+	//One entry per open transaction scope, true once a statement in that scope has failed
+	std::vector <bool> scopeFailed;
+	//Index into afterCommitHooks where each open scope's hooks start
+	std::vector <size_t> scopeHookStart;
+	std::vector <std::function<void()>> afterCommitHooks;
+	//Set when the connection drops mid transaction, everything since beginTransaction is gone
+	bool transactionLost;
+	std::atomic<uint64_t> commits;
+	std::atomic<uint64_t> statementCacheHits;
+	std::atomic<uint64_t> statementCacheMisses;
+};
+
+/// <summary>
+/// Scoped transaction on a DBManager, rolls back on destruction unless commit succeeded
+/// </summary>
+class DBTransaction
+{
+public:
+	DBTransaction(DBManager* dbManager)
+		:dbManager(dbManager)
+	{
+		active = dbManager->beginTransaction();
+	}
+
+	bool isActive() {
+		return active;
+	}
+
+	bool commit() {
+		if (!active) {
+			return false;
+		}
+		active = false;
+		return dbManager->commitTransaction();
+	}
+
+	~DBTransaction() {
+		if (active) {
+			dbManager->rollbackTransaction();
+		}
+	}
+
+private:
+	DBManager* dbManager;
+	bool active;
 };
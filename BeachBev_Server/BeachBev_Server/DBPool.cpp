@@ -0,0 +1,198 @@
+#include "DBPool.h"
+#include <algorithm>
+#include <chrono>
+
+thread_local DBManager* DBPool::LastLeased = nullptr;
+
+DBPool::DBPool(const ConnectionInformation & conInfo, int poolSize)
+	:stopping(false), affinityEnabled(true)
+{
+	stats = DBPoolStats();
+	if (poolSize <= 0) {
+		poolSize = DEFAULT_POOL_SIZE;
+	}
+	if (DBBackend::Get(conInfo.backend)->supportsReplicas()) {
+		replicaServers = conInfo.replicaServers;
+	}
+	for (int i = 0; i < poolSize; i++) {
+		DBManager* dbManager = new DBManager();
+		dbManager->setCircuitBreaker(&circuitBreaker);
+		dbManager->connect(conInfo);
+		//Spread the pool evenly over the replicas
+		if (!replicaServers.empty()) {
+			dbManager->setReplica(conInfo.getReplicaInfo(i % replicaServers.size()));
+		}
+		dbManagers.push_back(dbManager);
+		idleManagers.push_back(dbManager);
+	}
+	stats.size = poolSize;
+	probeThread = std::thread(&DBPool::probeLoop, this);
+}
+
+DBManager* DBPool::checkout()
+{
+	std::unique_lock<std::mutex> lock(poolMutex);
+	if (idleManagers.empty()) {
+		auto waitStart = std::chrono::steady_clock::now();
+		idleCondition.wait(lock, [this]() { return !idleManagers.empty(); });
+		uint64_t waitMicros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStart).count();
+		stats.waits++;
+		stats.totalWaitMicros += waitMicros;
+		stats.maxWaitMicros = std::max(stats.maxWaitMicros, waitMicros);
+	}
+	auto idleIter = idleManagers.end() - 1;
+	if (affinityEnabled && LastLeased != nullptr) {
+		auto lastIter = std::find(idleManagers.begin(), idleManagers.end(), LastLeased);
+		if (lastIter != idleManagers.end()) {
+			idleIter = lastIter;
+			stats.affinityHits++;
+		}
+	}
+	DBManager* dbManager = *idleIter;
+	idleManagers.erase(idleIter);
+	stats.checkouts++;
+	stats.inUse++;
+	stats.peakInUse = std::max(stats.peakInUse, stats.inUse);
+	LastLeased = dbManager;
+	return dbManager;
+}
+
+void DBPool::checkin(DBManager * dbManager)
+{
+	//A transaction left open would otherwise be committed by the next lease's statements
+	while (dbManager->inTransaction()) {
+		dbManager->rollbackTransaction();
+	}
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+		dbManager->releasePrimaryPin();
+		idleManagers.push_back(dbManager);
+		stats.inUse--;
+	}
+	idleCondition.notify_one();
+}
+
+DBPoolStats DBPool::getStats()
+{
+	std::lock_guard<std::mutex> lock(poolMutex);
+	DBPoolStats poolStats = stats;
+	poolStats.statementCacheHits = 0;
+	poolStats.statementCacheMisses = 0;
+	for (int i = 0; i < dbManagers.size(); i++) {
+		poolStats.statementCacheHits += dbManagers.at(i)->getStatementCacheHits();
+		poolStats.statementCacheMisses += dbManagers.at(i)->getStatementCacheMisses();
+	}
+	return poolStats;
+}
+
+std::vector<DBHealth> DBPool::getHealth()
+{
+	std::vector <DBHealth> poolHealth;
+	for (int i = 0; i < dbManagers.size(); i++) {
+		poolHealth.push_back(dbManagers.at(i)->getHealth());
+	}
+	return poolHealth;
+}
+
+std::vector<DBReplicaStats> DBPool::getReplicaStats(uint64_t& fallbacks)
+{
+	std::vector <DBReplicaStats> replicaStats(replicaServers.size(), DBReplicaStats());
+	for (int i = 0; i < replicaStats.size(); i++) {
+		replicaStats.at(i).server = replicaServers.at(i);
+	}
+	fallbacks = 0;
+	for (int i = 0; i < dbManagers.size(); i++) {
+		fallbacks += dbManagers.at(i)->getHealth().replicaFallbacks;
+		DBManager* replica = dbManagers.at(i)->getReplica();
+		if (replica == nullptr) {
+			continue;
+		}
+		DBHealth replicaHealth = replica->getHealth();
+		DBReplicaStats& stats = replicaStats.at(i % replicaStats.size());
+		if (stats.connections == 0 || replicaHealth.replicationLagSeconds < 0) {
+			stats.maxLagSeconds = replicaHealth.replicationLagSeconds;
+		}
+		else if (stats.maxLagSeconds >= 0)
+		{
+			stats.maxLagSeconds = std::max(stats.maxLagSeconds, replicaHealth.replicationLagSeconds);
+		}
+		stats.connections++;
+		if (replicaHealth.connected) {
+			stats.connected++;
+		}
+		stats.statements += replicaHealth.statements;
+		stats.slowQueries += replicaHealth.slowQueries;
+	}
+	return replicaStats;
+}
+
+std::vector<DBConnectionLatencies> DBPool::getLatencies()
+{
+	std::vector <DBConnectionLatencies> poolLatencies;
+	for (int i = 0; i < dbManagers.size(); i++) {
+		DBConnectionLatencies latencies;
+		latencies.connection = i;
+		latencies.replica = false;
+		latencies.statements = dbManagers.at(i)->getLatencies();
+		poolLatencies.push_back(latencies);
+		DBManager* replica = dbManagers.at(i)->getReplica();
+		if (replica != nullptr) {
+			latencies.replica = true;
+			latencies.statements = replica->getLatencies();
+			poolLatencies.push_back(latencies);
+		}
+	}
+	return poolLatencies;
+}
+
+void DBPool::probeIdle()
+{
+	for (int i = 0; i < dbManagers.size(); i++) {
+		DBManager* dbManager = dbManagers.at(i);
+		{
+			std::lock_guard<std::mutex> lock(poolMutex);
+			auto idleIter = std::find(idleManagers.begin(), idleManagers.end(), dbManager);
+			if (stopping || idleIter == idleManagers.end()) {
+				continue;
+			}
+			idleManagers.erase(idleIter);
+		}
+		dbManager->probe();
+		{
+			std::lock_guard<std::mutex> lock(poolMutex);
+			idleManagers.push_back(dbManager);
+		}
+		idleCondition.notify_one();
+	}
+}
+
+void DBPool::probeLoop()
+{
+	std::unique_lock<std::mutex> lock(poolMutex);
+	while (!stopping) {
+		probeCondition.wait_for(lock, std::chrono::seconds(PROBE_INTERVAL_SECONDS), [this]() { return stopping; });
+		if (stopping) {
+			return;
+		}
+		lock.unlock();
+		probeIdle();
+		lock.lock();
+	}
+}
+
+DBPool::~DBPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+		stopping = true;
+	}
+	probeCondition.notify_all();
+	if (probeThread.joinable()) {
+		probeThread.join();
+	}
+	for (int i = 0; i < dbManagers.size(); i++) {
+		delete dbManagers.at(i);
+	}
+	dbManagers.clear();
+	idleManagers.clear();
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include "stdafx.h"
+#include "DBManager.h"
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+
+struct DBPoolStats {
+	int size;
+	int inUse;
+	int peakInUse;
+	uint64_t checkouts;
+	//Checkouts that had to block because every DBManager was leased
+	uint64_t waits;
+	uint64_t totalWaitMicros;
+	uint64_t maxWaitMicros;
+	//Checkouts that got the same DBManager the calling thread used last
+	uint64_t affinityHits;
+	//Summed across every DBManager's prepared statement cache
+	uint64_t statementCacheHits;
+	uint64_t statementCacheMisses;
+};
+
+struct DBReplicaStats {
+	std::string server;
+	//DBManagers whose reads are routed to this replica
+	int connections;
+	int connected;
+	uint64_t statements;
+	uint64_t slowQueries;
+	//Highest lag seen across this replica's connections, -1 if any of them could not read it
+	int maxLagSeconds;
+};
+
+struct DBConnectionLatencies {
+	//Index of the pooled DBManager, a replica shares its primary's index
+	int connection;
+	bool replica;
+	//Indexed by StatementID
+	std::vector <LatencySnapshot> statements;
+};
+
+/// <summary>
+/// Owns a fixed set of DBManagers and leases them out one handler call at a time
+/// so a slow query only holds up the caller that issued it.
+/// Idle DBManagers are probed in the background so dropped connections are reopened before they are leased.
+/// </summary>
+class DBPool
+{
+public:
+	static const int DEFAULT_POOL_SIZE = 4;
+	static const int PROBE_INTERVAL_SECONDS = 30;
+
+	DBPool(const ConnectionInformation& conInfo, int poolSize = DEFAULT_POOL_SIZE);
+
+	/// <summary>
+	/// Blocks until a DBManager is idle and removes it from the idle list.
+	/// Prefers the DBManager the calling thread leased last if it is idle, its statements are likely still prepared.
+	/// </summary>
+	DBManager* checkout();
+
+	void checkin(DBManager* dbManager);
+
+	void setAffinityEnabled(bool affinityEnabled) {
+		this->affinityEnabled = affinityEnabled;
+	}
+
+	int getSize() {
+		return dbManagers.size();
+	}
+
+	DBPoolStats getStats();
+
+	/// <summary>
+	/// Health of every connection in the pool, indexed the same way every call
+	/// </summary>
+	std::vector <DBHealth> getHealth();
+
+	/// <summary>
+	/// Load and lag of each replica, totals reads that fell back to the primary into fallbacks
+	/// </summary>
+	std::vector <DBReplicaStats> getReplicaStats(uint64_t& fallbacks);
+
+	/// <summary>
+	/// Statement timings of every pooled connection followed by its replica if it has one
+	/// </summary>
+	std::vector <DBConnectionLatencies> getLatencies();
+
+	/// <summary>
+	/// Shared by every primary connection in the pool, the probe loop doubles as its half-open probe
+	/// </summary>
+	CircuitBreaker* getCircuitBreaker() {
+		return &circuitBreaker;
+	}
+
+	~DBPool();
+
+private:
+	static thread_local DBManager* LastLeased;
+
+	/// <summary>
+	/// Probes each DBManager that is idle, leased ones are skipped until the next round
+	/// </summary>
+	void probeIdle();
+
+	void probeLoop();
+
+	std::thread probeThread;
+	bool stopping;
+
+	std::vector <DBManager*> dbManagers;
+	std::vector <DBManager*> idleManagers;
+	std::vector <std::string> replicaServers;
+	CircuitBreaker circuitBreaker;
+	std::mutex poolMutex;
+	std::condition_variable idleCondition;
+	std::condition_variable probeCondition;
+	DBPoolStats stats;
+	//Set from the console thread while pool threads read it in checkout
+	std::atomic<bool> affinityEnabled;
+};
+
+/// <summary>
+/// Holds a DBManager checked out of a DBPool for the lifetime of the lease
+/// </summary>
+class DBLease
+{
+public:
+	DBLease(DBPool* dbPool)
+		:dbPool(dbPool), dbManager(dbPool->checkout())
+	{
+	}
+
+	DBManager* get() {
+		return dbManager;
+	}
+
+	~DBLease() {
+		dbPool->checkin(dbManager);
+	}
+
+private:
+	DBLease(const DBLease&) = delete;
+	DBLease& operator=(const DBLease&) = delete;
+
+	DBPool* dbPool;
+	DBManager* dbManager;
+};
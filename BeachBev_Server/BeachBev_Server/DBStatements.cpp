@@ -0,0 +1,172 @@
+#include "DBStatements.h"
+#include <vector>
+
+template<StatementID ID>
+static StatementDef MakeStatementDef(const char* name, const char* query, StatementAccess access, int bufferSize = SINGLE_ROW_BUFFER_SIZE)
+{
+	StatementDef statementDef;
+	statementDef.name = name;
+	statementDef.query = query;
+	statementDef.access = access;
+	statementDef.bufferSize = bufferSize;
+	statementDef.hasInput = (std::tuple_size<typename StatementTraits<ID>::Bind>::value > 0);
+	return statementDef;
+}
+
+//Queries are literals so nothing is built at runtime, the static_assert holds each one to its StatementTraits
+#define CHECK_QUERY(statementID, name, text) \
+	static_assert(PlaceholdersMatch<StatementTraits<statementID>::Bind>::Check(text, 0), \
+		name ": placeholders do not match the Bind columns in StatementTraits")
+
+#define ADD_STATEMENT(statementID, name, text, ...) \
+	CHECK_QUERY(statementID, name, text); \
+	statementDefs[statementID] = MakeStatementDef<statementID>(name, text, __VA_ARGS__)
+
+#define SET_DIALECT(statementID, text) \
+	CHECK_QUERY(statementID, #statementID, text); \
+	statementDefs[statementID].query = text
+
+//Shared by the resolveIdentity statements, every branch of their UNION ALL returns the same columns
+#define IDENTITY_COLUMNS "SELECT e.eID, e.name, e.email, u.email, e.pwdHash, e.pwdSalt, "
+#define IDENTITY_BY_EMPLOYEE "FROM Employees e LEFT JOIN UnverifiedEmails u ON u.eID=e.eID "
+#define IDENTITY_BY_UNVERIFIED "FROM UnverifiedEmails u JOIN Employees e ON e.eID=u.eID "
+
+//createSequences has no placeholder to check its column width against
+static_assert(IDSequencer::MAX_NAME_SIZE == 32, "Update the Sequences table in createSequences");
+
+/// <summary>
+/// Rewrites the statements whose MySQL syntax SQLite does not accept, everything else is shared
+/// </summary>
+static void AddSQLiteDialect(std::vector <StatementDef>& statementDefs)
+{
+	SET_DIALECT(STMT_SEED_EID_SEQUENCE,
+		"INSERT OR IGNORE INTO Sequences (name, nextID) SELECT 'eID', COALESCE(MAX(eID), 0) + 1 FROM Employees");
+	SET_DIALECT(STMT_SEED_DEVICE_SEQUENCE,
+		"INSERT OR IGNORE INTO Sequences (name, nextID) SELECT :f1<char[32]>, COALESCE(MAX(deviceID), 0) + 1 FROM PwdTokens WHERE eID=:f2<int>");
+	//DELETE ... LIMIT needs a SQLite build option, so the rows are picked by rowid instead
+	SET_DIALECT(STMT_SWEEP_PWD_TOKENS,
+		"DELETE FROM PwdTokens WHERE rowid IN (SELECT rowid FROM PwdTokens WHERE tokenTime < :f1<bigint> LIMIT :f2<int>)");
+	SET_DIALECT(STMT_SWEEP_PWD_RESET_TOKENS,
+		"DELETE FROM PwdResetTokens WHERE rowid IN (SELECT rowid FROM PwdResetTokens WHERE tokenTime < :f1<bigint> LIMIT :f2<int>)");
+}
+
+static std::vector <StatementDef> CreateStatementDefs(DBBackendType backendType)
+{
+	std::vector <StatementDef> statementDefs(NUM_STATEMENTS);
+	ADD_STATEMENT(STMT_ADD_EMPLOYEE, "addEmployee",
+		"INSERT INTO Employees (eID, name) VALUES (:f1<int>, :f2<char[50]>)", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_DELETE_EMPLOYEE, "deleteEmployee",
+		"DELETE FROM Employees WHERE eID=:f1<int>", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_SEED_EID_SEQUENCE, "seedEIDSequence",
+		"INSERT IGNORE INTO Sequences (name, nextID) SELECT 'eID', COALESCE(MAX(eID), 0) + 1 FROM Employees", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_NAME_TO_EID, "nameToEID",
+		"SELECT eID FROM Employees WHERE name=:f1<char[50]>", ACCESS_READ);
+	//One indexed point lookup per column, matchRank lines up with IdentityMatch so the best match comes back first.
+	//Signup and login decide what to write from these, so a lagging replica could let a duplicate or an old password through.
+	ADD_STATEMENT(STMT_RESOLVE_IDENTITY, "resolveIdentity",
+		IDENTITY_COLUMNS "1 AS matchRank " IDENTITY_BY_EMPLOYEE "WHERE e.name=:f1<char[254]> "
+		"UNION ALL " IDENTITY_COLUMNS "2 " IDENTITY_BY_EMPLOYEE "WHERE e.email=:f2<char[254]> "
+		"UNION ALL " IDENTITY_COLUMNS "3 " IDENTITY_BY_UNVERIFIED "WHERE u.email=:f3<char[254]> "
+		"ORDER BY matchRank LIMIT 1", ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_RESOLVE_SIGNUP_IDENTITY, "resolveSignupIdentity",
+		IDENTITY_COLUMNS "1 AS matchRank " IDENTITY_BY_EMPLOYEE "WHERE e.name=:f1<char[254]> "
+		"UNION ALL " IDENTITY_COLUMNS "2 " IDENTITY_BY_EMPLOYEE "WHERE e.email=:f2<char[254]> "
+		"UNION ALL " IDENTITY_COLUMNS "3 " IDENTITY_BY_UNVERIFIED "WHERE u.email=:f3<char[254]> "
+		"UNION ALL " IDENTITY_COLUMNS "4 " IDENTITY_BY_EMPLOYEE "WHERE e.email=:f4<char[254]> "
+		"UNION ALL " IDENTITY_COLUMNS "4 " IDENTITY_BY_UNVERIFIED "WHERE u.email=:f5<char[254]> "
+		"ORDER BY matchRank LIMIT 1", ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_RESOLVE_SIGNUP_EMAIL, "resolveSignupEmail",
+		IDENTITY_COLUMNS "4 AS matchRank " IDENTITY_BY_EMPLOYEE "WHERE e.email=:f1<char[254]> "
+		"UNION ALL " IDENTITY_COLUMNS "4 " IDENTITY_BY_UNVERIFIED "WHERE u.email=:f2<char[254]> "
+		"LIMIT 1", ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_SET_PWD, "setPwd",
+		"UPDATE Employees SET pwdHash=:f1<raw[64]>, pwdSalt=:f2<raw[32]> WHERE eID=:f3<int>", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_GET_PWD_DATA, "getPwdData",
+		"SELECT pwdHash, pwdSalt FROM Employees WHERE eID = :f1<int>", ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_SET_PWD_TOKEN, "setPwdToken",
+		"REPLACE INTO PwdTokens VALUES (:f1<int>, :f2<int>, :f3<raw[64]>, :f4<bigint>)", ACCESS_WRITE);
+	//Array-bound so the token write-behind queue sends a whole batch per round trip
+	ADD_STATEMENT(STMT_SET_PWD_TOKENS, "setPwdTokens",
+		"REPLACE INTO PwdTokens VALUES (:f1<int>, :f2<int>, :f3<raw[64]>, :f4<bigint>)", ACCESS_WRITE, BULK_BUFFER_SIZE);
+	ADD_STATEMENT(STMT_GET_PWD_TOKEN, "getPwdToken",
+		"SELECT tokenHash, tokenTime FROM PwdTokens WHERE eID = :f1<int> AND deviceID = :f2<int>", ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_CLEAR_PWD_TOKENS, "clearPwdTokens",
+		"DELETE FROM PwdTokens WHERE eID=:f1<int>", ACCESS_WRITE);
+	//Takes back a queued rotation that was discarded while its batch was being written
+	ADD_STATEMENT(STMT_REMOVE_PWD_TOKEN, "removePwdToken",
+		"DELETE FROM PwdTokens WHERE eID=:f1<int> AND deviceID=:f2<int> AND tokenHash=:f3<raw[64]>", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_SEED_DEVICE_SEQUENCE, "seedDeviceSequence",
+		"INSERT IGNORE INTO Sequences (name, nextID) SELECT :f1<char[32]>, COALESCE(MAX(deviceID), 0) + 1 FROM PwdTokens WHERE eID=:f2<int>", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_SET_PWD_RESET_TOKEN, "setPwdResetToken",
+		"REPLACE INTO PwdResetTokens VALUES (:f1<int>, :f2<raw[64]>, :f3<bigint>)", ACCESS_WRITE);
+	//From a replica a token that was already used could be replayed
+	ADD_STATEMENT(STMT_CHECK_PWD_RESET_TOKEN, "checkPwdResetToken",
+		"SELECT eID, tokenTime FROM PwdResetTokens WHERE tokenHash=:f1<raw[64]>", ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_REMOVE_PWD_RESET_TOKEN, "removePwdResetToken",
+		"DELETE FROM PwdResetTokens WHERE eID=:f1<int>", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_SET_UNVERIFIED_EMAIL, "setUnverifiedEmail",
+		"REPLACE INTO UnverifiedEmails VALUES (:f1<int>, :f2<char[254]>, :f3<raw[64]>, :f4<bigint>)", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_VERIFIED_EMAIL_TO_EID, "verifiedEmailToEID",
+		"SELECT eID FROM Employees WHERE email=:f1<char[254]>", ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_UNVERIFIED_EMAIL_TO_EID, "unverifiedEmailToEID",
+		"SELECT eID FROM UnverifiedEmails WHERE email=:f1<char[254]>", ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_GET_EMAIL_TOKEN, "getEmailToken",
+		"SELECT tokenHash, tokenTime FROM UnverifiedEmails WHERE eID=:f1<int>", ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_VERIFY_EMAIL, "verifyEmail",
+		"UPDATE Employees SET email=:f1<char[254]>, aState=:f2<int> WHERE eID=:f3<int>", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_REMOVE_UNVERIFIED_EMAIL, "removeUnverifiedEmail",
+		"DELETE FROM UnverifiedEmails WHERE eID = :f1<int>", ACCESS_WRITE);
+	//Only read to rebuild the cached E1, from a lagging replica it would be cached as current
+	ADD_STATEMENT(STMT_GET_EIDS_WITH_ASTATE, "getEIDsWithAState",
+		"SELECT eID FROM Employees WHERE aState=:f1<int>", ACCESS_READ_PRIMARY, BULK_BUFFER_SIZE);
+	ADD_STATEMENT(STMT_GET_APPLICANTS_AFTER, "getApplicantsAfter",
+		"SELECT eID, aState FROM Employees WHERE eID > :f1<int> AND aState IN (:f2<int>, :f3<int>) ORDER BY eID", ACCESS_READ, BULK_BUFFER_SIZE);
+	ADD_STATEMENT(STMT_GET_ASTATE, "getAState",
+		"SELECT aState FROM Employees WHERE eID=:f1<int>", ACCESS_READ);
+	ADD_STATEMENT(STMT_SET_ASTATE, "setAState",
+		"UPDATE Employees SET aState=:f1<int> WHERE eID=:f2<int>", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_GET_MASTERS, "getMasters",
+		"SELECT eID FROM Masters", ACCESS_READ, BULK_BUFFER_SIZE);
+	ADD_STATEMENT(STMT_PING, "ping",
+		"SELECT 1", ACCESS_READ_PRIMARY);
+	//The directory is trusted over the database once loaded, so it is always read from the primary
+	ADD_STATEMENT(STMT_LOAD_DIRECTORY, "loadDirectory",
+		"SELECT e.eID, e.name, e.email, u.email FROM Employees e LEFT JOIN UnverifiedEmails u ON u.eID=e.eID",
+		ACCESS_READ_PRIMARY, BULK_BUFFER_SIZE);
+	ADD_STATEMENT(STMT_LOAD_DIRECTORY_ENTRY, "loadDirectoryEntry",
+		"SELECT e.eID, e.name, e.email, u.email FROM Employees e LEFT JOIN UnverifiedEmails u ON u.eID=e.eID WHERE e.eID=:f1<int>",
+		ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_CREATE_SEQUENCES, "createSequences",
+		"CREATE TABLE IF NOT EXISTS Sequences (name VARCHAR(32) PRIMARY KEY, nextID BIGINT NOT NULL)", ACCESS_WRITE);
+	//Run in one transaction with getSequence, the update's row lock keeps the value read back ours
+	ADD_STATEMENT(STMT_RESERVE_IDS, "reserveIDs",
+		"UPDATE Sequences SET nextID=nextID + :f1<bigint> WHERE name=:f2<char[32]>", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_GET_SEQUENCE, "getSequence",
+		"SELECT nextID FROM Sequences WHERE name=:f1<char[32]>", ACCESS_READ_PRIMARY);
+	ADD_STATEMENT(STMT_DELETE_SEQUENCE, "deleteSequence",
+		"DELETE FROM Sequences WHERE name=:f1<char[32]>", ACCESS_WRITE);
+	//Expiry sweeps, bounded by a row limit so each one holds its locks briefly
+	ADD_STATEMENT(STMT_SWEEP_PWD_TOKENS, "sweepPwdTokens",
+		"DELETE FROM PwdTokens WHERE tokenTime < :f1<bigint> LIMIT :f2<int>", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_SWEEP_PWD_RESET_TOKENS, "sweepPwdResetTokens",
+		"DELETE FROM PwdResetTokens WHERE tokenTime < :f1<bigint> LIMIT :f2<int>", ACCESS_WRITE);
+	ADD_STATEMENT(STMT_GET_EXPIRED_UNVERIFIED_EMAILS, "getExpiredUnverifiedEmails",
+		"SELECT eID, email FROM UnverifiedEmails WHERE tokenTime < :f1<bigint> LIMIT :f2<int>", ACCESS_READ_PRIMARY, BULK_BUFFER_SIZE);
+	//Rechecks the time so an email set again since the select is kept
+	ADD_STATEMENT(STMT_SWEEP_UNVERIFIED_EMAIL, "sweepUnverifiedEmail",
+		"DELETE FROM UnverifiedEmails WHERE eID=:f1<int> AND tokenTime < :f2<bigint>", ACCESS_WRITE);
+	if (backendType == BACKEND_SQLITE) {
+		AddSQLiteDialect(statementDefs);
+	}
+	return statementDefs;
+}
+
+const StatementDef& GetStatementDef(StatementID statementID, DBBackendType backendType)
+{
+	static const std::vector <StatementDef> MySQLStatementDefs = CreateStatementDefs(BACKEND_MYSQL);
+	static const std::vector <StatementDef> SQLiteStatementDefs = CreateStatementDefs(BACKEND_SQLITE);
+	if (backendType == BACKEND_SQLITE) {
+		return SQLiteStatementDefs.at(statementID);
+	}
+	return MySQLStatementDefs.at(statementID);
+}
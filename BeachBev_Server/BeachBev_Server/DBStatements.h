@@ -0,0 +1,196 @@
+#pragma once
+#include "stdafx.h"
+#include "StatementTypes.h"
+#include "IDSequencer.h"
+#include <string>
+
+//Column sizes, every placeholder for these columns is checked against them when DBStatements.cpp compiles
+static const int TOKEN_SIZE = 64;
+static const int HASH_SIZE = 64;
+static const int SALT_SIZE = 32;
+static const int NAME_SIZE = 50;
+static const int EMAIL_SIZE = 254;
+
+//Rows per driver round trip for single row lookups and writes
+static const int SINGLE_ROW_BUFFER_SIZE = 1;
+//Rows per driver round trip for list queries and array-bound writes
+static const int BULK_BUFFER_SIZE = 256;
+
+enum DBBackendType {
+	BACKEND_MYSQL,
+	BACKEND_SQLITE,
+	NUM_BACKENDS
+};
+
+/// <summary>
+/// Every query the server runs, used as the key into DBManager's statement cache
+/// </summary>
+enum StatementID {
+	STMT_ADD_EMPLOYEE,
+	STMT_DELETE_EMPLOYEE,
+	STMT_SEED_EID_SEQUENCE,
+	STMT_NAME_TO_EID,
+	STMT_RESOLVE_IDENTITY,
+	STMT_RESOLVE_SIGNUP_IDENTITY,
+	STMT_RESOLVE_SIGNUP_EMAIL,
+	STMT_SET_PWD,
+	STMT_GET_PWD_DATA,
+	STMT_SET_PWD_TOKEN,
+	STMT_SET_PWD_TOKENS,
+	STMT_GET_PWD_TOKEN,
+	STMT_CLEAR_PWD_TOKENS,
+	STMT_REMOVE_PWD_TOKEN,
+	STMT_SEED_DEVICE_SEQUENCE,
+	STMT_SET_PWD_RESET_TOKEN,
+	STMT_CHECK_PWD_RESET_TOKEN,
+	STMT_REMOVE_PWD_RESET_TOKEN,
+	STMT_SET_UNVERIFIED_EMAIL,
+	STMT_VERIFIED_EMAIL_TO_EID,
+	STMT_UNVERIFIED_EMAIL_TO_EID,
+	STMT_GET_EMAIL_TOKEN,
+	STMT_VERIFY_EMAIL,
+	STMT_REMOVE_UNVERIFIED_EMAIL,
+	STMT_GET_EIDS_WITH_ASTATE,
+	STMT_GET_APPLICANTS_AFTER,
+	STMT_GET_ASTATE,
+	STMT_SET_ASTATE,
+	STMT_GET_MASTERS,
+	STMT_PING,
+	STMT_LOAD_DIRECTORY,
+	STMT_LOAD_DIRECTORY_ENTRY,
+	STMT_CREATE_SEQUENCES,
+	STMT_RESERVE_IDS,
+	STMT_GET_SEQUENCE,
+	STMT_DELETE_SEQUENCE,
+	STMT_SWEEP_PWD_TOKENS,
+	STMT_SWEEP_PWD_RESET_TOKENS,
+	STMT_GET_EXPIRED_UNVERIFIED_EMAILS,
+	STMT_SWEEP_UNVERIFIED_EMAIL,
+	NUM_STATEMENTS
+};
+
+enum StatementAccess {
+	//Safe to serve from a replica that is within the lag limit
+	ACCESS_READ,
+	//Reads that must see the latest write, such as ID allocation, login tokens and any check a write depends on.
+	//Only a transaction pins reads to the primary, a job run on its own is not in one.
+	ACCESS_READ_PRIMARY,
+	ACCESS_WRITE
+};
+
+struct StatementDef {
+	const char* name;
+	const char* query;
+	StatementAccess access;
+	//Fetch size for selects, array insert size for writes
+	int bufferSize;
+	//False when the statement has no Bind columns and has to be rewound to run again
+	bool hasInput;
+};
+
+/// <summary>
+/// The columns each statement binds and fetches, in order. DBStatements.cpp fails to compile if a
+/// query's placeholders differ from Bind, and DBManager::execute hands callers a StatementStream
+/// that only accepts these types.
+/// </summary>
+template<StatementID ID>
+struct StatementTraits;
+
+template<typename BindColumns, typename FetchColumns>
+struct StatementColumns {
+	typedef BindColumns Bind;
+	typedef FetchColumns Fetch;
+};
+
+typedef std::tuple<> NoColumns;
+
+template<StatementID ID>
+using StatementStream = TypedStream<typename StatementTraits<ID>::Bind, typename StatementTraits<ID>::Fetch>;
+
+template<> struct StatementTraits<STMT_ADD_EMPLOYEE>
+	: StatementColumns<std::tuple<SqlInt, SqlChar<NAME_SIZE>>, NoColumns> {};
+template<> struct StatementTraits<STMT_DELETE_EMPLOYEE>
+	: StatementColumns<std::tuple<SqlInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_SEED_EID_SEQUENCE>
+	: StatementColumns<NoColumns, NoColumns> {};
+template<> struct StatementTraits<STMT_NAME_TO_EID>
+	: StatementColumns<std::tuple<SqlChar<NAME_SIZE>>, std::tuple<SqlInt>> {};
+//The key is compared against names and emails, so it is bound at the larger size everywhere
+typedef std::tuple<SqlInt, SqlChar<NAME_SIZE>, SqlChar<EMAIL_SIZE>, SqlChar<EMAIL_SIZE>, SqlRaw<HASH_SIZE>, SqlRaw<SALT_SIZE>, SqlInt> IdentityColumns;
+template<> struct StatementTraits<STMT_RESOLVE_IDENTITY>
+	: StatementColumns<std::tuple<SqlChar<EMAIL_SIZE>, SqlChar<EMAIL_SIZE>, SqlChar<EMAIL_SIZE>>, IdentityColumns> {};
+template<> struct StatementTraits<STMT_RESOLVE_SIGNUP_IDENTITY>
+	: StatementColumns<std::tuple<SqlChar<EMAIL_SIZE>, SqlChar<EMAIL_SIZE>, SqlChar<EMAIL_SIZE>, SqlChar<EMAIL_SIZE>, SqlChar<EMAIL_SIZE>>, IdentityColumns> {};
+template<> struct StatementTraits<STMT_RESOLVE_SIGNUP_EMAIL>
+	: StatementColumns<std::tuple<SqlChar<EMAIL_SIZE>, SqlChar<EMAIL_SIZE>>, IdentityColumns> {};
+template<> struct StatementTraits<STMT_SET_PWD>
+	: StatementColumns<std::tuple<SqlRaw<HASH_SIZE>, SqlRaw<SALT_SIZE>, SqlInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_GET_PWD_DATA>
+	: StatementColumns<std::tuple<SqlInt>, std::tuple<SqlRaw<HASH_SIZE>, SqlRaw<SALT_SIZE>>> {};
+template<> struct StatementTraits<STMT_SET_PWD_TOKEN>
+	: StatementColumns<std::tuple<SqlInt, SqlInt, SqlRaw<TOKEN_SIZE>, SqlBigInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_SET_PWD_TOKENS>
+	: StatementColumns<std::tuple<SqlInt, SqlInt, SqlRaw<TOKEN_SIZE>, SqlBigInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_GET_PWD_TOKEN>
+	: StatementColumns<std::tuple<SqlInt, SqlInt>, std::tuple<SqlRaw<TOKEN_SIZE>, SqlBigInt>> {};
+template<> struct StatementTraits<STMT_CLEAR_PWD_TOKENS>
+	: StatementColumns<std::tuple<SqlInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_REMOVE_PWD_TOKEN>
+	: StatementColumns<std::tuple<SqlInt, SqlInt, SqlRaw<TOKEN_SIZE>>, NoColumns> {};
+template<> struct StatementTraits<STMT_SEED_DEVICE_SEQUENCE>
+	: StatementColumns<std::tuple<SqlChar<IDSequencer::MAX_NAME_SIZE>, SqlInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_SET_PWD_RESET_TOKEN>
+	: StatementColumns<std::tuple<SqlInt, SqlRaw<TOKEN_SIZE>, SqlBigInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_CHECK_PWD_RESET_TOKEN>
+	: StatementColumns<std::tuple<SqlRaw<TOKEN_SIZE>>, std::tuple<SqlInt, SqlBigInt>> {};
+template<> struct StatementTraits<STMT_REMOVE_PWD_RESET_TOKEN>
+	: StatementColumns<std::tuple<SqlInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_SET_UNVERIFIED_EMAIL>
+	: StatementColumns<std::tuple<SqlInt, SqlChar<EMAIL_SIZE>, SqlRaw<TOKEN_SIZE>, SqlBigInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_VERIFIED_EMAIL_TO_EID>
+	: StatementColumns<std::tuple<SqlChar<EMAIL_SIZE>>, std::tuple<SqlInt>> {};
+template<> struct StatementTraits<STMT_UNVERIFIED_EMAIL_TO_EID>
+	: StatementColumns<std::tuple<SqlChar<EMAIL_SIZE>>, std::tuple<SqlInt>> {};
+template<> struct StatementTraits<STMT_GET_EMAIL_TOKEN>
+	: StatementColumns<std::tuple<SqlInt>, std::tuple<SqlRaw<TOKEN_SIZE>, SqlBigInt>> {};
+template<> struct StatementTraits<STMT_VERIFY_EMAIL>
+	: StatementColumns<std::tuple<SqlChar<EMAIL_SIZE>, SqlInt, SqlInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_REMOVE_UNVERIFIED_EMAIL>
+	: StatementColumns<std::tuple<SqlInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_GET_EIDS_WITH_ASTATE>
+	: StatementColumns<std::tuple<SqlInt>, std::tuple<SqlInt>> {};
+template<> struct StatementTraits<STMT_GET_APPLICANTS_AFTER>
+	: StatementColumns<std::tuple<SqlInt, SqlInt, SqlInt>, std::tuple<SqlInt, SqlInt>> {};
+template<> struct StatementTraits<STMT_GET_ASTATE>
+	: StatementColumns<std::tuple<SqlInt>, std::tuple<SqlInt>> {};
+template<> struct StatementTraits<STMT_SET_ASTATE>
+	: StatementColumns<std::tuple<SqlInt, SqlInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_GET_MASTERS>
+	: StatementColumns<NoColumns, std::tuple<SqlInt>> {};
+template<> struct StatementTraits<STMT_PING>
+	: StatementColumns<NoColumns, std::tuple<SqlInt>> {};
+template<> struct StatementTraits<STMT_LOAD_DIRECTORY>
+	: StatementColumns<NoColumns, std::tuple<SqlInt, SqlChar<NAME_SIZE>, SqlChar<EMAIL_SIZE>, SqlChar<EMAIL_SIZE>>> {};
+template<> struct StatementTraits<STMT_LOAD_DIRECTORY_ENTRY>
+	: StatementColumns<std::tuple<SqlInt>, std::tuple<SqlInt, SqlChar<NAME_SIZE>, SqlChar<EMAIL_SIZE>, SqlChar<EMAIL_SIZE>>> {};
+template<> struct StatementTraits<STMT_CREATE_SEQUENCES>
+	: StatementColumns<NoColumns, NoColumns> {};
+template<> struct StatementTraits<STMT_RESERVE_IDS>
+	: StatementColumns<std::tuple<SqlBigInt, SqlChar<IDSequencer::MAX_NAME_SIZE>>, NoColumns> {};
+template<> struct StatementTraits<STMT_GET_SEQUENCE>
+	: StatementColumns<std::tuple<SqlChar<IDSequencer::MAX_NAME_SIZE>>, std::tuple<SqlBigInt>> {};
+template<> struct StatementTraits<STMT_DELETE_SEQUENCE>
+	: StatementColumns<std::tuple<SqlChar<IDSequencer::MAX_NAME_SIZE>>, NoColumns> {};
+template<> struct StatementTraits<STMT_SWEEP_PWD_TOKENS>
+	: StatementColumns<std::tuple<SqlBigInt, SqlInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_SWEEP_PWD_RESET_TOKENS>
+	: StatementColumns<std::tuple<SqlBigInt, SqlInt>, NoColumns> {};
+template<> struct StatementTraits<STMT_GET_EXPIRED_UNVERIFIED_EMAILS>
+	: StatementColumns<std::tuple<SqlBigInt, SqlInt>, std::tuple<SqlInt, SqlChar<EMAIL_SIZE>>> {};
+template<> struct StatementTraits<STMT_SWEEP_UNVERIFIED_EMAIL>
+	: StatementColumns<std::tuple<SqlInt, SqlBigInt>, NoColumns> {};
+
+/// <summary>
+/// The statement in backendType's SQL dialect, access and buffer sizes are the same for every backend
+/// </summary>
+const StatementDef& GetStatementDef(StatementID statementID, DBBackendType backendType = BACKEND_MYSQL);
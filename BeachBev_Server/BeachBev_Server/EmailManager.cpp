@@ -1,9 +1,13 @@
 #include "EmailManager.h"
 #include "DBManager.h"
+#include "DBPool.h"
+#include "DBExecutor.h"
 #include "CryptoManager.h"
 #include "BB_Client.h"
+#include "RateLimiter.h"
 #include "EmployeeManager.h"
 #include "AcceptManager.h"
+#include "EmployeeDirectory.h"
 #include "Packets/BBPacks.pb.h"
 #include <WSIPacket.h>
 #include <WSOPacket.h>
@@ -25,7 +29,8 @@ void EmailManager::ChangeUnverifiedEmailHandler(const Aws::SES::SESClient * clie
 	ProtobufPackets::PackB1 packB1;
 	packB1.set_success(false);
 	if (outcome.IsSuccess()) {
-		if (setUnverifiedEmail(unverifiedEmailContext->eID, request.GetDestination().GetToAddresses().front(), unverifiedEmailContext->hashedEmailToken, unverifiedEmailContext->dbManager))
+		DBLease dbLease(bbServer->getDBPool());
+		if (setUnverifiedEmail(unverifiedEmailContext->eID, request.GetDestination().GetToAddresses().front(), unverifiedEmailContext->hashedEmailToken, dbLease.get()))
 		{
 			packB1.set_success(true);
 			packB1.set_msg("Email successfully changed");
@@ -56,7 +61,7 @@ void EmailManager::ChangeEmailNotificationHandler(const Aws::SES::SESClient * cl
 }
 
 EmailManager::EmailManager(BB_Server* bbServer, EmployeeManager* employeeManager)
-	:PKeyOwner(), bbServer(bbServer)
+	:PKeyOwner(), bbServer(bbServer), employeeManager(employeeManager)
 {
 	addKey(boost::make_shared<PKey>("B0", this, &EmailManager::handleB0));
 	addKey(boost::make_shared<PKey>("B2", this, &EmailManager::handleB2));
@@ -74,143 +79,173 @@ bool EmailManager::initSESClient()
 
 void EmailManager::handleB0(boost::shared_ptr<IPacket> iPack)
 {
-	ProtobufPackets::PackB0 packB0;
-	packB0.ParseFromString(*iPack->getData());
-	ProtobufPackets::PackB1 replyPacket;
-	replyPacket.set_success(false);
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	if (sender->getEmpID() > 0) {
-		IDType emailEID = verifiedEmailToEID(packB0.email(), dbManager);
-		if (emailEID == 0) {
-			emailEID = unverifiedEmailToEID(packB0.email(), dbManager);
-			if (emailEID == 0 || emailEID == sender->getEmpID()) {
-				BYTE genToken[TOKEN_SIZE];
-				CryptoManager::GenerateRandomData(genToken, TOKEN_SIZE);
-				BYTE* genTokenHash = new BYTE[TOKEN_SIZE];
-				CryptoManager::GenerateHash(genTokenHash, TOKEN_SIZE, genToken, TOKEN_SIZE);
-				std::string urlEncodedEmailToken;
-				CryptoManager::UrlEncode(urlEncodedEmailToken, genToken, TOKEN_SIZE);
+	if (!bbServer->getRateLimiter()->admit<ProtobufPackets::PackB1>(sender, "B0", "B1")) {
+		return;
+	}
+	auto packB0 = boost::make_shared<ProtobufPackets::PackB0>();
+	packB0->ParseFromString(*iPack->getData());
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackB1>();
+	replyPacket->set_success(false);
+	IDType senderID = iPack->getSenderID();
+	IDType senderEID = sender->getEmpID();
+	bbServer->getDBExecutor()->submit(sender, [this, senderID, senderEID, packB0, replyPacket](DBManager* dbManager) {
+		if (senderEID > 0) {
+			IDType emailEID = verifiedEmailToEID(packB0->email(), dbManager);
+			if (emailEID == 0) {
+				emailEID = unverifiedEmailToEID(packB0->email(), dbManager);
+				if (emailEID == 0 || emailEID == senderEID) {
+					BYTE genToken[TOKEN_SIZE];
+					CryptoManager::GenerateRandomData(genToken, TOKEN_SIZE);
+					BYTE* genTokenHash = new BYTE[TOKEN_SIZE];
+					CryptoManager::GenerateHash(genTokenHash, TOKEN_SIZE, genToken, TOKEN_SIZE);
+					std::string urlEncodedEmailToken;
+					CryptoManager::UrlEncode(urlEncodedEmailToken, genToken, TOKEN_SIZE);
 
-				AwsSharedPtr<ChangeUnverifiedEmailContext> changeUnverifiedContext = std::make_shared<ChangeUnverifiedEmailContext>();
-				changeUnverifiedContext->dbManager = dbManager;
-				changeUnverifiedContext->clientID = iPack->getSenderID();
-				changeUnverifiedContext->eID = sender->getEmpID();
-				changeUnverifiedContext->hashedEmailToken = genTokenHash;
+					AwsSharedPtr<ChangeUnverifiedEmailContext> changeUnverifiedContext = std::make_shared<ChangeUnverifiedEmailContext>();
+					changeUnverifiedContext->clientID = senderID;
+					changeUnverifiedContext->eID = senderEID;
+					changeUnverifiedContext->hashedEmailToken = genTokenHash;
 
-				sendVerificationEmail(packB0.email(), urlEncodedEmailToken,
-					std::bind(&EmailManager::ChangeUnverifiedEmailHandler, this, std::placeholders::_1,
-						std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), changeUnverifiedContext);
-				replyPacket.set_success(true);
+					sendVerificationEmail(packB0->email(), urlEncodedEmailToken,
+						std::bind(&EmailManager::ChangeUnverifiedEmailHandler, this, std::placeholders::_1,
+							std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), changeUnverifiedContext);
+					replyPacket->set_success(true);
+				}
+				else
+				{
+					replyPacket->set_msg("This email is already used");
+				}
 			}
 			else
 			{
-				replyPacket.set_msg("This email is already used");
+				replyPacket->set_msg("This email is already used");
 			}
 		}
 		else
 		{
-			replyPacket.set_msg("This email is already used");
+			replyPacket->set_msg("Not logged in");
 		}
-	}
-	else
-	{
-		replyPacket.set_msg("Not logged in");
-	}
-	if (!replyPacket.success()) {
-		boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("B1");
-		oPack->setSenderID(0);
-		oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-		bbServer->getClientManager()->send(oPack, sender);
-	}
+	}, [this, sender, replyPacket](DBJobStatus status) {
+		if (status != DBJobStatus::Completed) {
+			replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
+		}
+		if (!replyPacket->success()) {
+			boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("B1");
+			oPack->setSenderID(0);
+			oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+			bbServer->getClientManager()->send(oPack, sender);
+		}
+	});
 }
 
 void EmailManager::handleB2(boost::shared_ptr<IPacket> iPack)
 {
-	ProtobufPackets::PackB2 packB2;
-	packB2.ParseFromString(*iPack->getData());
-	ProtobufPackets::PackB3 replyPacket;
-	replyPacket.set_success(false);
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	if (sender->getEmpID() > 0) {
-		BYTE dbEmailTokenHash[TOKEN_SIZE];
-		OTL_BIGINT tokenTime;
-		if (getEmailToken(sender->getEmpID(), dbEmailTokenHash, tokenTime, dbManager)) {
-			if (EmployeeManager::CheckInTimeRange(tokenTime, MAX_TOKEN_HOURS)) {
-				std::vector<BYTE> packEmailToken;
-				packEmailToken.reserve(TOKEN_SIZE);
-				CryptoManager::UrlDecode(packEmailToken, packB2.emailtoken());
-				BYTE packEmailTokenHash[TOKEN_SIZE];
-				CryptoManager::GenerateHash(packEmailTokenHash, TOKEN_SIZE, packEmailToken.data(), packEmailToken.size());
-				bool match = true;
-				for (int i = 0; i < TOKEN_SIZE; i++) {
-					if (dbEmailTokenHash[i] != packEmailTokenHash[i]) {
-						match = false;
+	if (!bbServer->getRateLimiter()->admit<ProtobufPackets::PackB3>(sender, "B2", "B3")) {
+		return;
+	}
+	auto packB2 = boost::make_shared<ProtobufPackets::PackB2>();
+	packB2->ParseFromString(*iPack->getData());
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackB3>();
+	replyPacket->set_success(false);
+	IDType senderEID = sender->getEmpID();
+	bbServer->getDBExecutor()->submit(sender, [this, senderEID, packB2, replyPacket](DBManager* dbManager) {
+		if (senderEID > 0) {
+			BYTE dbEmailTokenHash[TOKEN_SIZE];
+			OTL_BIGINT tokenTime;
+			if (getEmailToken(senderEID, dbEmailTokenHash, tokenTime, dbManager)) {
+				if (EmployeeManager::CheckInTimeRange(tokenTime, MAX_TOKEN_HOURS)) {
+					BYTE packEmailToken[TOKEN_SIZE];
+					size_t packEmailTokenSize;
+					CryptoManager::UrlDecode(packEmailToken, packEmailTokenSize, TOKEN_SIZE, packB2->emailtoken());
+					BYTE packEmailTokenHash[TOKEN_SIZE];
+					CryptoManager::GenerateHash(packEmailTokenHash, TOKEN_SIZE, packEmailToken, packEmailTokenSize);
+					bool match = true;
+					for (int i = 0; i < TOKEN_SIZE; i++) {
+						if (dbEmailTokenHash[i] != packEmailTokenHash[i]) {
+							match = false;
+						}
 					}
-				}
-				if (match) {
-					std::string prevEmail;
-					if (getVerifiedEmail(sender->getEmpID(), prevEmail, dbManager)) {
-						sendChangeEmail(prevEmail,
-							std::bind(&EmailManager::ChangeEmailNotificationHandler, this, std::placeholders::_1,
-								std::placeholders::_2, std::placeholders::_3));
+					if (match) {
+						std::string prevEmail;
+						if (getVerifiedEmail(senderEID, prevEmail, dbManager)) {
+							sendChangeEmail(prevEmail,
+								std::bind(&EmailManager::ChangeEmailNotificationHandler, this, std::placeholders::_1,
+									std::placeholders::_2, std::placeholders::_3));
+						}
+						verifyEmail(senderEID, dbManager);
+						replyPacket->set_success(true);
+						replyPacket->set_msg("Email Verified! Goto <a href=\'javascript:document.location.href=\"employee.html?\" + document.location.href\'>employee home</a> to use your account");
+					}
+					else
+					{
+						replyPacket->set_msg("Invalid token");
 					}
-					verifyEmail(sender->getEmpID(), dbManager);
-					replyPacket.set_success(true);
-					replyPacket.set_msg("Email Verified! Goto <a href=\'javascript:document.location.href=\"employee.html?\" + document.location.href\'>employee home</a> to use your account");
 				}
 				else
 				{
-					replyPacket.set_msg("Invalid token");
+					replyPacket->set_msg("Token expired");
 				}
 			}
 			else
 			{
-				replyPacket.set_msg("Token expired");
+				replyPacket->set_msg("The token for this email is already verified, \
+you may be <a href=\'javascript:document.location.href=\"login.html?\" + document.location.href\'>logged into the wrong account.</a>");
 			}
 		}
 		else
 		{
-			replyPacket.set_msg("The token for this email is already verified, \
-you may be <a href=\'javascript:document.location.href=\"login.html?\" + document.location.href\'>logged into the wrong account.</a>");
+			replyPacket->set_msg("Not logged in");
 		}
-	}
-	else
-	{
-		replyPacket.set_msg("Not logged in");
-	}
-	boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("B3");
-	oPack->setSenderID(0);
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+	}, [this, sender, replyPacket](DBJobStatus status) {
+		if (status != DBJobStatus::Completed) {
+			replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
+		}
+		boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("B3");
+		oPack->setSenderID(0);
+		oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+		bbServer->getClientManager()->send(oPack, sender);
+	});
 }
 
 void EmailManager::handleB4(boost::shared_ptr<IPacket> iPack) {
-	ProtobufPackets::PackB5 replyPacket;
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackB5>();
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	if (sender->getEmpID() > 0) {
+	IDType senderEID = sender->getEmpID();
+	auto sendReply = [this, sender, replyPacket]() {
+		boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("B5");
+		oPack->setSenderID(0);
+		oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+		bbServer->getClientManager()->send(oPack, sender);
+	};
+	//Answered from the directory, only an employee missing from it needs a DB job
+	DirectoryEntry entry;
+	if (senderEID <= 0 || employeeManager->getDirectory()->findEntry(senderEID, entry)) {
+		replyPacket->set_verifiedemail(entry.verifiedEmail);
+		replyPacket->set_unverifiedemail(entry.unverifiedEmail);
+		sendReply();
+		return;
+	}
+	bbServer->getDBExecutor()->submit(sender, [this, senderEID, replyPacket](DBManager* dbManager) {
 		std::string verifiedEmail;
-		getVerifiedEmail(sender->getEmpID(), verifiedEmail, dbManager);
+		getVerifiedEmail(senderEID, verifiedEmail, dbManager);
 		std::string unverifiedEmail;
-		getUnverifiedEmail(sender->getEmpID(), unverifiedEmail, dbManager);
-		replyPacket.set_verifiedemail(verifiedEmail);
-		replyPacket.set_unverifiedemail(unverifiedEmail);
-	}
-	boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("B5");
-	oPack->setSenderID(0);
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+		getUnverifiedEmail(senderEID, unverifiedEmail, dbManager);
+		replyPacket->set_verifiedemail(verifiedEmail);
+		replyPacket->set_unverifiedemail(unverifiedEmail);
+	}, [sendReply](DBJobStatus status) {
+		sendReply();
+	});
 }
 
 bool EmailManager::setUnverifiedEmail(IDType eID, Aws::String email, std::string& urlEncodedEmailToken, DBManager * dbManager)
@@ -219,44 +254,34 @@ bool EmailManager::setUnverifiedEmail(IDType eID, Aws::String email, std::string
 	CryptoManager::GenerateRandomData(genToken, TOKEN_SIZE);
 	BYTE genTokenHash[TOKEN_SIZE];
 	CryptoManager::GenerateHash(genTokenHash, TOKEN_SIZE, genToken, TOKEN_SIZE);
-	std::string query = "REPLACE INTO UnverifiedEmails VALUES (:f1<int>, :f2<char[";
-	query += std::to_string(EMAIL_SIZE);
-	query += "]>, :f3<raw[";
-	query += std::to_string(TOKEN_SIZE);
-	query += "]>, :f4<bigint>)";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		otlStream << AwsStrToStr(email);
-		CryptoManager::OutputBytes(otlStream, genTokenHash, TOKEN_SIZE);
-		otlStream << (OTL_BIGINT)(std::time(NULL));
-	}
-	catch (otl_exception ex)
+	if (!dbManager->execute<STMT_SET_UNVERIFIED_EMAIL>([&](StatementStream<STMT_SET_UNVERIFIED_EMAIL>& stmt) {
+		stmt.bind(eID, AwsStrToStr(email), genTokenHash, (OTL_BIGINT)(std::time(NULL)));
+	}))
 	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+		return false;
 	}
+	EmployeeDirectory* employeeDirectory = employeeManager->getDirectory();
+	std::string emailStr = AwsStrToStr(email);
+	dbManager->afterCommit([employeeDirectory, eID, emailStr]() {
+		employeeDirectory->setUnverifiedEmail(eID, emailStr);
+	});
 	CryptoManager::UrlEncode(urlEncodedEmailToken, genToken, TOKEN_SIZE);
 	return true;
 }
 
 bool EmailManager::setUnverifiedEmail(IDType eID, Aws::String email, BYTE* hashedEmailToken, DBManager * dbManager)
 {
-	std::string query = "REPLACE INTO UnverifiedEmails VALUES (:f1<int>, :f2<char[";
-	query += std::to_string(EMAIL_SIZE);
-	query += "]>, :f3<raw[";
-	query += std::to_string(TOKEN_SIZE);
-	query += "]>, :f4<bigint>)";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		otlStream << AwsStrToStr(email);
-		CryptoManager::OutputBytes(otlStream, hashedEmailToken, TOKEN_SIZE);
-		otlStream << (OTL_BIGINT)(std::time(NULL));
-	}
-	catch (otl_exception ex)
+	if (!dbManager->execute<STMT_SET_UNVERIFIED_EMAIL>([&](StatementStream<STMT_SET_UNVERIFIED_EMAIL>& stmt) {
+		stmt.bind(eID, AwsStrToStr(email), hashedEmailToken, (OTL_BIGINT)(std::time(NULL)));
+	}))
 	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+		return false;
 	}
+	EmployeeDirectory* employeeDirectory = employeeManager->getDirectory();
+	std::string emailStr = AwsStrToStr(email);
+	dbManager->afterCommit([employeeDirectory, eID, emailStr]() {
+		employeeDirectory->setUnverifiedEmail(eID, emailStr);
+	});
 	return true;
 }
 
@@ -297,46 +322,38 @@ IDType EmailManager::emailToEID(const std::string & email, DBManager * dbManager
 
 IDType EmailManager::verifiedEmailToEID(const std::string & email, DBManager * dbManager)
 {
-	IDType eID = 0;
-	std::string query = "SELECT eID FROM Employees WHERE email=:f1<char[";
-	query += std::to_string((int)EMAIL_SIZE);
-	query += "]>";
-	try
-	{
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << email;
-		if (!otlStream.eof()) {
-			int eIDInt = 0;
-			otlStream >> eIDInt;
+	IDType eID = employeeManager->getDirectory()->findByVerifiedEmail(email);
+	if (eID != 0) {
+		return eID;
+	}
+	dbManager->execute<STMT_VERIFIED_EMAIL_TO_EID>([&](StatementStream<STMT_VERIFIED_EMAIL_TO_EID>& stmt) {
+		stmt.bind(email);
+		int eIDInt = 0;
+		if (stmt.fetch(eIDInt)) {
 			eID = eIDInt;
 		}
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	});
+	if (eID != 0) {
+		employeeManager->getDirectory()->loadEmployee(eID, dbManager);
 	}
 	return eID;
 }
 
 IDType EmailManager::unverifiedEmailToEID(const std::string & email, DBManager * dbManager)
 {
-	IDType eID = 0;
-	std::string query = "SELECT * FROM UnverifiedEmails WHERE email=:f1<char[";
-	query += std::to_string((int)EMAIL_SIZE);
-	query += "]>";
-	try
-	{
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << email;
-		if (!otlStream.eof()) {
-			int eIDInt = 0;
-			otlStream >> eIDInt;
+	IDType eID = employeeManager->getDirectory()->findByUnverifiedEmail(email);
+	if (eID != 0) {
+		return eID;
+	}
+	dbManager->execute<STMT_UNVERIFIED_EMAIL_TO_EID>([&](StatementStream<STMT_UNVERIFIED_EMAIL_TO_EID>& stmt) {
+		stmt.bind(email);
+		int eIDInt = 0;
+		if (stmt.fetch(eIDInt)) {
 			eID = eIDInt;
 		}
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	});
+	if (eID != 0) {
+		employeeManager->getDirectory()->loadEmployee(eID, dbManager);
 	}
 	return eID;
 }
@@ -351,92 +368,67 @@ bool EmailManager::verifyEmail(IDType eID, DBManager * dbManager)
 	if (!getUnverifiedEmail(eID, unverifiedEmail, dbManager)) {
 		return false;
 	}
-	removeUnverifiedEmail(eID, dbManager);
-	std::string query = "UPDATE Employees SET email=:f1<char[";
-	query += std::to_string(EMAIL_SIZE);
-	query += "]>, aState=:f2<int> WHERE eID=:f3<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << unverifiedEmail;
-		otlStream << AcceptManager::UNACCEPTED_ASTATE;
-		otlStream << (int)eID;
-		return true;
+	DBTransaction transaction(dbManager);
+	if (!transaction.isActive() || !removeUnverifiedEmail(eID, dbManager)) {
+		return false;
 	}
-	catch (otl_exception ex)
+	if (!dbManager->execute<STMT_VERIFY_EMAIL>([&](StatementStream<STMT_VERIFY_EMAIL>& stmt) {
+		stmt.bind(unverifiedEmail, (int)AcceptManager::UNACCEPTED_ASTATE, eID);
+	}))
 	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+		return false;
 	}
-	return false;
+	employeeManager->getAcceptManager()->invalidateDashboard(dbManager);
+	EmployeeDirectory* employeeDirectory = employeeManager->getDirectory();
+	dbManager->afterCommit([employeeDirectory, eID, unverifiedEmail]() {
+		employeeDirectory->verifyEmail(eID, unverifiedEmail);
+	});
+	return transaction.commit();
 }
 
 bool EmailManager::removeUnverifiedEmail(IDType eID, DBManager * dbManager)
 {
-	std::string query = "DELETE FROM UnverifiedEmails WHERE eID = :f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		return true;
-	}
-	catch (otl_exception ex)
+	if (!dbManager->execute<STMT_REMOVE_UNVERIFIED_EMAIL>([&](StatementStream<STMT_REMOVE_UNVERIFIED_EMAIL>& stmt) {
+		stmt.bind(eID);
+	}))
 	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+		return false;
 	}
-	return false;
+	EmployeeDirectory* employeeDirectory = employeeManager->getDirectory();
+	dbManager->afterCommit([employeeDirectory, eID]() {
+		employeeDirectory->removeUnverifiedEmail(eID);
+	});
+	return true;
 }
 
 bool EmailManager::getEmailToken(IDType eID, BYTE * dbEmailTokenHash, OTL_BIGINT& tokenTime, DBManager * dbManager)
 {
-	std::string query = "SELECT tokenHash, tokenTime FROM UnverifiedEmails WHERE eID=:f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		if (!otlStream.eof()) {
-			CryptoManager::InputBytes(otlStream, dbEmailTokenHash, TOKEN_SIZE);
-			otlStream >> tokenTime;
-			return true;
-		}
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
-	}
-	return false;
+	bool found = false;
+	dbManager->execute<STMT_GET_EMAIL_TOKEN>([&](StatementStream<STMT_GET_EMAIL_TOKEN>& stmt) {
+		stmt.bind(eID);
+		found = stmt.fetch(dbEmailTokenHash, tokenTime);
+	});
+	return found;
 }
 
 bool EmailManager::getVerifiedEmail(IDType eID, std::string & email, DBManager * dbManager)
 {
-	std::string query = "SELECT email FROM Employees WHERE eID=:f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		if (!otlStream.eof()) {
-			otlStream >> email;
-			return true;
-		}
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	DirectoryEntry entry;
+	if (!employeeManager->getDirectory()->getEntry(eID, entry, dbManager) || entry.verifiedEmail.empty()) {
+		return false;
 	}
-	return false;
+	email = entry.verifiedEmail;
+	return true;
 }
 
 bool EmailManager::getUnverifiedEmail(IDType eID, std::string & email, DBManager * dbManager)
 {
-	std::string query = "SELECT email FROM UnverifiedEmails WHERE eID=:f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		if (!otlStream.eof()) {
-			otlStream >> email;
-			return true;
-		}
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	DirectoryEntry entry;
+	if (!employeeManager->getDirectory()->getEntry(eID, entry, dbManager) || entry.unverifiedEmail.empty()) {
+		return false;
 	}
-	return false;
+	email = entry.unverifiedEmail;
+	return true;
 }
 
 bool EmailManager::sendVerificationEmail(const std::string& sendToAddress, const std::string& urlEncodedEmailToken, const Aws::SES::SendEmailResponseReceivedHandler& handler, const AwsSharedPtr<const Aws::Client::AsyncCallerContext>& context)
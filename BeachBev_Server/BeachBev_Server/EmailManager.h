@@ -12,7 +12,6 @@ struct ChangeUnverifiedEmailContext : public Aws::Client::AsyncCallerContext
 	IDType clientID;
 	IDType eID;
 	BYTE* hashedEmailToken;
-	DBManager* dbManager;
 
 	~ChangeUnverifiedEmailContext()
 	{
@@ -63,6 +62,9 @@ public:
 	bool sendPwdResetEmail(const std::string& sendToAddress, const std::string& urlEncodedPwdToken, const Aws::SES::SendEmailResponseReceivedHandler& handler, const AwsSharedPtr<const Aws::Client::AsyncCallerContext>& context = nullptr);
 	bool sendChangeEmail(const std::string& sendToAddress, const Aws::SES::SendEmailResponseReceivedHandler& handler, const AwsSharedPtr<const Aws::Client::AsyncCallerContext>& context = nullptr);
 
+	/// <summary>
+	/// Read from the employee directory, false if the employee has no email of that kind
+	/// </summary>
 	bool getVerifiedEmail(IDType eID, std::string& email, DBManager* dbManager);
 	bool getUnverifiedEmail(IDType eID, std::string& email, DBManager* dbManager);
 	~EmailManager();
@@ -0,0 +1,238 @@
+#include "EmployeeDirectory.h"
+#include "DBManager.h"
+#include <mutex>
+
+//Rough per node cost of an unordered_map entry beyond its value: next pointer, cached hash and bucket slot
+static const size_t MAP_NODE_OVERHEAD = 3 * sizeof(void*);
+
+//loadDirectory and loadDirectoryEntry fetch the same columns
+template<typename Stream>
+static bool FetchEntry(Stream& stmt, DirectoryEntry& entry)
+{
+	int eIDInt = 0;
+	if (!stmt.fetch(eIDInt, entry.name, entry.verifiedEmail, entry.unverifiedEmail)) {
+		return false;
+	}
+	entry.eID = eIDInt;
+	return true;
+}
+
+EmployeeDirectory::EmployeeDirectory()
+	:hits(0), misses(0)
+{
+}
+
+bool EmployeeDirectory::load(DBManager * dbManager)
+{
+	std::vector <DirectoryEntry> loadedEntries;
+	bool success = dbManager->execute<STMT_LOAD_DIRECTORY>([&](StatementStream<STMT_LOAD_DIRECTORY>& stmt) {
+		loadedEntries.clear();
+		DirectoryEntry entry;
+		while (FetchEntry(stmt, entry)) {
+			loadedEntries.push_back(entry);
+		}
+	});
+	if (!success) {
+		return false;
+	}
+	boost::unique_lock<boost::shared_mutex> lock(directoryMutex);
+	entries.clear();
+	nameIndex.clear();
+	verifiedEmailIndex.clear();
+	unverifiedEmailIndex.clear();
+	entries.reserve(loadedEntries.size());
+	for (int i = 0; i < loadedEntries.size(); i++) {
+		insertEntry(loadedEntries.at(i));
+	}
+	return true;
+}
+
+bool EmployeeDirectory::getEntry(IDType eID, DirectoryEntry & entry, DBManager * dbManager)
+{
+	if (findEntry(eID, entry)) {
+		return true;
+	}
+	if (!loadEmployee(eID, dbManager)) {
+		return false;
+	}
+	boost::shared_lock<boost::shared_mutex> lock(directoryMutex);
+	auto entryIter = entries.find(eID);
+	if (entryIter == entries.end()) {
+		return false;
+	}
+	entry = entryIter->second;
+	return true;
+}
+
+bool EmployeeDirectory::findEntry(IDType eID, DirectoryEntry & entry)
+{
+	boost::shared_lock<boost::shared_mutex> lock(directoryMutex);
+	auto entryIter = entries.find(eID);
+	if (entryIter == entries.end()) {
+		misses++;
+		return false;
+	}
+	entry = entryIter->second;
+	hits++;
+	return true;
+}
+
+IDType EmployeeDirectory::findByName(const std::string & name)
+{
+	return find(nameIndex, name);
+}
+
+IDType EmployeeDirectory::findByVerifiedEmail(const std::string & email)
+{
+	return find(verifiedEmailIndex, email);
+}
+
+IDType EmployeeDirectory::findByUnverifiedEmail(const std::string & email)
+{
+	return find(unverifiedEmailIndex, email);
+}
+
+bool EmployeeDirectory::loadEmployee(IDType eID, DBManager * dbManager)
+{
+	bool found = false;
+	DirectoryEntry entry;
+	dbManager->execute<STMT_LOAD_DIRECTORY_ENTRY>([&](StatementStream<STMT_LOAD_DIRECTORY_ENTRY>& stmt) {
+		stmt.bind(eID);
+		found = FetchEntry(stmt, entry);
+	});
+	if (found) {
+		boost::unique_lock<boost::shared_mutex> lock(directoryMutex);
+		if (entries.find(eID) == entries.end()) {
+			insertEntry(entry);
+		}
+	}
+	return found;
+}
+
+void EmployeeDirectory::addEmployee(IDType eID, const std::string & name)
+{
+	DirectoryEntry entry;
+	entry.eID = eID;
+	entry.name = name;
+	boost::unique_lock<boost::shared_mutex> lock(directoryMutex);
+	eraseEntry(eID);
+	insertEntry(entry);
+}
+
+void EmployeeDirectory::removeEmployee(IDType eID)
+{
+	boost::unique_lock<boost::shared_mutex> lock(directoryMutex);
+	eraseEntry(eID);
+}
+
+void EmployeeDirectory::setUnverifiedEmail(IDType eID, const std::string & email)
+{
+	boost::unique_lock<boost::shared_mutex> lock(directoryMutex);
+	auto entryIter = entries.find(eID);
+	if (entryIter == entries.end()) {
+		return;
+	}
+	DirectoryEntry entry = entryIter->second;
+	entry.unverifiedEmail = email;
+	eraseEntry(eID);
+	insertEntry(entry);
+}
+
+void EmployeeDirectory::removeUnverifiedEmail(IDType eID)
+{
+	setUnverifiedEmail(eID, "");
+}
+
+void EmployeeDirectory::expireUnverifiedEmail(IDType eID, const std::string & email)
+{
+	boost::unique_lock<boost::shared_mutex> lock(directoryMutex);
+	auto entryIter = entries.find(eID);
+	if (entryIter == entries.end() || entryIter->second.unverifiedEmail != email) {
+		return;
+	}
+	DirectoryEntry entry = entryIter->second;
+	entry.unverifiedEmail.clear();
+	eraseEntry(eID);
+	insertEntry(entry);
+}
+
+void EmployeeDirectory::verifyEmail(IDType eID, const std::string & email)
+{
+	boost::unique_lock<boost::shared_mutex> lock(directoryMutex);
+	auto entryIter = entries.find(eID);
+	if (entryIter == entries.end()) {
+		return;
+	}
+	DirectoryEntry entry = entryIter->second;
+	entry.verifiedEmail = email;
+	eraseEntry(eID);
+	insertEntry(entry);
+}
+
+DirectoryStats EmployeeDirectory::getStats()
+{
+	DirectoryStats stats = DirectoryStats();
+	stats.hits = hits;
+	stats.misses = misses;
+	boost::shared_lock<boost::shared_mutex> lock(directoryMutex);
+	stats.entries = entries.size();
+	stats.memoryBytes = entries.size() * (sizeof(std::pair<const IDType, DirectoryEntry>) + MAP_NODE_OVERHEAD)
+		+ (nameIndex.size() + verifiedEmailIndex.size() + unverifiedEmailIndex.size()) * (sizeof(DirectoryIndex::value_type) + MAP_NODE_OVERHEAD);
+	for (auto entryIter = entries.begin(); entryIter != entries.end(); entryIter++) {
+		const DirectoryEntry& entry = entryIter->second;
+		//Each string is stored once in the entry and once as an index key
+		stats.memoryBytes += 2 * (entry.name.capacity() + entry.verifiedEmail.capacity() + entry.unverifiedEmail.capacity());
+	}
+	return stats;
+}
+
+EmployeeDirectory::~EmployeeDirectory()
+{
+}
+
+IDType EmployeeDirectory::find(const DirectoryIndex & index, const std::string & key)
+{
+	boost::shared_lock<boost::shared_mutex> lock(directoryMutex);
+	auto indexIter = index.find(key);
+	if (indexIter == index.end()) {
+		misses++;
+		return 0;
+	}
+	hits++;
+	return indexIter->second;
+}
+
+void EmployeeDirectory::insertEntry(const DirectoryEntry & entry)
+{
+	entries[entry.eID] = entry;
+	nameIndex[entry.name] = entry.eID;
+	if (!entry.verifiedEmail.empty()) {
+		verifiedEmailIndex[entry.verifiedEmail] = entry.eID;
+	}
+	if (!entry.unverifiedEmail.empty()) {
+		unverifiedEmailIndex[entry.unverifiedEmail] = entry.eID;
+	}
+}
+
+void EmployeeDirectory::eraseEntry(IDType eID)
+{
+	auto entryIter = entries.find(eID);
+	if (entryIter == entries.end()) {
+		return;
+	}
+	const DirectoryEntry& entry = entryIter->second;
+	//Only drop index keys that still point at this employee
+	auto indexIter = nameIndex.find(entry.name);
+	if (indexIter != nameIndex.end() && indexIter->second == eID) {
+		nameIndex.erase(indexIter);
+	}
+	indexIter = verifiedEmailIndex.find(entry.verifiedEmail);
+	if (indexIter != verifiedEmailIndex.end() && indexIter->second == eID) {
+		verifiedEmailIndex.erase(indexIter);
+	}
+	indexIter = unverifiedEmailIndex.find(entry.unverifiedEmail);
+	if (indexIter != unverifiedEmailIndex.end() && indexIter->second == eID) {
+		unverifiedEmailIndex.erase(indexIter);
+	}
+	entries.erase(entryIter);
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include "stdafx.h"
+#include <Macros.h>
+#include <unordered_map>
+#include <string>
+#include <atomic>
+#include <boost/thread/shared_mutex.hpp>
+
+class DBManager;
+
+struct DirectoryEntry {
+	IDType eID;
+	std::string name;
+	//Empty when the employee has none
+	std::string verifiedEmail;
+	std::string unverifiedEmail;
+};
+
+struct DirectoryStats {
+	size_t entries;
+	uint64_t hits;
+	//Lookups that were not in memory and went to the database
+	uint64_t misses;
+	//Estimate of the entries, their strings and the index nodes
+	size_t memoryBytes;
+};
+
+/// <summary>
+/// Process wide copy of every employee's name and emails, indexed by eID, name and email.
+/// Loaded in bulk at startup and kept current by the managers that write those columns.
+/// </summary>
+class EmployeeDirectory
+{
+public:
+	EmployeeDirectory();
+
+	/// <summary>
+	/// Replaces the directory with every row of Employees and UnverifiedEmails
+	/// </summary>
+	bool load(DBManager* dbManager);
+
+	/// <summary>
+	/// Copies the entry for eID, loading that single employee from the database if it is not in memory
+	/// </summary>
+	bool getEntry(IDType eID, DirectoryEntry& entry, DBManager* dbManager);
+
+	/// <summary>
+	/// Memory only version of getEntry, for handlers that answer without a DB job when they can
+	/// </summary>
+	bool findEntry(IDType eID, DirectoryEntry& entry);
+
+	/// <summary>
+	/// Memory only lookups, return 0 if the key is not in the directory
+	/// </summary>
+	IDType findByName(const std::string& name);
+	IDType findByVerifiedEmail(const std::string& email);
+	IDType findByUnverifiedEmail(const std::string& email);
+
+	/// <summary>
+	/// Loads eID from the database, an entry already in memory is kept since write-through updates are newer
+	/// </summary>
+	bool loadEmployee(IDType eID, DBManager* dbManager);
+
+	void addEmployee(IDType eID, const std::string& name);
+	void removeEmployee(IDType eID);
+	void setUnverifiedEmail(IDType eID, const std::string& email);
+	void removeUnverifiedEmail(IDType eID);
+
+	/// <summary>
+	/// Clears eID's unverified email only if it is still email, so an address set after the
+	/// expired row was read is kept
+	/// </summary>
+	void expireUnverifiedEmail(IDType eID, const std::string& email);
+	void verifyEmail(IDType eID, const std::string& email);
+
+	DirectoryStats getStats();
+
+	~EmployeeDirectory();
+
+private:
+	typedef std::unordered_map<std::string, IDType> DirectoryIndex;
+
+	IDType find(const DirectoryIndex& index, const std::string& key);
+	//Callers must hold the lock exclusively
+	void insertEntry(const DirectoryEntry& entry);
+	void eraseEntry(IDType eID);
+
+	std::unordered_map<IDType, DirectoryEntry> entries;
+	DirectoryIndex nameIndex;
+	DirectoryIndex verifiedEmailIndex;
+	DirectoryIndex unverifiedEmailIndex;
+	boost::shared_mutex directoryMutex;
+	std::atomic<uint64_t> hits;
+	std::atomic<uint64_t> misses;
+};
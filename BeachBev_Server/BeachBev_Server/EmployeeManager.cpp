@@ -2,13 +2,21 @@
 #include "Packets/BBPacks.pb.h"
 #include "BB_Server.h"
 #include "DBManager.h"
+#include "DBPool.h"
+#include "DBExecutor.h"
 #include "BB_Client.h"
+#include "RateLimiter.h"
 #include "CryptoManager.h"
 #include "EmailManager.h"
 #include "ResumeManager.h"
 #include "DebugManager.h"
 #include "MasterManager.h"
 #include "AcceptManager.h"
+#include "EmployeeDirectory.h"
+#include "IDSequencer.h"
+#include "PwdTokenWriter.h"
+#include "SessionCache.h"
+#include "TokenSweeper.h"
 #include <WSS_TCPConnection.h>
 #include <WSOPacket.h>
 #include <ClientManager.h>
@@ -30,22 +38,15 @@ void EmployeeManager::CreateAccountEmailHandler(const Aws::SES::SESClient * clie
 {
 	auto createAccountContext = std::static_pointer_cast<const CreateAccountEmailContext>(context);
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(bbServer->getClientManager()->getClient(createAccountContext->clientID));
+	DBLease dbLease(bbServer->getDBPool());
 	if (!outcome.IsSuccess())
 	{
-		std::string query = "DELETE FROM Employees WHERE eID=:f1<int>";
-		try {
-			otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *createAccountContext->dbManager->getConnection());
-			otlStream << (int)createAccountContext->eID;
-		}
-		catch (otl_exception ex)
-		{
-			std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
-		}
+		deleteEmployee(createAccountContext->eID, dbLease.get());
 	}
 	ProtobufPackets::PackA1 replyPacket;
 	if (outcome.IsSuccess()) {
 		if (emailManager->setUnverifiedEmail(createAccountContext->eID, request.GetDestination().GetToAddresses().front(),
-			createAccountContext->hashedEmailToken, createAccountContext->dbManager))
+			createAccountContext->hashedEmailToken, dbLease.get()))
 		{
 			loginClient(sender, createAccountContext->eID);
 			replyPacket.set_pwdtoken(createAccountContext->urlEncodedPwdToken);
@@ -104,7 +105,30 @@ EmployeeManager::EmployeeManager(BB_Server* bbServer)
 	addKey(boost::make_shared<PKey>("A8", this, &EmployeeManager::handleA8));
 	addKey(boost::make_shared<PKey>("C0", this, &EmployeeManager::handleC0));
 	addKey(boost::make_shared<PKey>("C2", this, &EmployeeManager::handleC2));
-	masterManager = new MasterManager(bbServer);
+	employeeDirectory = new EmployeeDirectory();
+	pwdTokenWriter = new PwdTokenWriter(bbServer->getDBPool());
+	sessionCache = new SessionCache();
+	eIDSequencer = new IDSequencer("eID", bbServer->getDBConnectionInformation(), [](DBManager* dbManager) {
+		return dbManager->execute<STMT_SEED_EID_SEQUENCE>([](StatementStream<STMT_SEED_EID_SEQUENCE>& stmt) {
+		});
+	}, bbServer->getDBPool()->getCircuitBreaker());
+	{
+		DBLease dbLease(bbServer->getDBPool());
+		if (!dbLease.get()->createSchema()) {
+			std::cerr << "Could not create the " << dbLease.get()->getBackend()->getName() << " schema" << std::endl;
+		}
+		if (!employeeDirectory->load(dbLease.get())) {
+			std::cerr << "Could not load the employee directory, lookups will fall back to the database" << std::endl;
+		}
+		if (!IDSequencer::CreateTable(dbLease.get())) {
+			std::cerr << "Could not create the Sequences table" << std::endl;
+		}
+		if (!TokenSweeper::CreateIndexes(dbLease.get())) {
+			std::cerr << "Could not index token times, expiry sweeps will scan their tables" << std::endl;
+		}
+	}
+	tokenSweeper = new TokenSweeper(bbServer, employeeDirectory);
+	masterManager = new MasterManager(bbServer, bbServer->getRoleRefreshSeconds());
 	emailManager = new EmailManager(bbServer, this);
 	resumeManager = new ResumeManager(bbServer, emailManager, masterManager);
 	acceptManager = new AcceptManager(bbServer, masterManager, emailManager);
@@ -120,25 +144,44 @@ void EmployeeManager::follow(ClientPtr client)
 
 void EmployeeManager::handleA0(boost::shared_ptr<IPacket> iPack)
 {
-	bool success = false;
-	ProtobufPackets::PackA0 packA0;
-	packA0.ParseFromString(*iPack->getData());
-	ProtobufPackets::PackA1 replyPacket;
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	IDType eID = nameToEID(packA0.name(), dbManager);
-	if (eID <= 0) {
-		eID = emailManager->emailToEID(packA0.name(), dbManager);
-		if (eID <= 0) {
-			eID = emailManager->emailToEID(packA0.email(), dbManager);
-			if (eID <= 0) {
-				eID = addEmployeeToDatabase(packA0.name(), dbManager);
-				setPwd(eID, packA0.pwd(), dbManager);
+	if (!bbServer->getRateLimiter()->admit<ProtobufPackets::PackA1>(sender, "A0", "A1")) {
+		return;
+	}
+	auto packA0 = boost::make_shared<ProtobufPackets::PackA0>();
+	packA0->ParseFromString(*iPack->getData());
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackA1>();
+	//Hashed before the DB job so neither a connection nor a group commit is held through PBKDF2
+	auto pwdHash = boost::make_shared<PwdHash>();
+	bbServer->getCryptoExecutor()->submit(sender, [packA0, pwdHash]() {
+		CryptoManager::HashPwd(*pwdHash, packA0->pwd());
+	}, [this, sender, packA0, replyPacket, pwdHash](CryptoJobStatus status) {
+		if (status != CryptoJobStatus::Completed) {
+			replyPacket->set_msg(CryptoExecutor::GetStatusMsg(status));
+			boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A1");
+			oPack->setSenderID(0);
+			oPack->addSendToID(sender->getID());
+			oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+			bbServer->getClientManager()->send(oPack, sender);
+			return;
+		}
+		auto success = boost::make_shared<bool>(false);
+		bbServer->getDBExecutor()->submit(sender, [this, sender, packA0, replyPacket, success, pwdHash](DBManager* dbManager) {
+			Identity identity;
+			if (!resolveIdentity(packA0->name(), packA0->email(), identity, dbManager)) {
+				replyPacket->set_msg(DBExecutor::GetStatusMsg(DBJobStatus::Failed));
+			}
+			else if (identity.match == MATCH_NONE) {
+				IDType eID = 0;
+				DeviceID devID = 0;
 				std::string urlEncodedPwdToken;
-				DeviceID devID = addPwdToken(eID, urlEncodedPwdToken, dbManager);
+				if (!createEmployee(packA0->name(), *pwdHash, eID, devID, urlEncodedPwdToken, dbManager)) {
+					replyPacket->set_msg("Could not create account");
+					return;
+				}
 
 				BYTE genToken[TOKEN_SIZE];
 				CryptoManager::GenerateRandomData(genToken, TOKEN_SIZE);
@@ -152,291 +195,381 @@ void EmployeeManager::handleA0(boost::shared_ptr<IPacket> iPack)
 				createAccountContext->eID = eID;
 				createAccountContext->deviceID = devID;
 				createAccountContext->hashedEmailToken = genTokenHash;
-				createAccountContext->dbManager = dbManager;
 				createAccountContext->urlEncodedPwdToken = urlEncodedPwdToken;
-				emailManager->sendVerificationEmail(packA0.email(), urlEncodedEmailToken,
-					std::bind(&EmployeeManager::CreateAccountEmailHandler, this, std::placeholders::_1,
-						std::placeholders::_2, std::placeholders::_3, std::placeholders::_4),
-					createAccountContext);
-				success = true;
+				std::string email = packA0->email();
+				//Under group commit the account is only durable once the whole batch commits
+				dbManager->afterCommit([this, email, urlEncodedEmailToken, createAccountContext]() {
+					emailManager->sendVerificationEmail(email, urlEncodedEmailToken,
+						std::bind(&EmployeeManager::CreateAccountEmailHandler, this, std::placeholders::_1,
+							std::placeholders::_2, std::placeholders::_3, std::placeholders::_4),
+						createAccountContext);
+				});
+				*success = true;
+			}
+			else if (identity.match == MATCH_NAME)
+			{
+				replyPacket->set_msg("Name already used");
+			}
+			else if (identity.match == MATCH_SIGNUP_EMAIL)
+			{
+				replyPacket->set_msg("Email already used");
 			}
 			else
 			{
-				replyPacket.set_msg("Email already used");
+				replyPacket->set_msg("Name cannot be a used email");
 			}
-		}
-		else
-		{
-			replyPacket.set_msg("Name cannot be a used email");
-		}
-	}
-	else
-	{
-		replyPacket.set_msg("Name already used");
-	}
-	if (!success) {
-		boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A1");
-		oPack->setSenderID(0);
-		oPack->addSendToID(sender->getID());
-		oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-		bbServer->getClientManager()->send(oPack, sender);
-	}
+		}, [this, sender, replyPacket, success](DBJobStatus status) {
+			if (status != DBJobStatus::Completed) {
+				replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
+			}
+			if (!*success || status != DBJobStatus::Completed) {
+				boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A1");
+				oPack->setSenderID(0);
+				oPack->addSendToID(sender->getID());
+				oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+				bbServer->getClientManager()->send(oPack, sender);
+			}
+		}, true);
+	});
 }
 
 void EmployeeManager::handleA2(boost::shared_ptr<IPacket> iPack)
 {
-	ProtobufPackets::PackA2 packA2;
-	packA2.ParseFromString(*iPack->getData());
-	ProtobufPackets::PackA9 replyPacket;
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	BYTE dbTokenHash[TOKEN_SIZE];
-	OTL_BIGINT tokenTime;
-	if (getPwdToken(packA2.eid(), dbTokenHash, tokenTime, packA2.deviceid(), dbManager)) {
-		if (CheckInTimeRange(tokenTime, MAX_TOKEN_HOURS)) {
-			std::vector<BYTE> packToken;
-			packToken.reserve(TOKEN_SIZE);
-			CryptoManager::UrlDecode(packToken, packA2.pwdtoken());
-			BYTE packTokenHash[TOKEN_SIZE];
-			CryptoManager::GenerateHash(packTokenHash, TOKEN_SIZE, packToken.data(), packToken.size());
-			bool match = true;
-			for (int i = 0; i < TOKEN_SIZE; i++)//Iterate through all to prevent time-based attacks
-			{
-				if (packTokenHash[i] != dbTokenHash[i]) {
-					match = false;
-				}
-			}
-			if (match) {
-				std::string urlEncodedPwdToken;
-				setPwdToken(packA2.eid(), urlEncodedPwdToken, packA2.deviceid(), dbManager);
-				replyPacket.set_pwdtoken(urlEncodedPwdToken);
-				replyPacket.set_eid(packA2.eid());
-				replyPacket.set_deviceid(packA2.deviceid());
-				replyPacket.set_msg("Login successful");
-				loginClient(sender, packA2.eid());
+	if (!bbServer->getRateLimiter()->admit<ProtobufPackets::PackA9>(sender, "A2", "A9")) {
+		return;
+	}
+	auto packA2 = boost::make_shared<ProtobufPackets::PackA2>();
+	packA2->ParseFromString(*iPack->getData());
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackA9>();
+	//Taken before the token is read, so a password reset that lands after the read still revokes this login
+	uint64_t generation = pwdTokenWriter->getGeneration(packA2->eid());
+	//Runs right here for a cached session, otherwise on the DB worker once the token is read
+	auto checkToken = [this, sender, packA2, replyPacket, generation](const BYTE* storedTokenHash, OTL_BIGINT tokenTime) {
+		if (!CheckInTimeRange(tokenTime, MAX_TOKEN_HOURS)) {
+			replyPacket->set_msg("Token expired");
+			return;
+		}
+		BYTE packToken[TOKEN_SIZE];
+		size_t packTokenSize;
+		CryptoManager::UrlDecode(packToken, packTokenSize, TOKEN_SIZE, packA2->pwdtoken());
+		BYTE packTokenHash[TOKEN_SIZE];
+		CryptoManager::GenerateHash(packTokenHash, TOKEN_SIZE, packToken, packTokenSize);
+		bool match = true;
+		for (int i = 0; i < TOKEN_SIZE; i++)//Iterate through all to prevent time-based attacks
+		{
+			if (packTokenHash[i] != storedTokenHash[i]) {
+				match = false;
 			}
-			else
-			{
-				replyPacket.set_msg("Tokens did not match");
+		}
+		if (match) {
+			std::string urlEncodedPwdToken;
+			if (!rotatePwdToken(packA2->eid(), urlEncodedPwdToken, packA2->deviceid(), generation)) {
+				replyPacket->set_msg("Token revoked");
+				return;
 			}
+			replyPacket->set_pwdtoken(urlEncodedPwdToken);
+			replyPacket->set_eid(packA2->eid());
+			replyPacket->set_deviceid(packA2->deviceid());
+			replyPacket->set_msg("Login successful");
+			loginClient(sender, packA2->eid());
 		}
 		else
 		{
-			replyPacket.set_msg("Token expired");
+			replyPacket->set_msg("Tokens did not match");
 		}
+	};
+	auto sendReply = [this, sender, replyPacket]() {
+		boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A9");
+		oPack->setSenderID(0);
+		oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+		bbServer->getClientManager()->send(oPack, sender);
+	};
+	BYTE cachedTokenHash[TOKEN_SIZE];
+	OTL_BIGINT cachedTokenTime;
+	if (sessionCache->find(packA2->eid(), packA2->deviceid(), cachedTokenHash, cachedTokenTime)) {
+		checkToken(cachedTokenHash, cachedTokenTime);
+		sendReply();
+		return;
 	}
-	else
-	{
-		replyPacket.set_msg("Could not aquire a token");
-	}
-	boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A9");
-	oPack->setSenderID(0);
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+	bbServer->getDBExecutor()->submit(sender, [this, packA2, replyPacket, checkToken](DBManager* dbManager) {
+		BYTE dbTokenHash[TOKEN_SIZE];
+		OTL_BIGINT tokenTime;
+		if (getPwdToken(packA2->eid(), dbTokenHash, tokenTime, packA2->deviceid(), dbManager)) {
+			checkToken(dbTokenHash, tokenTime);
+		}
+		else
+		{
+			replyPacket->set_msg("Could not aquire a token");
+		}
+	}, [replyPacket, sendReply](DBJobStatus status) {
+		if (status != DBJobStatus::Completed) {
+			replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
+		}
+		sendReply();
+	});
 }
 
 void EmployeeManager::handleA3(boost::shared_ptr<IPacket> iPack)
 {
-	ProtobufPackets::PackA3 packA3;
-	packA3.ParseFromString(*iPack->getData());
-	ProtobufPackets::PackA1 replyPacket;
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	IDType eID = nameToEID(packA3.name(), dbManager);
-	if (eID <= 0) {
-		eID = emailManager->verifiedEmailToEID(packA3.name(), dbManager);
-		if (eID <= 0) {
-			eID = emailManager->unverifiedEmailToEID(packA3.name(), dbManager);
-			std::string verifiedEmail;
-			if (emailManager->getVerifiedEmail(eID, verifiedEmail, dbManager)) {
-				eID = 0;
+	auto packA3 = boost::make_shared<ProtobufPackets::PackA3>();
+	packA3->ParseFromString(*iPack->getData());
+	//Also per account, so guessing one password from many connections still runs dry
+	if (!bbServer->getRateLimiter()->admit<ProtobufPackets::PackA1>(sender, packA3->name(), "A3", "A1")) {
+		return;
+	}
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackA1>();
+	auto sendReply = [this, sender, replyPacket]() {
+		boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A1");
+		oPack->setSenderID(0);
+		oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+		bbServer->getClientManager()->send(oPack, sender);
+	};
+	//The lookup, the hash and the token write are separate jobs so no connection is held through PBKDF2
+	auto identity = boost::make_shared<Identity>();
+	identity->match = MATCH_NONE;
+	identity->eID = 0;
+	identity->hasPwd = false;
+	bbServer->getDBExecutor()->submit(sender, [this, packA3, identity](DBManager* dbManager) {
+		if (resolveIdentity(packA3->name(), "", *identity, dbManager)) {
+			//An unverified email only logs in until the account has a verified one
+			if (identity->match == MATCH_UNVERIFIED_EMAIL && !identity->verifiedEmail.empty()) {
+				identity->eID = 0;
 			}
 		}
-	}
-	if (eID != 0) {
-		BYTE dbPwdHash[HASH_SIZE];
-		BYTE dbPwdSalt[SALT_SIZE];
-		if (getPwdData(eID, dbPwdHash, dbPwdSalt, dbManager)) {
-			BYTE packPwdHash[HASH_SIZE];
-			CryptoManager::GenerateHash(packPwdHash, HASH_SIZE,
-				(BYTE*)packA3.pwd().data(), packA3.pwd().size(),
-				dbPwdSalt, SALT_SIZE);
-			bool match = true;
-			for (int i = 0; i < HASH_SIZE; i++) {
-				if (packPwdHash[i] != dbPwdHash[i]) {
-					match = false;
-				}
+		else
+		{
+			identity->eID = 0;
+		}
+	}, [this, sender, packA3, replyPacket, identity, sendReply](DBJobStatus status) {
+		if (status != DBJobStatus::Completed) {
+			replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
+			sendReply();
+			return;
+		}
+		if (identity->eID == 0) {
+			replyPacket->set_msg("Invalid login");
+			sendReply();
+			return;
+		}
+		if (!identity->hasPwd) {
+			replyPacket->set_msg("Could not get pwd data from database");
+			sendReply();
+			return;
+		}
+		auto match = boost::make_shared<bool>(false);
+		bbServer->getCryptoExecutor()->submit(sender, [packA3, identity, match]() {
+			*match = CryptoManager::VerifyPwd(packA3->pwd(), identity->pwdHash, identity->pwdSalt);
+		}, [this, sender, packA3, replyPacket, identity, match, sendReply](CryptoJobStatus status) {
+			if (status != CryptoJobStatus::Completed) {
+				replyPacket->set_msg(CryptoExecutor::GetStatusMsg(status));
+				sendReply();
+				return;
 			}
-			if (match) {
+			if (!*match) {
+				replyPacket->set_msg("Invalid login");
+				sendReply();
+				return;
+			}
+			IDType eID = identity->eID;
+			bbServer->getDBExecutor()->submit(sender, [this, sender, packA3, replyPacket, eID](DBManager* dbManager) {
 				std::string urlEncodedPwdToken;
-				DeviceID devID = packA3.deviceid();
+				DeviceID devID = packA3->deviceid();
 				if (devID != 0) {
-					setPwdToken(eID, urlEncodedPwdToken, packA3.deviceid(), dbManager);
+					setPwdToken(eID, urlEncodedPwdToken, packA3->deviceid(), dbManager);
 				}
 				else {
 					devID = addPwdToken(eID, urlEncodedPwdToken, dbManager);
 				}
-				replyPacket.set_pwdtoken(urlEncodedPwdToken);
-				replyPacket.set_eid(eID);
-				replyPacket.set_deviceid(devID);
-				replyPacket.set_msg("Login successful");
+				replyPacket->set_pwdtoken(urlEncodedPwdToken);
+				replyPacket->set_eid(eID);
+				replyPacket->set_deviceid(devID);
+				replyPacket->set_msg("Login successful");
 				loginClient(sender, eID);
-			}
-			else
-			{
-				replyPacket.set_msg("Invalid login");
-			}
-		}
-		else
-		{
-			replyPacket.set_msg("Could not get pwd data from database");
-		}
-	}
-	else
-	{
-		replyPacket.set_msg("Invalid login");
-	}
-	boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A1");
-	oPack->setSenderID(0);
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+			}, [replyPacket, sendReply](DBJobStatus status) {
+				if (status != DBJobStatus::Completed) {
+					replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
+				}
+				sendReply();
+			});
+		});
+	});
 }
 
 void EmployeeManager::handleA4(boost::shared_ptr<IPacket> iPack)
 {
-	ProtobufPackets::PackA4 packA4;
-	packA4.ParseFromString(*iPack->getData());
-	ProtobufPackets::PackA5 replyPacket;
-	replyPacket.set_success(false);
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	IDType eID = 0;
-	IDType unverifiedEID = emailManager->unverifiedEmailToEID(packA4.email(), dbManager);
-	if (unverifiedEID > 0) {
-		std::string verifiedEmail;
-		if (!emailManager->getVerifiedEmail(unverifiedEID, verifiedEmail, dbManager)) {
-			eID = unverifiedEID;
+	auto packA4 = boost::make_shared<ProtobufPackets::PackA4>();
+	packA4->ParseFromString(*iPack->getData());
+	//Also per account, so one inbox cannot be flooded with reset emails from many connections
+	if (!bbServer->getRateLimiter()->admit<ProtobufPackets::PackA5>(sender, packA4->email(), "A4", "A5")) {
+		return;
+	}
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackA5>();
+	replyPacket->set_success(false);
+	IDType senderID = iPack->getSenderID();
+	bbServer->getDBExecutor()->submit(sender, [this, senderID, packA4, replyPacket](DBManager* dbManager) {
+		IDType eID = 0;
+		IDType unverifiedEID = emailManager->unverifiedEmailToEID(packA4->email(), dbManager);
+		if (unverifiedEID > 0) {
+			std::string verifiedEmail;
+			if (!emailManager->getVerifiedEmail(unverifiedEID, verifiedEmail, dbManager)) {
+				eID = unverifiedEID;
+			}
+			else
+			{
+				replyPacket->set_msg("Must used verified email");
+			}
 		}
 		else
 		{
-			replyPacket.set_msg("Must used verified email");
+			eID = emailManager->verifiedEmailToEID(packA4->email(), dbManager);
+			if (eID <= 0) {
+				replyPacket->set_msg("Email not found");
+			}
 		}
-	}
-	else
-	{
-		eID = emailManager->verifiedEmailToEID(packA4.email(), dbManager);
-		if (eID <= 0) {
-			replyPacket.set_msg("Email not found");
+		if (eID > 0) {
+			std::string urlEncodedPwdResetToken;
+			if (setPwdResetToken(eID, urlEncodedPwdResetToken, dbManager))
+			{
+				AwsSharedPtr<PasswordResetContext> pwdResetContext = std::make_shared<PasswordResetContext>();
+				pwdResetContext->clientID = senderID;
+				emailManager->sendPwdResetEmail(packA4->email(), urlEncodedPwdResetToken,
+					std::bind(&EmployeeManager::PwdResetEmailHandler, this, std::placeholders::_1,
+						std::placeholders::_2, std::placeholders::_3, std::placeholders::_4),
+					pwdResetContext);
+				replyPacket->set_success(true);
+			}
+			else
+			{
+				replyPacket->set_msg("Failed to set pwdResetToken");
+			}
 		}
-	}
-	if (eID > 0) {
-		std::string urlEncodedPwdResetToken;
-		if (setPwdResetToken(eID, urlEncodedPwdResetToken, dbManager))
-		{
-			AwsSharedPtr<PasswordResetContext> pwdResetContext = std::make_shared<PasswordResetContext>();
-			pwdResetContext->clientID = iPack->getSenderID();
-			emailManager->sendPwdResetEmail(packA4.email(), urlEncodedPwdResetToken,
-				std::bind(&EmployeeManager::PwdResetEmailHandler, this, std::placeholders::_1,
-					std::placeholders::_2, std::placeholders::_3, std::placeholders::_4),
-				pwdResetContext);
-			replyPacket.set_success(true);
+	}, [this, sender, replyPacket](DBJobStatus status) {
+		if (status != DBJobStatus::Completed) {
+			replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
 		}
-		else
-		{
-			replyPacket.set_msg("Failed to set pwdResetToken");
+		if (!replyPacket->success()) {
+			boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A5");
+			oPack->setSenderID(0);
+			oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+			bbServer->getClientManager()->send(oPack, sender);
 		}
-	}
-	if (!replyPacket.success()) {
-		boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A5");
-		oPack->setSenderID(0);
-		oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-		bbServer->getClientManager()->send(oPack, sender);
-	}
+	});
 }
 
 void EmployeeManager::handleA6(boost::shared_ptr<IPacket> iPack)
 {
-	ProtobufPackets::PackA6 packA6;
-	packA6.ParseFromString(*iPack->getData());
-	ProtobufPackets::PackA7 replyPacket;
-	replyPacket.set_success(false);
+	auto packA6 = boost::make_shared<ProtobufPackets::PackA6>();
+	packA6->ParseFromString(*iPack->getData());
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackA7>();
+	replyPacket->set_success(false);
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	OTL_BIGINT tokenTime;
-	IDType eID = 0;
-	if (checkPwdResetToken(packA6.pwdresettoken(), eID, tokenTime, dbManager)) {
-		if (CheckInTimeRange(tokenTime, MAX_TOKEN_HOURS)) {
-			replyPacket.set_success(true);
-			replyPacket.set_msg("Valid token");
+	bbServer->getDBExecutor()->submit(sender, [this, packA6, replyPacket](DBManager* dbManager) {
+		OTL_BIGINT tokenTime;
+		IDType eID = 0;
+		if (checkPwdResetToken(packA6->pwdresettoken(), eID, tokenTime, dbManager)) {
+			if (CheckInTimeRange(tokenTime, MAX_TOKEN_HOURS)) {
+				replyPacket->set_success(true);
+				replyPacket->set_msg("Valid token");
+			}
+			else
+			{
+				replyPacket->set_msg("Token expired");
+			}
 		}
 		else
 		{
-			replyPacket.set_msg("Token expired");
+			replyPacket->set_msg("Invalid token");
 		}
-	}
-	else
-	{
-		replyPacket.set_msg("Invalid token");
-	}
-	boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A7");
-	oPack->setSenderID(0);
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+	}, [this, sender, replyPacket](DBJobStatus status) {
+		if (status != DBJobStatus::Completed) {
+			replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
+		}
+		boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A7");
+		oPack->setSenderID(0);
+		oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+		bbServer->getClientManager()->send(oPack, sender);
+	});
 }
 
 void EmployeeManager::handleA8(boost::shared_ptr<IPacket> iPack)
 {
-	ProtobufPackets::PackA8 packA8;
-	packA8.ParseFromString(*iPack->getData());
-	ProtobufPackets::PackA1 replyPacket;
 	BB_ClientPtr sender = boost::static_pointer_cast<BB_Client>(iPack->getSender());
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	OTL_BIGINT tokenTime;
-	IDType eID;
-	if (checkPwdResetToken(packA8.pwdresettoken(), eID, tokenTime, dbManager)) {
-		if (CheckInTimeRange(tokenTime, MAX_TOKEN_HOURS)) {
-			if (setPwd(eID, packA8.pwd(), dbManager)) {
-				std::string urlEncodedPwdToken;
-				DeviceID devID = addPwdToken(eID, urlEncodedPwdToken, dbManager);
-				replyPacket.set_pwdtoken(urlEncodedPwdToken);
-				replyPacket.set_eid(eID);
-				replyPacket.set_deviceid(devID);
-				replyPacket.set_msg("Successful");
-				removePwdResetToken(eID, dbManager);
+	if (!bbServer->getRateLimiter()->admit<ProtobufPackets::PackA1>(sender, "A8", "A1")) {
+		return;
+	}
+	auto packA8 = boost::make_shared<ProtobufPackets::PackA8>();
+	packA8->ParseFromString(*iPack->getData());
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackA1>();
+	//Hashed before the DB job so neither a connection nor a group commit is held through PBKDF2
+	auto pwdHash = boost::make_shared<PwdHash>();
+	bbServer->getCryptoExecutor()->submit(sender, [packA8, pwdHash]() {
+		CryptoManager::HashPwd(*pwdHash, packA8->pwd());
+	}, [this, sender, packA8, replyPacket, pwdHash](CryptoJobStatus status) {
+		if (status != CryptoJobStatus::Completed) {
+			replyPacket->set_msg(CryptoExecutor::GetStatusMsg(status));
+			boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A1");
+			oPack->setSenderID(0);
+			oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+			bbServer->getClientManager()->send(oPack, sender);
+			return;
+		}
+		bbServer->getDBExecutor()->submit(sender, [this, packA8, replyPacket, pwdHash](DBManager* dbManager) {
+			OTL_BIGINT tokenTime;
+			IDType eID;
+			if (checkPwdResetToken(packA8->pwdresettoken(), eID, tokenTime, dbManager)) {
+				if (CheckInTimeRange(tokenTime, MAX_TOKEN_HOURS)) {
+					std::string urlEncodedPwdToken;
+					DeviceID devID = 0;
+					if (resetPwd(eID, *pwdHash, devID, urlEncodedPwdToken, dbManager)) {
+						replyPacket->set_pwdtoken(urlEncodedPwdToken);
+						replyPacket->set_eid(eID);
+						replyPacket->set_deviceid(devID);
+						replyPacket->set_msg("Successful");
+					}
+					else
+					{
+						replyPacket->set_msg("Could not set password");
+					}
+				}
+				else
+				{
+					replyPacket->set_msg("Token expired");
+				}
 			}
 			else
 			{
-				replyPacket.set_msg("Could not set password");
+				replyPacket->set_msg("Invalid token");
 			}
-		}
-		else
-		{
-			replyPacket.set_msg("Token expired");
-		}
-	}
-	else
-	{
-		replyPacket.set_msg("Invalid token");
-	}
-	boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A1");
-	oPack->setSenderID(0);
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+		}, [this, sender, replyPacket](DBJobStatus status) {
+			if (status != DBJobStatus::Completed) {
+				//A failed group commit rolls back a reset the job already reported
+				replyPacket->Clear();
+				replyPacket->set_msg(DBExecutor::GetStatusMsg(status));
+			}
+			boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("A1");
+			oPack->setSenderID(0);
+			oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+			bbServer->getClientManager()->send(oPack, sender);
+		}, true);
+	});
 }
 
 void EmployeeManager::handleC0(boost::shared_ptr<IPacket> iPack)
@@ -445,22 +578,34 @@ void EmployeeManager::handleC0(boost::shared_ptr<IPacket> iPack)
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	ProtobufPackets::PackC1 replyPacket;
-	replyPacket.set_name("ERROR");
-	if (masterManager->isMaster(sender->getEmpID(), dbManager)) {
-		ProtobufPackets::PackC0 packC0;
-		packC0.ParseFromString(*iPack->getData());
+	auto packC0 = boost::make_shared<ProtobufPackets::PackC0>();
+	packC0->ParseFromString(*iPack->getData());
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackC1>();
+	replyPacket->set_name("ERROR");
+	auto sendReply = [this, sender, replyPacket]() {
+		boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("C1");
+		oPack->setSenderID(0);
+		oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+		bbServer->getClientManager()->send(oPack, sender);
+	};
+	//Both checks are memory reads, only an employee missing from the directory needs a DB job
+	DirectoryEntry entry;
+	if (!masterManager->isMaster(sender) || employeeDirectory->findEntry(packC0->eid(), entry)) {
+		if (!entry.name.empty()) {
+			replyPacket->set_name(entry.name);
+		}
+		sendReply();
+		return;
+	}
+	bbServer->getDBExecutor()->submit(sender, [this, packC0, replyPacket](DBManager* dbManager) {
 		std::string name;
-		if (eIDToName(packC0.eid(), dbManager, name))
+		if (eIDToName(packC0->eid(), dbManager, name))
 		{
-			replyPacket.set_name(name);
+			replyPacket->set_name(name);
 		}
-	}
-	boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("C1");
-	oPack->setSenderID(0);
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+	}, [sendReply](DBJobStatus status) {
+		sendReply();
+	});
 }
 
 void EmployeeManager::handleC2(boost::shared_ptr<IPacket> iPack)
@@ -469,21 +614,36 @@ void EmployeeManager::handleC2(boost::shared_ptr<IPacket> iPack)
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	ProtobufPackets::PackC3 replyPacket;
-	replyPacket.set_name("ERROR");
-	std::string name;
-	if (eIDToName(sender->getEmpID(), dbManager, name)) {
-		replyPacket.set_name(name);
+	auto replyPacket = boost::make_shared<ProtobufPackets::PackC3>();
+	replyPacket->set_name("ERROR");
+	IDType senderEID = sender->getEmpID();
+	auto sendReply = [this, sender, replyPacket]() {
+		boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("C3");
+		oPack->setSenderID(0);
+		oPack->setData(boost::make_shared<std::string>(replyPacket->SerializeAsString()));
+		bbServer->getClientManager()->send(oPack, sender);
+	};
+	DirectoryEntry entry;
+	if (senderEID == 0 || employeeDirectory->findEntry(senderEID, entry)) {
+		if (!entry.name.empty()) {
+			replyPacket->set_name(entry.name);
+		}
+		sendReply();
+		return;
 	}
-	boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("C3");
-	oPack->setSenderID(0);
-	oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-	bbServer->getClientManager()->send(oPack, sender);
+	bbServer->getDBExecutor()->submit(sender, [this, senderEID, replyPacket](DBManager* dbManager) {
+		std::string name;
+		if (eIDToName(senderEID, dbManager, name)) {
+			replyPacket->set_name(name);
+		}
+	}, [sendReply](DBJobStatus status) {
+		sendReply();
+	});
 }
 
 BB_ClientPtr EmployeeManager::getEmployee(IDType eID)
 {
+	std::lock_guard<std::mutex> lock(employeesMutex);
 	auto it = employees.find(eID);
 	if (it != employees.end())
 	{
@@ -492,290 +652,340 @@ BB_ClientPtr EmployeeManager::getEmployee(IDType eID)
 	return nullptr;
 }
 
-IDType EmployeeManager::addEmployeeToDatabase(const std::string & name, DBManager * dbManager)
+bool EmployeeManager::createEmployee(const std::string & name, const PwdHash & pwdHash, IDType & eID, DeviceID & devID, std::string & urlEncodedPwdToken, DBManager * dbManager)
 {
-	IDType eID = getNextEID(dbManager);
-	std::string query = "INSERT INTO Employees (eID, name) VALUES (:f1<int>, :f2<char[";
-	query += std::to_string(NAME_SIZE);
-	query += "]>)";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		otlStream << name;
+	//Taken outside the transaction, a rolled back signup just leaves a gap in the eIDs
+	eID = getNextEID();
+	if (eID == 0) {
+		return false;
 	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	DBTransaction transaction(dbManager);
+	if (!transaction.isActive() || !addEmployeeToDatabase(eID, name, dbManager) || !setPwd(eID, pwdHash, dbManager)) {
+		return false;
 	}
-	return eID;
+	devID = addPwdToken(eID, urlEncodedPwdToken, dbManager);
+	if (devID == 0) {
+		return false;
+	}
+	return transaction.commit();
 }
 
-bool EmployeeManager::setPwd(IDType eID, const std::string & pwd, DBManager * dbManager)
+//Devices are numbered per employee, so each employee has a row of their own in Sequences
+static std::string DeviceSequenceName(IDType eID)
 {
-	clearPwdTokens(eID, dbManager);
-	BYTE genSalt[SALT_SIZE];
-	CryptoManager::GenerateRandomData(genSalt, SALT_SIZE);
-	BYTE genHash[HASH_SIZE];
-	CryptoManager::GenerateHash(genHash, HASH_SIZE, (BYTE*)pwd.data(), pwd.size(), genSalt, SALT_SIZE);
+	return "device." + std::to_string(eID);
+}
 
-	std::string query = "UPDATE Employees SET pwdHash=:f1<raw[";
-	query += std::to_string(HASH_SIZE);
-	query += "]>, pwdSalt=:f2<raw[";
-	query += std::to_string(SALT_SIZE);
-	query += "]> WHERE eID=:f3<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		CryptoManager::OutputBytes(otlStream, genHash, HASH_SIZE);
-		CryptoManager::OutputBytes(otlStream, genSalt, SALT_SIZE);
-		otlStream << (int)eID;
+bool EmployeeManager::deleteEmployee(IDType eID, DBManager * dbManager)
+{
+	DBTransaction transaction(dbManager);
+	if (!transaction.isActive() || !clearPwdTokens(eID, dbManager)) {
+		return false;
+	}
+	if (!dbManager->execute<STMT_DELETE_EMPLOYEE>([&](StatementStream<STMT_DELETE_EMPLOYEE>& stmt) {
+		stmt.bind(eID);
+	}) || !IDSequencer::Remove(DeviceSequenceName(eID), dbManager))
+	{
+		return false;
 	}
-	catch (otl_exception ex)
+	dbManager->afterCommit([this, eID]() {
+		employeeDirectory->removeEmployee(eID);
+	});
+	acceptManager->invalidateDashboard(dbManager);
+	return transaction.commit();
+}
+
+bool EmployeeManager::addEmployeeToDatabase(IDType eID, const std::string & name, DBManager * dbManager)
+{
+	if (!dbManager->execute<STMT_ADD_EMPLOYEE>([&](StatementStream<STMT_ADD_EMPLOYEE>& stmt) {
+		stmt.bind(eID, name);
+	}))
 	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
 		return false;
 	}
+	dbManager->afterCommit([this, eID, name]() {
+		employeeDirectory->addEmployee(eID, name);
+	});
 	return true;
 }
 
+bool EmployeeManager::resetPwd(IDType eID, const PwdHash & pwdHash, DeviceID & devID, std::string & urlEncodedPwdToken, DBManager * dbManager)
+{
+	DBTransaction transaction(dbManager);
+	if (!transaction.isActive() || !setPwd(eID, pwdHash, dbManager)) {
+		return false;
+	}
+	devID = addPwdToken(eID, urlEncodedPwdToken, dbManager);
+	if (devID == 0 || !removePwdResetToken(eID, dbManager)) {
+		return false;
+	}
+	return transaction.commit();
+}
+
+bool EmployeeManager::setPwd(IDType eID, const PwdHash & pwdHash, DBManager * dbManager)
+{
+	if (!clearPwdTokens(eID, dbManager)) {
+		return false;
+	}
+	return dbManager->execute<STMT_SET_PWD>([&](StatementStream<STMT_SET_PWD>& stmt) {
+		stmt.bind(pwdHash.hash, pwdHash.salt, eID);
+	});
+}
+
 bool EmployeeManager::setPwdToken(IDType eID, std::string& urlEncodedPwdToken, DeviceID devID, DBManager * dbManager)
 {
 	BYTE genToken[TOKEN_SIZE];
 	CryptoManager::GenerateRandomData(genToken, TOKEN_SIZE);
 	BYTE genTokenHash[TOKEN_SIZE];
 	CryptoManager::GenerateHash(genTokenHash, TOKEN_SIZE, genToken, TOKEN_SIZE);
-	std::string query = "REPLACE INTO PwdTokens VALUES (:f1<int>, :f2<int>, :f3<raw[";
-	query += std::to_string(TOKEN_SIZE);
-	query += "]>, :f4<bigint>)";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		otlStream << (int)devID;
-		CryptoManager::OutputBytes(otlStream, genTokenHash, TOKEN_SIZE);
-		otlStream << (OTL_BIGINT)(std::time(NULL));
-	}
-	catch (otl_exception ex)
+	OTL_BIGINT tokenTime = std::time(NULL);
+	if (!dbManager->execute<STMT_SET_PWD_TOKEN>([&](StatementStream<STMT_SET_PWD_TOKEN>& stmt) {
+		stmt.bind(eID, devID, genTokenHash, tokenTime);
+	}))
 	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+		return false;
 	}
+	dbManager->afterCommit([this, eID, devID, genTokenHash, tokenTime]() {
+		sessionCache->put(eID, devID, genTokenHash, tokenTime);
+	});
 	CryptoManager::UrlEncode(urlEncodedPwdToken, genToken, TOKEN_SIZE);
 	return true;
 }
 
-bool EmployeeManager::setPwdResetToken(IDType eID, std::string & urlEncodedPwdResetToken, DBManager * dbManager)
+bool EmployeeManager::rotatePwdToken(IDType eID, std::string & urlEncodedPwdToken, DeviceID devID, uint64_t generation)
 {
 	BYTE genToken[TOKEN_SIZE];
 	CryptoManager::GenerateRandomData(genToken, TOKEN_SIZE);
 	BYTE genTokenHash[TOKEN_SIZE];
 	CryptoManager::GenerateHash(genTokenHash, TOKEN_SIZE, genToken, TOKEN_SIZE);
-	std::string query = "REPLACE INTO PwdResetTokens VALUES (:f1<int>, :f2<raw[";
-	query += std::to_string(TOKEN_SIZE);
-	query += "]>, :f3<bigint>)";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		CryptoManager::OutputBytes(otlStream, genTokenHash, TOKEN_SIZE);
-		otlStream << (OTL_BIGINT)(std::time(NULL));
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	OTL_BIGINT tokenTime = std::time(NULL);
+	//Cached before queueing, a clear that lands in between bumps the generation so queue turns it away.
+	//The other order could cache the token after the clear's hook already removed the session.
+	sessionCache->put(eID, devID, genTokenHash, tokenTime);
+	if (!pwdTokenWriter->queue(eID, devID, genTokenHash, tokenTime, generation)) {
+		sessionCache->remove(eID);
+		return false;
 	}
+	CryptoManager::UrlEncode(urlEncodedPwdToken, genToken, TOKEN_SIZE);
+	return true;
+}
+
+bool EmployeeManager::setPwdResetToken(IDType eID, std::string & urlEncodedPwdResetToken, DBManager * dbManager)
+{
+	BYTE genToken[TOKEN_SIZE];
+	CryptoManager::GenerateRandomData(genToken, TOKEN_SIZE);
+	BYTE genTokenHash[TOKEN_SIZE];
+	CryptoManager::GenerateHash(genTokenHash, TOKEN_SIZE, genToken, TOKEN_SIZE);
+	dbManager->execute<STMT_SET_PWD_RESET_TOKEN>([&](StatementStream<STMT_SET_PWD_RESET_TOKEN>& stmt) {
+		stmt.bind(eID, genTokenHash, (OTL_BIGINT)(std::time(NULL)));
+	});
 	CryptoManager::UrlEncode(urlEncodedPwdResetToken, genToken, TOKEN_SIZE);
 	return true;
 }
 
 bool EmployeeManager::clearPwdTokens(IDType eID, DBManager * dbManager)
 {
-	std::string query = "DELETE FROM PwdTokens WHERE eID=:f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-	}
-	catch (otl_exception ex)
+	//Dropped now so no A2 is served from memory while the DELETE is pending, and again once it
+	//commits in case an A2 that read the old rows meanwhile rotated a token back in
+	pwdTokenWriter->discard(eID);
+	sessionCache->remove(eID);
+	if (!dbManager->execute<STMT_CLEAR_PWD_TOKENS>([&](StatementStream<STMT_CLEAR_PWD_TOKENS>& stmt) {
+		stmt.bind(eID);
+	}))
 	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+		return false;
 	}
+	dbManager->afterCommit([this, eID]() {
+		pwdTokenWriter->discard(eID);
+		sessionCache->remove(eID);
+	});
+	return true;
 }
 
 DeviceID EmployeeManager::addPwdToken(IDType eID, std::string & urlEncodedPwdToken, DBManager * dbManager)
 {
 	DeviceID devID = getNextDeviceID(eID, dbManager);
-	setPwdToken(eID, urlEncodedPwdToken, devID, dbManager);
+	if (devID == 0 || !setPwdToken(eID, urlEncodedPwdToken, devID, dbManager)) {
+		return 0;
+	}
 	return devID;
 }
 
 DeviceID EmployeeManager::getNextDeviceID(IDType eID, DBManager * dbManager)
 {
-	DeviceID devID = 0;
-	std::string query = "SELECT deviceID FROM PwdTokens WHERE eID=:f1<int> ORDER BY deviceID desc limit 1";
-	try
+	//Reserved one ID at a time, an employee only adds a device now and then
+	std::string sequenceName = DeviceSequenceName(eID);
+	int64_t devID = 0;
+	if (!IDSequencer::Reserve(sequenceName, 1, devID, dbManager, [&](DBManager* dbManager) {
+		return dbManager->execute<STMT_SEED_DEVICE_SEQUENCE>([&](StatementStream<STMT_SEED_DEVICE_SEQUENCE>& stmt) {
+			stmt.bind(sequenceName, eID);
+		});
+	}))
 	{
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		if (!otlStream.eof())
-		{
-			int devInt = 0;
-			otlStream >> devInt;
-			devID = devInt;
-		}
+		return 0;
 	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
-	}
-	return devID + 1;
+	return (DeviceID)devID;
 }
 
 IDType EmployeeManager::nameToEID(const std::string& name, DBManager* dbManager)
 {
-	IDType eID = 0;
-	std::string query = "SELECT eID FROM Employees WHERE name=:f1<char[";
-	query += std::to_string((int)NAME_SIZE);
-	query += "]>";
-	try
-	{
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << name;
-		if (!otlStream.eof()) {
-			int eIDInt = 0;
-			otlStream >> eIDInt;
+	IDType eID = employeeDirectory->findByName(name);
+	if (eID != 0) {
+		return eID;
+	}
+	dbManager->execute<STMT_NAME_TO_EID>([&](StatementStream<STMT_NAME_TO_EID>& stmt) {
+		stmt.bind(name);
+		int eIDInt = 0;
+		if (stmt.fetch(eIDInt)) {
 			eID = eIDInt;
 		}
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	});
+	if (eID != 0) {
+		employeeDirectory->loadEmployee(eID, dbManager);
 	}
 	return eID;
 }
 
-IDType EmployeeManager::getNextEID(DBManager* dbManager)
+//The resolveIdentity statements all fetch the same columns
+template<typename Stream>
+static void FetchIdentity(Stream& stmt, Identity& identity)
 {
-	IDType eID = 0;
-	std::string query = "SELECT * FROM Employees ORDER BY eID desc limit 1";
-	try
+	int eIDInt = 0;
+	int matchRank = MATCH_NONE;
+	if (stmt.fetch(eIDInt, identity.name, identity.verifiedEmail, identity.unverifiedEmail,
+		identity.pwdHash, identity.pwdSalt, matchRank))
 	{
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		dbManager->getConnection()->commit();
-		if (!otlStream.eof())
-		{
-			int eIDInt = 0;
-			otlStream >> eIDInt;
-			eID = eIDInt;
-		}
+		identity.eID = eIDInt;
+		//pwdHash, a null hash means the password was never set
+		identity.hasPwd = !stmt.isNull(4);
+		identity.match = (IdentityMatch)matchRank;
 	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+}
+
+bool EmployeeManager::resolveIdentity(const std::string & key, const std::string & signupEmail, Identity & identity, DBManager * dbManager)
+{
+	identity.match = MATCH_NONE;
+	identity.eID = 0;
+	identity.hasPwd = false;
+	//An empty key would match every employee whose column is empty, so its lookups are left out
+	if (!key.empty() && !signupEmail.empty()) {
+		return dbManager->execute<STMT_RESOLVE_SIGNUP_IDENTITY>([&](StatementStream<STMT_RESOLVE_SIGNUP_IDENTITY>& stmt) {
+			stmt.bind(key, key, key, signupEmail, signupEmail);
+			FetchIdentity(stmt, identity);
+		});
+	}
+	if (!key.empty()) {
+		return dbManager->execute<STMT_RESOLVE_IDENTITY>([&](StatementStream<STMT_RESOLVE_IDENTITY>& stmt) {
+			stmt.bind(key, key, key);
+			FetchIdentity(stmt, identity);
+		});
+	}
+	if (!signupEmail.empty()) {
+		return dbManager->execute<STMT_RESOLVE_SIGNUP_EMAIL>([&](StatementStream<STMT_RESOLVE_SIGNUP_EMAIL>& stmt) {
+			stmt.bind(signupEmail, signupEmail);
+			FetchIdentity(stmt, identity);
+		});
 	}
-	return eID + 1;
+	return true;
+}
+
+IDType EmployeeManager::getNextEID()
+{
+	return (IDType)eIDSequencer->next();
 }
 
 bool EmployeeManager::getPwdData(IDType eID, BYTE * hash, BYTE * salt, DBManager * dbManager)
 {
-	std::string query = "SELECT pwdHash, pwdSalt FROM Employees WHERE eID = :f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		if (!otlStream.eof()) {
-			CryptoManager::InputBytes(otlStream, hash, HASH_SIZE);
-			CryptoManager::InputBytes(otlStream, salt, SALT_SIZE);
-			return true;
-		}
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
-	}
-	return false;
+	bool found = false;
+	dbManager->execute<STMT_GET_PWD_DATA>([&](StatementStream<STMT_GET_PWD_DATA>& stmt) {
+		stmt.bind(eID);
+		found = stmt.fetch(hash, salt);
+	});
+	return found;
 }
 
 bool EmployeeManager::getPwdToken(IDType eID, BYTE * databaseTokenHash, OTL_BIGINT& tokenTime, DeviceID devID, DBManager * dbManager)
 {
-	std::string query = "SELECT tokenHash, tokenTime FROM PwdTokens WHERE eID = :f1<int> AND deviceID = :f2<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		otlStream << (int)devID;
-		if (!otlStream.eof()) {
-			CryptoManager::InputBytes(otlStream, databaseTokenHash, TOKEN_SIZE);
-			otlStream >> tokenTime;
-			return true;
-		}
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	//A rotation that has not been written yet is newer than the row
+	if (pwdTokenWriter->find(eID, devID, databaseTokenHash, tokenTime)) {
+		return true;
 	}
-	return false;
+	bool found = false;
+	dbManager->execute<STMT_GET_PWD_TOKEN>([&](StatementStream<STMT_GET_PWD_TOKEN>& stmt) {
+		stmt.bind(eID, devID);
+		found = stmt.fetch(databaseTokenHash, tokenTime);
+	});
+	return found;
 }
 
 bool EmployeeManager::checkPwdResetToken(const std::string& urlEncodedPwdResetToken, IDType& eID, OTL_BIGINT& tokenTime, DBManager * dbManager)
 {
-	std::vector <BYTE> pwdResetToken;
-	pwdResetToken.reserve(TOKEN_SIZE);
-	CryptoManager::UrlDecode(pwdResetToken, urlEncodedPwdResetToken);
+	BYTE pwdResetToken[TOKEN_SIZE];
+	size_t pwdResetTokenSize;
+	CryptoManager::UrlDecode(pwdResetToken, pwdResetTokenSize, TOKEN_SIZE, urlEncodedPwdResetToken);
 	BYTE pwdResetTokenHash[TOKEN_SIZE];
-	CryptoManager::GenerateHash(pwdResetTokenHash, TOKEN_SIZE, pwdResetToken.data(), pwdResetToken.size());
-	std::string query = "SELECT eID, tokenTime FROM PwdResetTokens WHERE tokenHash=:f1<raw[";
-	query += std::to_string(TOKEN_SIZE);
-	query += "]>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		CryptoManager::OutputBytes(otlStream, pwdResetTokenHash, TOKEN_SIZE);
-		if (!otlStream.eof()) {
-			int eIDInt = 0;
-			otlStream >> eIDInt;
+	CryptoManager::GenerateHash(pwdResetTokenHash, TOKEN_SIZE, pwdResetToken, pwdResetTokenSize);
+	bool found = false;
+	dbManager->execute<STMT_CHECK_PWD_RESET_TOKEN>([&](StatementStream<STMT_CHECK_PWD_RESET_TOKEN>& stmt) {
+		stmt.bind(pwdResetTokenHash);
+		int eIDInt = 0;
+		if (stmt.fetch(eIDInt, tokenTime)) {
 			eID = (IDType)eIDInt;
-			otlStream >> tokenTime;
-			return true;
+			found = true;
 		}
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
-	}
-	return false;
+	});
+	return found;
 }
 
 bool EmployeeManager::removePwdResetToken(IDType eID, DBManager * dbManager)
 {
-	std::string query = "DELETE FROM PwdResetTokens WHERE eID=:f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		return true;
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
-	}
-	return false;
+	return dbManager->execute<STMT_REMOVE_PWD_RESET_TOKEN>([&](StatementStream<STMT_REMOVE_PWD_RESET_TOKEN>& stmt) {
+		stmt.bind(eID);
+	});
 }
 
 void EmployeeManager::loginClient(BB_ClientPtr bbClient, IDType eID)
 {
+	//The SES callback's client may have disconnected while the email was sent
+	if (bbClient == nullptr) {
+		return;
+	}
 	bbClient->setEmpID(eID);
+	masterManager->stampRole(bbClient);
+	std::lock_guard<std::mutex> lock(employeesMutex);
 	employees.emplace(std::make_pair(eID, bbClient));
 }
 
 bool EmployeeManager::eIDToName(IDType eID, DBManager * dbManager, std::string & name)
 {
-	std::string query = "SELECT name FROM Employees WHERE eID=:f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		if (!otlStream.eof()) {
-			otlStream >> name;
-			return true;
-		}
-	}
-	catch (otl_exception ex)
-	{
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	DirectoryEntry entry;
+	if (!employeeDirectory->getEntry(eID, entry, dbManager)) {
+		return false;
 	}
+	name = entry.name;
+	return true;
 }
 
 EmployeeManager::~EmployeeManager()
 {
+	if (tokenSweeper != nullptr) {
+		delete tokenSweeper;
+		tokenSweeper = nullptr;
+	}
+	if (pwdTokenWriter != nullptr) {
+		delete pwdTokenWriter;
+		pwdTokenWriter = nullptr;
+	}
+	if (sessionCache != nullptr) {
+		delete sessionCache;
+		sessionCache = nullptr;
+	}
+	if (employeeDirectory != nullptr) {
+		delete employeeDirectory;
+		employeeDirectory = nullptr;
+	}
+	if (eIDSequencer != nullptr) {
+		delete eIDSequencer;
+		eIDSequencer = nullptr;
+	}
 }
@@ -1,9 +1,11 @@
 #pragma once
 #include "stdafx.h"
+#include "DBStatements.h"
 #include <Macros.h>
 #include <PKeyOwner.h>
 #include <WSIPacket.h>
 #include <unordered_map>
+#include <mutex>
 #include <base64_converter.h>
 #include <string>
 #include <aws/email/SESClient.h>
@@ -18,22 +20,44 @@ class EmailManager;
 class ResumeManager;
 class MasterManager;
 class AcceptManager;
+class EmployeeDirectory;
+class IDSequencer;
+class PwdTokenWriter;
+class TokenSweeper;
+class SessionCache;
+struct PwdHash;
 typedef uint16_t DeviceID;
 
-static const int TOKEN_SIZE = 64;
-static const int HASH_SIZE = 64;
-static const int SALT_SIZE = 32;
-static const int NAME_SIZE = 50;
-static const int EMAIL_SIZE = 254;
 static const int MAX_TOKEN_HOURS = 24;
 
+//Ordered the same way login and signup check for conflicts
+enum IdentityMatch {
+	MATCH_NONE,
+	MATCH_NAME,
+	MATCH_VERIFIED_EMAIL,
+	MATCH_UNVERIFIED_EMAIL,
+	//Only the signup email matched a verified or unverified email
+	MATCH_SIGNUP_EMAIL
+};
+
+struct Identity {
+	IdentityMatch match;
+	IDType eID;
+	std::string name;
+	//Empty if the employee has not verified an email
+	std::string verifiedEmail;
+	std::string unverifiedEmail;
+	bool hasPwd;
+	BYTE pwdHash[HASH_SIZE];
+	BYTE pwdSalt[SALT_SIZE];
+};
+
 struct CreateAccountEmailContext : public Aws::Client::AsyncCallerContext
 {
 	IDType eID;
 	IDType clientID;
 	DeviceID deviceID;
 	BYTE* hashedEmailToken;
-	DBManager* dbManager;
 	std::string urlEncodedPwdToken;
 	~CreateAccountEmailContext()
 	{
@@ -76,7 +100,8 @@ public:
 	void handleA0(boost::shared_ptr<IPacket> iPack);
 
 	/// <summary>
-	/// Logs in an employee using the pwdToken, replies with A1
+	/// Logs in an employee using the pwdToken, replies with A9. A device in the session cache
+	/// is checked straight away without a DB job.
 	/// </summary>
 	/// <param name="iPack">The input packet containing data
 	/// for protobuf packet A2.</param>
@@ -116,33 +141,96 @@ public:
 
 	BB_ClientPtr getEmployee(IDType eID);
 
-	std::unordered_map<IDType, ClientPtr> employees;
+	/// <summary>
+	/// Adds the employee, its password and a first pwdToken in one transaction
+	/// </summary>
+	/// <returns>False if any step failed, nothing is left in the database in that case</returns>
+	bool createEmployee(const std::string& name, const PwdHash& pwdHash, IDType& eID, DeviceID& devID, std::string& urlEncodedPwdToken, DBManager* dbManager);
+
+	/// <summary>
+	/// Removes the employee and its pwdTokens
+	/// </summary>
+	bool deleteEmployee(IDType eID, DBManager* dbManager);
+
+	MasterManager* getMasterManager() {
+		return masterManager;
+	}
+
+	AcceptManager* getAcceptManager() {
+		return acceptManager;
+	}
+
+	EmployeeDirectory* getDirectory() {
+		return employeeDirectory;
+	}
+
+	PwdTokenWriter* getPwdTokenWriter() {
+		return pwdTokenWriter;
+	}
+
+	SessionCache* getSessionCache() {
+		return sessionCache;
+	}
+
+	TokenSweeper* getTokenSweeper() {
+		return tokenSweeper;
+	}
 
 	~EmployeeManager();
 
 protected:
-	IDType addEmployeeToDatabase(const std::string& name, DBManager* dbManager);
-	bool setPwd(IDType eID, const std::string& pwd, DBManager* dbManager);
+	bool addEmployeeToDatabase(IDType eID, const std::string& name, DBManager* dbManager);
+
+	/// <summary>
+	/// Sets the password, issues a new pwdToken and consumes the reset token in one transaction
+	/// </summary>
+	bool resetPwd(IDType eID, const PwdHash& pwdHash, DeviceID& devID, std::string& urlEncodedPwdToken, DBManager* dbManager);
+	bool setPwd(IDType eID, const PwdHash& pwdHash, DBManager* dbManager);
 	bool setPwdToken(IDType eID, std::string& urlEncodedPwdToken, DeviceID deviceID, DBManager* dbManager);
+
+	/// <summary>
+	/// Issues a new pwdToken for an existing device, written behind by pwdTokenWriter
+	/// </summary>
+	/// <param name="generation">pwdTokenWriter's stamp from before the old token was read</param>
+	/// <returns>False if the employee's pwdTokens were cleared since the stamp, nothing is issued then</returns>
+	bool rotatePwdToken(IDType eID, std::string& urlEncodedPwdToken, DeviceID deviceID, uint64_t generation);
 	bool setPwdResetToken(IDType eID, std::string& urlEncodedPwdResetToken, DBManager* dbManager);
 	bool clearPwdTokens(IDType eID, DBManager* dbManager);
 	DeviceID addPwdToken(IDType eID, std::string& urlEncodedPwdToken, DBManager* dbManager);
 	DeviceID getNextDeviceID(IDType eID, DBManager* dbManager);
 	IDType nameToEID(const std::string & name, DBManager * dbManager);
-	IDType getNextEID(DBManager* dbManager);
+
+	/// <summary>
+	/// Finds the employee key refers to in one query, trying it as a name, then a verified email,
+	/// then an unverified email. signupEmail is only tried as an email, pass an empty string to skip it.
+	/// </summary>
+	/// <returns>False if the query failed, identity.match is MATCH_NONE if nothing matched</returns>
+	bool resolveIdentity(const std::string& key, const std::string& signupEmail, Identity& identity, DBManager* dbManager);
+	IDType getNextEID();
 
 	bool getPwdData(IDType eID, BYTE* hash, BYTE* salt, DBManager* dbManager);
 	bool getPwdToken(IDType eID, BYTE* databaseTokenHash, OTL_BIGINT& tokenTime, DeviceID devID, DBManager* dbManager);
 	bool checkPwdResetToken(const std::string& urlEncodedPwdToken, IDType& eID, OTL_BIGINT& tokenTime, DBManager* dbManager);
 
 	bool removePwdResetToken(IDType eID, DBManager* dbManager);
+	/// <summary>
+	/// Safe from any thread
+	/// </summary>
 	void loginClient(BB_ClientPtr bbClient, IDType eID);
 
 	bool eIDToName(IDType eID, DBManager* dbManager, std::string& name);
 	
 	AcceptManager* acceptManager;
+	EmployeeDirectory* employeeDirectory;
+	IDSequencer* eIDSequencer;
+	PwdTokenWriter* pwdTokenWriter;
+	SessionCache* sessionCache;
+	TokenSweeper* tokenSweeper;
 	EmailManager* emailManager;
 	MasterManager* masterManager;
 	ResumeManager* resumeManager;
 	BB_Server* bbServer;
+	//Logins come from DB workers, io threads and SES callbacks
+	std::unordered_map<IDType, ClientPtr> employees;
+	std::mutex employeesMutex;
 };
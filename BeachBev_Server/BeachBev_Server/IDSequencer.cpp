@@ -0,0 +1,94 @@
+#include "IDSequencer.h"
+#include "DBManager.h"
+
+bool IDSequencer::CreateTable(DBManager * dbManager)
+{
+	return dbManager->execute<STMT_CREATE_SEQUENCES>([](StatementStream<STMT_CREATE_SEQUENCES>& stmt) {
+	});
+}
+
+bool IDSequencer::Reserve(const std::string & name, int count, int64_t & first, DBManager * dbManager, const SequenceSeeder & seeder)
+{
+	//Nested in the caller's transaction as a savepoint when there is one
+	DBTransaction transaction(dbManager);
+	if (!transaction.isActive()) {
+		return false;
+	}
+	long rowsUpdated = 0;
+	for (int attempt = 0; attempt < 2 && rowsUpdated == 0; attempt++) {
+		if (attempt > 0 && !seeder(dbManager)) {
+			return false;
+		}
+		if (!dbManager->execute<STMT_RESERVE_IDS>([&](StatementStream<STMT_RESERVE_IDS>& stmt) {
+			stmt.bind(count, name);
+			rowsUpdated = stmt.getRowsAffected();
+		}))
+		{
+			return false;
+		}
+	}
+	if (rowsUpdated == 0) {
+		return false;
+	}
+	//No other connection can move the row until this transaction ends, so this is the value the update set
+	OTL_BIGINT blockEnd = 0;
+	if (!dbManager->execute<STMT_GET_SEQUENCE>([&](StatementStream<STMT_GET_SEQUENCE>& stmt) {
+		stmt.bind(name);
+		stmt.fetch(blockEnd);
+	}) || blockEnd <= 0)
+	{
+		return false;
+	}
+	if (!transaction.commit()) {
+		return false;
+	}
+	first = blockEnd - count;
+	return true;
+}
+
+bool IDSequencer::Remove(const std::string & name, DBManager * dbManager)
+{
+	return dbManager->execute<STMT_DELETE_SEQUENCE>([&](StatementStream<STMT_DELETE_SEQUENCE>& stmt) {
+		stmt.bind(name);
+	});
+}
+
+IDSequencer::IDSequencer(const std::string & name, const ConnectionInformation & conInfo, const SequenceSeeder & seeder, CircuitBreaker* circuitBreaker, int blockSize)
+	:name(name), seeder(seeder), blockSize(blockSize), nextID(0), blockEnd(0)
+{
+	dbManager = new DBManager();
+	dbManager->setCircuitBreaker(circuitBreaker);
+	dbManager->connect(conInfo);
+}
+
+int64_t IDSequencer::next()
+{
+	while (true) {
+		int64_t id = nextID;
+		while (id < blockEnd) {
+			if (nextID.compare_exchange_weak(id, id + 1)) {
+				return id;
+			}
+		}
+		std::lock_guard<std::mutex> lock(refillMutex);
+		if (nextID < blockEnd) {
+			//Another thread refilled while this one waited
+			continue;
+		}
+		int64_t first = 0;
+		if (!Reserve(name, blockSize, first, dbManager, seeder)) {
+			return 0;
+		}
+		//nextID is moved before blockEnd so no thread sees the new end with an old ID
+		nextID = first;
+		blockEnd = first + blockSize;
+	}
+}
+
+IDSequencer::~IDSequencer()
+{
+	if (dbManager != nullptr) {
+		delete dbManager;
+		dbManager = nullptr;
+	}
+}
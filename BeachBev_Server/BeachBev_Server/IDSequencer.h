@@ -0,0 +1,61 @@
+#pragma once
+#include "stdafx.h"
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <functional>
+
+class DBManager;
+class CircuitBreaker;
+struct ConnectionInformation;
+
+//Inserts the sequence's row if it is missing, starting it past any ID already in use
+typedef std::function<bool(DBManager*)> SequenceSeeder;
+
+/// <summary>
+/// Hands out IDs from blocks reserved in the Sequences table. The table holds the first ID
+/// not yet reserved so a restart skips the rest of any block it had in memory instead of reusing it.
+/// Blocks are reserved on the sequencer's own connection so a caller's transaction rolling back
+/// can never undo a reservation whose IDs are already being handed out.
+/// </summary>
+class IDSequencer
+{
+public:
+	static const int DEFAULT_BLOCK_SIZE = 32;
+	static const int MAX_NAME_SIZE = 32;
+
+	static bool CreateTable(DBManager* dbManager);
+
+	/// <summary>
+	/// Atomically moves name's sequence count IDs forward, seeding the row first if it does not exist
+	/// </summary>
+	/// <param name="first">Set to the first ID of the reserved block</param>
+	static bool Reserve(const std::string& name, int count, int64_t& first, DBManager* dbManager, const SequenceSeeder& seeder);
+
+	/// <summary>
+	/// Deletes name's row, for sequences that belong to a row being deleted. Reserve seeds it again if needed.
+	/// </summary>
+	static bool Remove(const std::string& name, DBManager* dbManager);
+
+	/// <param name="circuitBreaker">The pool's breaker, so reservations fail fast while the database is down</param>
+	IDSequencer(const std::string& name, const ConnectionInformation& conInfo, const SequenceSeeder& seeder, CircuitBreaker* circuitBreaker, int blockSize = DEFAULT_BLOCK_SIZE);
+
+	/// <summary>
+	/// Takes the next ID from memory, reserving a new block when the current one is used up
+	/// </summary>
+	/// <returns>0 if a new block was needed and could not be reserved</returns>
+	int64_t next();
+
+	~IDSequencer();
+
+private:
+	std::string name;
+	//Only used while refillMutex is held
+	DBManager* dbManager;
+	SequenceSeeder seeder;
+	int blockSize;
+	std::atomic<int64_t> nextID;
+	//One past the last ID of the current block
+	std::atomic<int64_t> blockEnd;
+	std::mutex refillMutex;
+};
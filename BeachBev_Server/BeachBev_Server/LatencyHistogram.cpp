@@ -0,0 +1,95 @@
+#include "LatencyHistogram.h"
+#include <algorithm>
+
+LatencySnapshot::LatencySnapshot()
+	:count(0), totalMicros(0), maxMicros(0), buckets(LatencyHistogram::NUM_BUCKETS, 0)
+{
+}
+
+void LatencySnapshot::merge(const LatencySnapshot & other)
+{
+	count += other.count;
+	totalMicros += other.totalMicros;
+	maxMicros = std::max(maxMicros, other.maxMicros);
+	for (int i = 0; i < buckets.size(); i++) {
+		buckets.at(i) += other.buckets.at(i);
+	}
+}
+
+uint64_t LatencySnapshot::getPercentile(double percentile) const
+{
+	if (count == 0) {
+		return 0;
+	}
+	uint64_t rank = (uint64_t)(percentile / 100 * count);
+	if (rank >= count) {
+		rank = count - 1;
+	}
+	uint64_t seen = 0;
+	for (int i = 0; i < buckets.size(); i++) {
+		seen += buckets.at(i);
+		if (seen > rank) {
+			//The bucket can run past the slowest value actually recorded
+			return std::min(LatencyHistogram::GetBucketMax(i), maxMicros);
+		}
+	}
+	return maxMicros;
+}
+
+int LatencyHistogram::GetBucket(uint64_t micros)
+{
+	if (micros < 2 * SUB_BUCKETS) {
+		return (int)micros;
+	}
+	int magnitude = 0;
+	for (uint64_t shifted = micros; shifted > 1; shifted >>= 1) {
+		magnitude++;
+	}
+	if (magnitude > MAX_MAGNITUDE) {
+		return NUM_BUCKETS - 1;
+	}
+	//micros >> shift keeps the top SUB_BUCKET_BITS + 1 bits, the leading one picks the row and the rest the column
+	int shift = magnitude - SUB_BUCKET_BITS;
+	return (shift + 1) * SUB_BUCKETS + (int)(micros >> shift) - SUB_BUCKETS;
+}
+
+uint64_t LatencyHistogram::GetBucketMax(int bucket)
+{
+	if (bucket < 2 * SUB_BUCKETS) {
+		return bucket;
+	}
+	int shift = bucket / SUB_BUCKETS - 1;
+	uint64_t lowest = (uint64_t)(SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+	return lowest + ((uint64_t)1 << shift) - 1;
+}
+
+LatencyHistogram::LatencyHistogram()
+	:count(0), totalMicros(0), maxMicros(0)
+{
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		buckets[i] = 0;
+	}
+}
+
+void LatencyHistogram::record(uint64_t micros)
+{
+	buckets[GetBucket(micros)].fetch_add(1, std::memory_order_relaxed);
+	count.fetch_add(1, std::memory_order_relaxed);
+	totalMicros.fetch_add(micros, std::memory_order_relaxed);
+	uint64_t currentMax = maxMicros.load(std::memory_order_relaxed);
+	while (micros > currentMax && !maxMicros.compare_exchange_weak(currentMax, micros, std::memory_order_relaxed)) {
+	}
+}
+
+LatencySnapshot LatencyHistogram::getSnapshot() const
+{
+	LatencySnapshot snapshot;
+	//Each counter is read on its own, a statement finishing mid copy can leave count one off the buckets
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		snapshot.buckets.at(i) = buckets[i].load(std::memory_order_relaxed);
+	}
+	snapshot.count = count.load(std::memory_order_relaxed);
+	snapshot.totalMicros = totalMicros.load(std::memory_order_relaxed);
+	snapshot.maxMicros = maxMicros.load(std::memory_order_relaxed);
+	return snapshot;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "stdafx.h"
+#include <atomic>
+#include <vector>
+
+/// <summary>
+/// Copy of a LatencyHistogram that can be merged with others and queried for percentiles
+/// </summary>
+struct LatencySnapshot {
+	LatencySnapshot();
+
+	uint64_t count;
+	uint64_t totalMicros;
+	uint64_t maxMicros;
+	std::vector <uint64_t> buckets;
+
+	void merge(const LatencySnapshot& other);
+
+	/// <summary>
+	/// Highest latency in the bucket holding the percentile'th value, within 1/SUB_BUCKETS of the real one
+	/// </summary>
+	uint64_t getPercentile(double percentile) const;
+};
+
+/// <summary>
+/// HDR-style latency histogram in microseconds. Values below 2 * SUB_BUCKETS get a bucket each, above that
+/// every power of two is split into SUB_BUCKETS buckets, so the error stays under 1/SUB_BUCKETS at every
+/// magnitude in a fixed NUM_BUCKETS counters. Recording is lock free so a connection's statements can be
+/// timed while the console reads them.
+/// </summary>
+class LatencyHistogram
+{
+public:
+	static const int SUB_BUCKET_BITS = 3;
+	static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+	//About 67 seconds, anything slower is counted in the last bucket
+	static const int MAX_MAGNITUDE = 26;
+	static const int NUM_BUCKETS = (MAX_MAGNITUDE - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+	static int GetBucket(uint64_t micros);
+
+	/// <summary>
+	/// Highest value that lands in bucket
+	/// </summary>
+	static uint64_t GetBucketMax(int bucket);
+
+	LatencyHistogram();
+
+	void record(uint64_t micros);
+
+	LatencySnapshot getSnapshot() const;
+
+private:
+	std::atomic<uint64_t> buckets[NUM_BUCKETS];
+	std::atomic<uint64_t> count;
+	std::atomic<uint64_t> totalMicros;
+	std::atomic<uint64_t> maxMicros;
+};
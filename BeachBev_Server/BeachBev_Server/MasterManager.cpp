@@ -1,27 +1,95 @@
 #include "MasterManager.h"
 #include "DBManager.h"
+#include "DBPool.h"
+#include "BB_Server.h"
 
-MasterManager::MasterManager(BB_Server * bbServer)
-	:bbServer(bbServer)
+MasterManager::MasterManager(BB_Server * bbServer, int refreshSeconds)
+	:bbServer(bbServer), roleGeneration(0), refreshSeconds(refreshSeconds), invalidated(false), stopping(false)
 {
+	{
+		DBLease dbLease(bbServer->getDBPool());
+		if (!refresh(dbLease.get())) {
+			std::cerr << "Could not load masters, retrying in " << refreshSeconds << " seconds" << std::endl;
+		}
+	}
+	refreshThread = std::thread(&MasterManager::refreshLoop, this);
+}
+
+bool MasterManager::isMaster(IDType eID)
+{
+	boost::shared_lock<boost::shared_mutex> lock(mastersMutex);
+	return masters.find(eID) != masters.end();
+}
+
+bool MasterManager::isMaster(BB_ClientPtr client)
+{
+	if (client->getRoleGeneration() != roleGeneration) {
+		stampRole(client);
+	}
+	return client->isMaster();
+}
+
+void MasterManager::stampRole(BB_ClientPtr client)
+{
+	uint64_t generation = roleGeneration;
+	client->setRole(client->getEmpID() > 0 && isMaster(client->getEmpID()), generation);
 }
 
-bool MasterManager::isMaster(IDType eID, DBManager * dbManager)
+bool MasterManager::refresh(DBManager * dbManager)
 {
-	std::string query = "SELECT eID FROM Masters WHERE eID=:f1<int>";
-	try {
-		otl_stream otlStream(OTL_BUFFER_SIZE, query.c_str(), *dbManager->getConnection());
-		otlStream << (int)eID;
-		if (!otlStream.eof()) {
-			return true;
+	std::unordered_set <IDType> loadedMasters;
+	bool success = dbManager->execute<STMT_GET_MASTERS>([&](StatementStream<STMT_GET_MASTERS>& stmt) {
+		loadedMasters.clear();
+		int eID;
+		while (stmt.fetch(eID)) {
+			loadedMasters.insert(eID);
 		}
+	});
+	if (success) {
+		{
+			boost::unique_lock<boost::shared_mutex> lock(mastersMutex);
+			masters.swap(loadedMasters);
+		}
+		roleGeneration++;
 	}
-	catch (otl_exception ex) {
-		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+	return success;
+}
+
+void MasterManager::invalidate()
+{
+	{
+		std::lock_guard<std::mutex> lock(refreshMutex);
+		invalidated = true;
 	}
-	return false;
+	refreshCondition.notify_one();
 }
 
 MasterManager::~MasterManager()
 {
+	{
+		std::lock_guard<std::mutex> lock(refreshMutex);
+		stopping = true;
+	}
+	refreshCondition.notify_one();
+	if (refreshThread.joinable()) {
+		refreshThread.join();
+	}
+}
+
+void MasterManager::refreshLoop()
+{
+	std::unique_lock<std::mutex> lock(refreshMutex);
+	while (!stopping) {
+		refreshCondition.wait_for(lock, std::chrono::seconds(refreshSeconds), [this]() { return stopping || invalidated; });
+		if (stopping) {
+			return;
+		}
+		invalidated = false;
+		lock.unlock();
+		{
+			DBLease dbLease(bbServer->getDBPool());
+			refresh(dbLease.get());
+		}
+		lock.lock();
+	}
 }
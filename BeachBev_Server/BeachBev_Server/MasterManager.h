@@ -1,19 +1,67 @@
 #pragma once
 #include "stdafx.h"
 #include "BB_Client.h"
+#include <unordered_set>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <boost/thread/shared_mutex.hpp>
 
 class BB_Server;
+class DBManager;
 
+/// <summary>
+/// Keeps the Masters table in memory and reloads it in the background every refresh interval
+/// or as soon as it is invalidated
+/// </summary>
 class MasterManager
 {
 public:
-	MasterManager(BB_Server* bbServer);
+	static const int DEFAULT_REFRESH_SECONDS = 300;
 
-	bool isMaster(IDType eID, DBManager* dbManager);
+	MasterManager(BB_Server* bbServer, int refreshSeconds = DEFAULT_REFRESH_SECONDS);
+
+	bool isMaster(IDType eID);
+
+	/// <summary>
+	/// Uses the role stamped on client, restamping it first if the roles were reloaded since
+	/// </summary>
+	bool isMaster(BB_ClientPtr client);
+
+	/// <summary>
+	/// Stamps client's role for its current empID, called at login
+	/// </summary>
+	void stampRole(BB_ClientPtr client);
+
+	/// <summary>
+	/// Replaces the in-memory roles with the Masters table
+	/// </summary>
+	bool refresh(DBManager* dbManager);
+
+	/// <summary>
+	/// Wakes the refresh thread to reload the roles now
+	/// </summary>
+	void invalidate();
+
+	uint64_t getRoleGeneration() {
+		return roleGeneration;
+	}
 
 	~MasterManager();
 
 private:
+	void refreshLoop();
+
 	BB_Server* bbServer;
+	std::unordered_set <IDType> masters;
+	boost::shared_mutex mastersMutex;
+	//Bumped on every reload so stamped roles know they are out of date
+	std::atomic<uint64_t> roleGeneration;
+	int refreshSeconds;
+	std::thread refreshThread;
+	std::mutex refreshMutex;
+	std::condition_variable refreshCondition;
+	bool invalidated;
+	bool stopping;
 };
-
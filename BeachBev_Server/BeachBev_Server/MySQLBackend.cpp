@@ -0,0 +1,73 @@
+#include "MySQLBackend.h"
+#include "DBManager.h"
+#include <cstring>
+
+//Duplicate key name, returned when the index is already there
+static const int DUPLICATE_INDEX_CODE = 1061;
+
+std::string MySQLBackend::makeConnectStr(const ConnectionInformation & connectionInfo) const
+{
+	std::string connectStr;
+	if (connectionInfo.dsn != ConnectionInformation::UNUSED_INFO)
+	{
+		connectStr += "DSN=";
+		connectStr += connectionInfo.dsn;
+		connectStr += "; ";
+	}
+	if (connectionInfo.driver != ConnectionInformation::UNUSED_INFO)
+	{
+		connectStr += "Driver={";
+		connectStr += connectionInfo.driver;
+		connectStr += "}; ";
+	}
+	if (connectionInfo.server != ConnectionInformation::UNUSED_INFO)
+	{
+		connectStr += "Server=";
+		connectStr += connectionInfo.server;
+		connectStr += "; ";
+	}
+	if (connectionInfo.uid != ConnectionInformation::UNUSED_INFO)
+	{
+		connectStr += "UID=";
+		connectStr += connectionInfo.uid;
+		connectStr += "; ";
+	}
+	if (connectionInfo.pwd != ConnectionInformation::UNUSED_INFO)
+	{
+		connectStr += "PWD=";
+		connectStr += connectionInfo.pwd;
+		connectStr += "; ";
+	}
+	if (connectionInfo.database != ConnectionInformation::UNUSED_INFO)
+	{
+		connectStr += "Database=";
+		connectStr += connectionInfo.database;
+		connectStr += "; ";
+	}
+	connectStr += '\0';
+	return connectStr;
+}
+
+bool MySQLBackend::isConnectionLost(const otl_exception & ex) const
+{
+	//2006: server has gone away, 2013: lost connection during query, 2055: lost connection (extended)
+	if (ex.code == 2006 || ex.code == 2013 || ex.code == 2055) {
+		return true;
+	}
+	return std::strncmp((const char*)ex.sqlstate, "08", 2) == 0;
+}
+
+bool MySQLBackend::createIndex(otl_connect & connection, const std::string & indexName, const std::string & table, const std::string & columns) const
+{
+	try {
+		connection.direct_exec(("CREATE INDEX " + indexName + " ON " + table + " (" + columns + ")").c_str());
+	}
+	catch (otl_exception ex)
+	{
+		if (ex.code != DUPLICATE_INDEX_CODE) {
+			std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
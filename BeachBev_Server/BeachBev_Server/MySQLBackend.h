@@ -0,0 +1,39 @@
+#pragma once
+#include "stdafx.h"
+#include "DBBackend.h"
+
+/// <summary>
+/// MySQL over ODBC, the production backend. The schema is managed outside the server.
+/// </summary>
+class MySQLBackend : public DBBackend
+{
+public:
+	DBBackendType getType() const override {
+		return BACKEND_MYSQL;
+	}
+
+	const char* getName() const override {
+		return "mysql";
+	}
+
+	std::string makeConnectStr(const ConnectionInformation& connectionInfo) const override;
+
+	/// <summary>
+	/// True for ODBC connection exceptions (SQLSTATE 08xxx) and MySQL's server gone/lost errors
+	/// </summary>
+	bool isConnectionLost(const otl_exception& ex) const override;
+
+	bool supportsReplicas() const override {
+		return true;
+	}
+
+	bool autoCommits() const override {
+		return false;
+	}
+
+	bool createSchema(otl_connect& connection) const override {
+		return true;
+	}
+
+	bool createIndex(otl_connect& connection, const std::string& indexName, const std::string& table, const std::string& columns) const override;
+};
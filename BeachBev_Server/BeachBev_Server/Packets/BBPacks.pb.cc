@@ -1,789 +1,1703 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: BBPacks.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "BBPacks.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
 namespace ProtobufPackets {
-class PackA0DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackA0> {};
-PackA0DefaultTypeInternal _PackA0_default_instance_;
-class PackA1DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackA1> {};
-PackA1DefaultTypeInternal _PackA1_default_instance_;
-class PackA2DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackA2> {};
-PackA2DefaultTypeInternal _PackA2_default_instance_;
-class PackA3DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackA3> {};
-PackA3DefaultTypeInternal _PackA3_default_instance_;
-class PackA4DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackA4> {};
-PackA4DefaultTypeInternal _PackA4_default_instance_;
-class PackA5DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackA5> {};
-PackA5DefaultTypeInternal _PackA5_default_instance_;
-class PackA6DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackA6> {};
-PackA6DefaultTypeInternal _PackA6_default_instance_;
-class PackA7DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackA7> {};
-PackA7DefaultTypeInternal _PackA7_default_instance_;
-class PackA8DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackA8> {};
-PackA8DefaultTypeInternal _PackA8_default_instance_;
-class PackA9DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackA9> {};
-PackA9DefaultTypeInternal _PackA9_default_instance_;
-class PackB0DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackB0> {};
-PackB0DefaultTypeInternal _PackB0_default_instance_;
-class PackB1DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackB1> {};
-PackB1DefaultTypeInternal _PackB1_default_instance_;
-class PackB2DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackB2> {};
-PackB2DefaultTypeInternal _PackB2_default_instance_;
-class PackB3DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackB3> {};
-PackB3DefaultTypeInternal _PackB3_default_instance_;
-class PackB4DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackB4> {};
-PackB4DefaultTypeInternal _PackB4_default_instance_;
-class PackB5DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackB5> {};
-PackB5DefaultTypeInternal _PackB5_default_instance_;
-class PackC0DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackC0> {};
-PackC0DefaultTypeInternal _PackC0_default_instance_;
-class PackC1DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackC1> {};
-PackC1DefaultTypeInternal _PackC1_default_instance_;
-class PackC2DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackC2> {};
-PackC2DefaultTypeInternal _PackC2_default_instance_;
-class PackC3DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackC3> {};
-PackC3DefaultTypeInternal _PackC3_default_instance_;
-class PackD0DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackD0> {};
-PackD0DefaultTypeInternal _PackD0_default_instance_;
-class PackD1DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackD1> {};
-PackD1DefaultTypeInternal _PackD1_default_instance_;
-class PackD2DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackD2> {};
-PackD2DefaultTypeInternal _PackD2_default_instance_;
-class PackD3DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackD3> {};
-PackD3DefaultTypeInternal _PackD3_default_instance_;
-class PackD4DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackD4> {};
-PackD4DefaultTypeInternal _PackD4_default_instance_;
-class PackE0DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackE0> {};
-PackE0DefaultTypeInternal _PackE0_default_instance_;
-class PackE1DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackE1> {};
-PackE1DefaultTypeInternal _PackE1_default_instance_;
-class PackE2DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackE2> {};
-PackE2DefaultTypeInternal _PackE2_default_instance_;
-class PackE3DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackE3> {};
-PackE3DefaultTypeInternal _PackE3_default_instance_;
-class PackE4DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackE4> {};
-PackE4DefaultTypeInternal _PackE4_default_instance_;
-class PackE5DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackE5> {};
-PackE5DefaultTypeInternal _PackE5_default_instance_;
-class PackE6DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackE6> {};
-PackE6DefaultTypeInternal _PackE6_default_instance_;
-class PackE7DefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PackE7> {};
-PackE7DefaultTypeInternal _PackE7_default_instance_;
-
-namespace {
-
-::google::protobuf::Metadata file_level_metadata[33];
-
-}  // namespace
-
-
-const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto() GOOGLE_ATTRIBUTE_COLD;
-const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto() {
-  static const ::google::protobuf::uint32 offsets[] = {
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA0, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA0, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA0, pwd_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA0, email_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA1, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA1, pwdtoken_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA1, eid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA1, deviceid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA1, msg_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA2, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA2, eid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA2, pwdtoken_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA2, deviceid_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA3, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA3, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA3, pwd_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA3, deviceid_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA4, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA4, email_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA5, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA5, success_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA5, msg_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA6, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA6, pwdresettoken_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA7, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA7, success_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA7, msg_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA8, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA8, pwdresettoken_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA8, pwd_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA9, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA9, pwdtoken_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA9, eid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA9, deviceid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackA9, msg_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB0, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB0, email_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB1, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB1, success_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB1, msg_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB2, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB2, emailtoken_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB3, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB3, success_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB3, msg_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB4, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB5, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB5, verifiedemail_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackB5, unverifiedemail_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackC0, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackC0, eid_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackC1, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackC1, name_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackC2, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackC3, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackC3, name_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD0, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD1, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD1, folderobjkey_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD1, accesskeyid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD1, accesskey_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD1, sessionkey_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD1, msg_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD2, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD3, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD4, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackD4, hasresume_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE0, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE1, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE1, employeeeids_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE1, unacceptedeids_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE1, acceptedeids_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE1, success_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE1, msg_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE2, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE2, eid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE2, astate_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE3, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE3, success_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE3, msg_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE3, eid_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE4, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE5, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE5, astate_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE5, msg_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE6, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE6, accept_),
-    ~0u,  // no _has_bits_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE7, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE7, success_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackE7, msg_),
+PROTOBUF_CONSTEXPR PackHeaderIn::PackHeaderIn(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sendtoids_)*/{}
+  , /*decltype(_impl_._sendtoids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.lockey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.serverread_)*/false
+  , /*decltype(_impl_.datasize_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackHeaderInDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackHeaderInDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackHeaderInDefaultTypeInternal() {}
+  union {
+    PackHeaderIn _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackHeaderInDefaultTypeInternal _PackHeaderIn_default_instance_;
+PROTOBUF_CONSTEXPR PackHeaderOut::PackHeaderOut(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.lockey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sentfromid_)*/0u
+  , /*decltype(_impl_.datasize_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackHeaderOutDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackHeaderOutDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackHeaderOutDefaultTypeInternal() {}
+  union {
+    PackHeaderOut _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackHeaderOutDefaultTypeInternal _PackHeaderOut_default_instance_;
+PROTOBUF_CONSTEXPR PackA0::PackA0(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.pwd_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.email_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackA0DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackA0DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackA0DefaultTypeInternal() {}
+  union {
+    PackA0 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackA0DefaultTypeInternal _PackA0_default_instance_;
+PROTOBUF_CONSTEXPR PackA1::PackA1(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pwdtoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.eid_)*/0u
+  , /*decltype(_impl_.deviceid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackA1DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackA1DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackA1DefaultTypeInternal() {}
+  union {
+    PackA1 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackA1DefaultTypeInternal _PackA1_default_instance_;
+PROTOBUF_CONSTEXPR PackA2::PackA2(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pwdtoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.eid_)*/0u
+  , /*decltype(_impl_.deviceid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackA2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackA2DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackA2DefaultTypeInternal() {}
+  union {
+    PackA2 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackA2DefaultTypeInternal _PackA2_default_instance_;
+PROTOBUF_CONSTEXPR PackA3::PackA3(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.pwd_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.deviceid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackA3DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackA3DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackA3DefaultTypeInternal() {}
+  union {
+    PackA3 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackA3DefaultTypeInternal _PackA3_default_instance_;
+PROTOBUF_CONSTEXPR PackA4::PackA4(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.email_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackA4DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackA4DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackA4DefaultTypeInternal() {}
+  union {
+    PackA4 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackA4DefaultTypeInternal _PackA4_default_instance_;
+PROTOBUF_CONSTEXPR PackA5::PackA5(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackA5DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackA5DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackA5DefaultTypeInternal() {}
+  union {
+    PackA5 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackA5DefaultTypeInternal _PackA5_default_instance_;
+PROTOBUF_CONSTEXPR PackA6::PackA6(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pwdresettoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackA6DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackA6DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackA6DefaultTypeInternal() {}
+  union {
+    PackA6 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackA6DefaultTypeInternal _PackA6_default_instance_;
+PROTOBUF_CONSTEXPR PackA7::PackA7(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackA7DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackA7DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackA7DefaultTypeInternal() {}
+  union {
+    PackA7 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackA7DefaultTypeInternal _PackA7_default_instance_;
+PROTOBUF_CONSTEXPR PackA8::PackA8(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pwdresettoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.pwd_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackA8DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackA8DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackA8DefaultTypeInternal() {}
+  union {
+    PackA8 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackA8DefaultTypeInternal _PackA8_default_instance_;
+PROTOBUF_CONSTEXPR PackA9::PackA9(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pwdtoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.eid_)*/0u
+  , /*decltype(_impl_.deviceid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackA9DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackA9DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackA9DefaultTypeInternal() {}
+  union {
+    PackA9 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackA9DefaultTypeInternal _PackA9_default_instance_;
+PROTOBUF_CONSTEXPR PackB0::PackB0(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.email_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackB0DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackB0DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackB0DefaultTypeInternal() {}
+  union {
+    PackB0 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackB0DefaultTypeInternal _PackB0_default_instance_;
+PROTOBUF_CONSTEXPR PackB1::PackB1(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackB1DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackB1DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackB1DefaultTypeInternal() {}
+  union {
+    PackB1 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackB1DefaultTypeInternal _PackB1_default_instance_;
+PROTOBUF_CONSTEXPR PackB2::PackB2(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.emailtoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackB2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackB2DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackB2DefaultTypeInternal() {}
+  union {
+    PackB2 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackB2DefaultTypeInternal _PackB2_default_instance_;
+PROTOBUF_CONSTEXPR PackB3::PackB3(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackB3DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackB3DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackB3DefaultTypeInternal() {}
+  union {
+    PackB3 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackB3DefaultTypeInternal _PackB3_default_instance_;
+PROTOBUF_CONSTEXPR PackB4::PackB4(
+    ::_pbi::ConstantInitialized) {}
+struct PackB4DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackB4DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackB4DefaultTypeInternal() {}
+  union {
+    PackB4 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackB4DefaultTypeInternal _PackB4_default_instance_;
+PROTOBUF_CONSTEXPR PackB5::PackB5(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.verifiedemail_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.unverifiedemail_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackB5DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackB5DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackB5DefaultTypeInternal() {}
+  union {
+    PackB5 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackB5DefaultTypeInternal _PackB5_default_instance_;
+PROTOBUF_CONSTEXPR PackC0::PackC0(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.eid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackC0DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackC0DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackC0DefaultTypeInternal() {}
+  union {
+    PackC0 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackC0DefaultTypeInternal _PackC0_default_instance_;
+PROTOBUF_CONSTEXPR PackC1::PackC1(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackC1DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackC1DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackC1DefaultTypeInternal() {}
+  union {
+    PackC1 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackC1DefaultTypeInternal _PackC1_default_instance_;
+PROTOBUF_CONSTEXPR PackC2::PackC2(
+    ::_pbi::ConstantInitialized) {}
+struct PackC2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackC2DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackC2DefaultTypeInternal() {}
+  union {
+    PackC2 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackC2DefaultTypeInternal _PackC2_default_instance_;
+PROTOBUF_CONSTEXPR PackC3::PackC3(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackC3DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackC3DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackC3DefaultTypeInternal() {}
+  union {
+    PackC3 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackC3DefaultTypeInternal _PackC3_default_instance_;
+PROTOBUF_CONSTEXPR PackD0::PackD0(
+    ::_pbi::ConstantInitialized) {}
+struct PackD0DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackD0DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackD0DefaultTypeInternal() {}
+  union {
+    PackD0 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackD0DefaultTypeInternal _PackD0_default_instance_;
+PROTOBUF_CONSTEXPR PackD1::PackD1(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.folderobjkey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.accesskeyid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.accesskey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sessionkey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackD1DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackD1DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackD1DefaultTypeInternal() {}
+  union {
+    PackD1 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackD1DefaultTypeInternal _PackD1_default_instance_;
+PROTOBUF_CONSTEXPR PackD2::PackD2(
+    ::_pbi::ConstantInitialized) {}
+struct PackD2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackD2DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackD2DefaultTypeInternal() {}
+  union {
+    PackD2 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackD2DefaultTypeInternal _PackD2_default_instance_;
+PROTOBUF_CONSTEXPR PackD3::PackD3(
+    ::_pbi::ConstantInitialized) {}
+struct PackD3DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackD3DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackD3DefaultTypeInternal() {}
+  union {
+    PackD3 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackD3DefaultTypeInternal _PackD3_default_instance_;
+PROTOBUF_CONSTEXPR PackD4::PackD4(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hasresume_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackD4DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackD4DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackD4DefaultTypeInternal() {}
+  union {
+    PackD4 _instance;
   };
-  return offsets;
-}
-
-static const ::google::protobuf::internal::MigrationSchema schemas[] = {
-  { 0, -1, sizeof(PackA0)},
-  { 7, -1, sizeof(PackA1)},
-  { 15, -1, sizeof(PackA2)},
-  { 22, -1, sizeof(PackA3)},
-  { 29, -1, sizeof(PackA4)},
-  { 34, -1, sizeof(PackA5)},
-  { 40, -1, sizeof(PackA6)},
-  { 45, -1, sizeof(PackA7)},
-  { 51, -1, sizeof(PackA8)},
-  { 57, -1, sizeof(PackA9)},
-  { 65, -1, sizeof(PackB0)},
-  { 70, -1, sizeof(PackB1)},
-  { 76, -1, sizeof(PackB2)},
-  { 81, -1, sizeof(PackB3)},
-  { 87, -1, sizeof(PackB4)},
-  { 91, -1, sizeof(PackB5)},
-  { 97, -1, sizeof(PackC0)},
-  { 102, -1, sizeof(PackC1)},
-  { 107, -1, sizeof(PackC2)},
-  { 111, -1, sizeof(PackC3)},
-  { 116, -1, sizeof(PackD0)},
-  { 120, -1, sizeof(PackD1)},
-  { 129, -1, sizeof(PackD2)},
-  { 133, -1, sizeof(PackD3)},
-  { 137, -1, sizeof(PackD4)},
-  { 142, -1, sizeof(PackE0)},
-  { 146, -1, sizeof(PackE1)},
-  { 155, -1, sizeof(PackE2)},
-  { 161, -1, sizeof(PackE3)},
-  { 168, -1, sizeof(PackE4)},
-  { 172, -1, sizeof(PackE5)},
-  { 178, -1, sizeof(PackE6)},
-  { 183, -1, sizeof(PackE7)},
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackD4DefaultTypeInternal _PackD4_default_instance_;
+PROTOBUF_CONSTEXPR PackE0::PackE0(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pagesize_)*/0u
+  , /*decltype(_impl_.cursor_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackE0DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackE0DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackE0DefaultTypeInternal() {}
+  union {
+    PackE0 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackE0DefaultTypeInternal _PackE0_default_instance_;
+PROTOBUF_CONSTEXPR PackE1::PackE1(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.employeeeids_)*/{}
+  , /*decltype(_impl_._employeeeids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.unacceptedeids_)*/{}
+  , /*decltype(_impl_._unacceptedeids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.acceptedeids_)*/{}
+  , /*decltype(_impl_._acceptedeids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.morepages_)*/false
+  , /*decltype(_impl_.nextcursor_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackE1DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackE1DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackE1DefaultTypeInternal() {}
+  union {
+    PackE1 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackE1DefaultTypeInternal _PackE1_default_instance_;
+PROTOBUF_CONSTEXPR PackE2::PackE2(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.eid_)*/0u
+  , /*decltype(_impl_.astate_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackE2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackE2DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackE2DefaultTypeInternal() {}
+  union {
+    PackE2 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackE2DefaultTypeInternal _PackE2_default_instance_;
+PROTOBUF_CONSTEXPR PackE3::PackE3(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.eid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackE3DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackE3DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackE3DefaultTypeInternal() {}
+  union {
+    PackE3 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackE3DefaultTypeInternal _PackE3_default_instance_;
+PROTOBUF_CONSTEXPR PackE4::PackE4(
+    ::_pbi::ConstantInitialized) {}
+struct PackE4DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackE4DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackE4DefaultTypeInternal() {}
+  union {
+    PackE4 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackE4DefaultTypeInternal _PackE4_default_instance_;
+PROTOBUF_CONSTEXPR PackE5::PackE5(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.astate_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackE5DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackE5DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackE5DefaultTypeInternal() {}
+  union {
+    PackE5 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackE5DefaultTypeInternal _PackE5_default_instance_;
+PROTOBUF_CONSTEXPR PackE6::PackE6(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.accept_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackE6DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackE6DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackE6DefaultTypeInternal() {}
+  union {
+    PackE6 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackE6DefaultTypeInternal _PackE6_default_instance_;
+PROTOBUF_CONSTEXPR PackE7::PackE7(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackE7DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackE7DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackE7DefaultTypeInternal() {}
+  union {
+    PackE7 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackE7DefaultTypeInternal _PackE7_default_instance_;
+}  // namespace ProtobufPackets
+static ::_pb::Metadata file_level_metadata_BBPacks_2eproto[35];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_BBPacks_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_BBPacks_2eproto = nullptr;
+
+const uint32_t TableStruct_BBPacks_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackHeaderIn, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackHeaderIn, _impl_.serverread_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackHeaderIn, _impl_.lockey_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackHeaderIn, _impl_.sendtoids_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackHeaderIn, _impl_.datasize_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackHeaderOut, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackHeaderOut, _impl_.lockey_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackHeaderOut, _impl_.sentfromid_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackHeaderOut, _impl_.datasize_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA0, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA0, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA0, _impl_.pwd_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA0, _impl_.email_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA1, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA1, _impl_.pwdtoken_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA1, _impl_.eid_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA1, _impl_.deviceid_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA1, _impl_.msg_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA2, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA2, _impl_.eid_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA2, _impl_.pwdtoken_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA2, _impl_.deviceid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA3, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA3, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA3, _impl_.pwd_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA3, _impl_.deviceid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA4, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA4, _impl_.email_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA5, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA5, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA5, _impl_.msg_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA6, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA6, _impl_.pwdresettoken_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA7, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA7, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA7, _impl_.msg_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA8, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA8, _impl_.pwdresettoken_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA8, _impl_.pwd_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA9, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA9, _impl_.pwdtoken_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA9, _impl_.eid_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA9, _impl_.deviceid_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackA9, _impl_.msg_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB0, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB0, _impl_.email_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB1, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB1, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB1, _impl_.msg_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB2, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB2, _impl_.emailtoken_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB3, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB3, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB3, _impl_.msg_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB4, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB5, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB5, _impl_.verifiedemail_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackB5, _impl_.unverifiedemail_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackC0, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackC0, _impl_.eid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackC1, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackC1, _impl_.name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackC2, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackC3, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackC3, _impl_.name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD0, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD1, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD1, _impl_.folderobjkey_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD1, _impl_.accesskeyid_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD1, _impl_.accesskey_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD1, _impl_.sessionkey_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD1, _impl_.msg_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD2, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD3, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD4, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackD4, _impl_.hasresume_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE0, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE0, _impl_.pagesize_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE0, _impl_.cursor_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE1, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE1, _impl_.employeeeids_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE1, _impl_.unacceptedeids_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE1, _impl_.acceptedeids_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE1, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE1, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE1, _impl_.nextcursor_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE1, _impl_.morepages_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE2, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE2, _impl_.eid_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE2, _impl_.astate_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE3, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE3, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE3, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE3, _impl_.eid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE4, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE5, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE5, _impl_.astate_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE5, _impl_.msg_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE6, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE6, _impl_.accept_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE7, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE7, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::ProtobufPackets::PackE7, _impl_.msg_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::ProtobufPackets::PackHeaderIn)},
+  { 10, -1, -1, sizeof(::ProtobufPackets::PackHeaderOut)},
+  { 19, -1, -1, sizeof(::ProtobufPackets::PackA0)},
+  { 28, -1, -1, sizeof(::ProtobufPackets::PackA1)},
+  { 38, -1, -1, sizeof(::ProtobufPackets::PackA2)},
+  { 47, -1, -1, sizeof(::ProtobufPackets::PackA3)},
+  { 56, -1, -1, sizeof(::ProtobufPackets::PackA4)},
+  { 63, -1, -1, sizeof(::ProtobufPackets::PackA5)},
+  { 71, -1, -1, sizeof(::ProtobufPackets::PackA6)},
+  { 78, -1, -1, sizeof(::ProtobufPackets::PackA7)},
+  { 86, -1, -1, sizeof(::ProtobufPackets::PackA8)},
+  { 94, -1, -1, sizeof(::ProtobufPackets::PackA9)},
+  { 104, -1, -1, sizeof(::ProtobufPackets::PackB0)},
+  { 111, -1, -1, sizeof(::ProtobufPackets::PackB1)},
+  { 119, -1, -1, sizeof(::ProtobufPackets::PackB2)},
+  { 126, -1, -1, sizeof(::ProtobufPackets::PackB3)},
+  { 134, -1, -1, sizeof(::ProtobufPackets::PackB4)},
+  { 140, -1, -1, sizeof(::ProtobufPackets::PackB5)},
+  { 148, -1, -1, sizeof(::ProtobufPackets::PackC0)},
+  { 155, -1, -1, sizeof(::ProtobufPackets::PackC1)},
+  { 162, -1, -1, sizeof(::ProtobufPackets::PackC2)},
+  { 168, -1, -1, sizeof(::ProtobufPackets::PackC3)},
+  { 175, -1, -1, sizeof(::ProtobufPackets::PackD0)},
+  { 181, -1, -1, sizeof(::ProtobufPackets::PackD1)},
+  { 192, -1, -1, sizeof(::ProtobufPackets::PackD2)},
+  { 198, -1, -1, sizeof(::ProtobufPackets::PackD3)},
+  { 204, -1, -1, sizeof(::ProtobufPackets::PackD4)},
+  { 211, -1, -1, sizeof(::ProtobufPackets::PackE0)},
+  { 219, -1, -1, sizeof(::ProtobufPackets::PackE1)},
+  { 232, -1, -1, sizeof(::ProtobufPackets::PackE2)},
+  { 240, -1, -1, sizeof(::ProtobufPackets::PackE3)},
+  { 249, -1, -1, sizeof(::ProtobufPackets::PackE4)},
+  { 255, -1, -1, sizeof(::ProtobufPackets::PackE5)},
+  { 263, -1, -1, sizeof(::ProtobufPackets::PackE6)},
+  { 270, -1, -1, sizeof(::ProtobufPackets::PackE7)},
 };
 
-static const ::google::protobuf::internal::DefaultInstanceData file_default_instances[] = {
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackA0_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackA1_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackA2_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackA3_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackA4_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackA5_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackA6_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackA7_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackA8_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackA9_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackB0_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackB1_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackB2_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackB3_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackB4_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackB5_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackC0_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackC1_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackC2_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackC3_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackD0_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackD1_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackD2_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackD3_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackD4_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackE0_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackE1_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackE2_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackE3_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackE4_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackE5_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackE6_default_instance_), NULL},
-  {reinterpret_cast<const ::google::protobuf::Message*>(&_PackE7_default_instance_), NULL},
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ProtobufPackets::_PackHeaderIn_default_instance_._instance,
+  &::ProtobufPackets::_PackHeaderOut_default_instance_._instance,
+  &::ProtobufPackets::_PackA0_default_instance_._instance,
+  &::ProtobufPackets::_PackA1_default_instance_._instance,
+  &::ProtobufPackets::_PackA2_default_instance_._instance,
+  &::ProtobufPackets::_PackA3_default_instance_._instance,
+  &::ProtobufPackets::_PackA4_default_instance_._instance,
+  &::ProtobufPackets::_PackA5_default_instance_._instance,
+  &::ProtobufPackets::_PackA6_default_instance_._instance,
+  &::ProtobufPackets::_PackA7_default_instance_._instance,
+  &::ProtobufPackets::_PackA8_default_instance_._instance,
+  &::ProtobufPackets::_PackA9_default_instance_._instance,
+  &::ProtobufPackets::_PackB0_default_instance_._instance,
+  &::ProtobufPackets::_PackB1_default_instance_._instance,
+  &::ProtobufPackets::_PackB2_default_instance_._instance,
+  &::ProtobufPackets::_PackB3_default_instance_._instance,
+  &::ProtobufPackets::_PackB4_default_instance_._instance,
+  &::ProtobufPackets::_PackB5_default_instance_._instance,
+  &::ProtobufPackets::_PackC0_default_instance_._instance,
+  &::ProtobufPackets::_PackC1_default_instance_._instance,
+  &::ProtobufPackets::_PackC2_default_instance_._instance,
+  &::ProtobufPackets::_PackC3_default_instance_._instance,
+  &::ProtobufPackets::_PackD0_default_instance_._instance,
+  &::ProtobufPackets::_PackD1_default_instance_._instance,
+  &::ProtobufPackets::_PackD2_default_instance_._instance,
+  &::ProtobufPackets::_PackD3_default_instance_._instance,
+  &::ProtobufPackets::_PackD4_default_instance_._instance,
+  &::ProtobufPackets::_PackE0_default_instance_._instance,
+  &::ProtobufPackets::_PackE1_default_instance_._instance,
+  &::ProtobufPackets::_PackE2_default_instance_._instance,
+  &::ProtobufPackets::_PackE3_default_instance_._instance,
+  &::ProtobufPackets::_PackE4_default_instance_._instance,
+  &::ProtobufPackets::_PackE5_default_instance_._instance,
+  &::ProtobufPackets::_PackE6_default_instance_._instance,
+  &::ProtobufPackets::_PackE7_default_instance_._instance,
 };
 
-namespace {
-
-void protobuf_AssignDescriptors() {
-  protobuf_AddDesc_BBPacks_2eproto();
-  ::google::protobuf::MessageFactory* factory = NULL;
-  AssignDescriptors(
-      "BBPacks.proto", schemas, file_default_instances, protobuf_Offsets_BBPacks_2eproto(), factory,
-      file_level_metadata, NULL, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 33);
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_BBPacks_2eproto() {
-  _PackA0_default_instance_.Shutdown();
-  delete file_level_metadata[0].reflection;
-  _PackA1_default_instance_.Shutdown();
-  delete file_level_metadata[1].reflection;
-  _PackA2_default_instance_.Shutdown();
-  delete file_level_metadata[2].reflection;
-  _PackA3_default_instance_.Shutdown();
-  delete file_level_metadata[3].reflection;
-  _PackA4_default_instance_.Shutdown();
-  delete file_level_metadata[4].reflection;
-  _PackA5_default_instance_.Shutdown();
-  delete file_level_metadata[5].reflection;
-  _PackA6_default_instance_.Shutdown();
-  delete file_level_metadata[6].reflection;
-  _PackA7_default_instance_.Shutdown();
-  delete file_level_metadata[7].reflection;
-  _PackA8_default_instance_.Shutdown();
-  delete file_level_metadata[8].reflection;
-  _PackA9_default_instance_.Shutdown();
-  delete file_level_metadata[9].reflection;
-  _PackB0_default_instance_.Shutdown();
-  delete file_level_metadata[10].reflection;
-  _PackB1_default_instance_.Shutdown();
-  delete file_level_metadata[11].reflection;
-  _PackB2_default_instance_.Shutdown();
-  delete file_level_metadata[12].reflection;
-  _PackB3_default_instance_.Shutdown();
-  delete file_level_metadata[13].reflection;
-  _PackB4_default_instance_.Shutdown();
-  delete file_level_metadata[14].reflection;
-  _PackB5_default_instance_.Shutdown();
-  delete file_level_metadata[15].reflection;
-  _PackC0_default_instance_.Shutdown();
-  delete file_level_metadata[16].reflection;
-  _PackC1_default_instance_.Shutdown();
-  delete file_level_metadata[17].reflection;
-  _PackC2_default_instance_.Shutdown();
-  delete file_level_metadata[18].reflection;
-  _PackC3_default_instance_.Shutdown();
-  delete file_level_metadata[19].reflection;
-  _PackD0_default_instance_.Shutdown();
-  delete file_level_metadata[20].reflection;
-  _PackD1_default_instance_.Shutdown();
-  delete file_level_metadata[21].reflection;
-  _PackD2_default_instance_.Shutdown();
-  delete file_level_metadata[22].reflection;
-  _PackD3_default_instance_.Shutdown();
-  delete file_level_metadata[23].reflection;
-  _PackD4_default_instance_.Shutdown();
-  delete file_level_metadata[24].reflection;
-  _PackE0_default_instance_.Shutdown();
-  delete file_level_metadata[25].reflection;
-  _PackE1_default_instance_.Shutdown();
-  delete file_level_metadata[26].reflection;
-  _PackE2_default_instance_.Shutdown();
-  delete file_level_metadata[27].reflection;
-  _PackE3_default_instance_.Shutdown();
-  delete file_level_metadata[28].reflection;
-  _PackE4_default_instance_.Shutdown();
-  delete file_level_metadata[29].reflection;
-  _PackE5_default_instance_.Shutdown();
-  delete file_level_metadata[30].reflection;
-  _PackE6_default_instance_.Shutdown();
-  delete file_level_metadata[31].reflection;
-  _PackE7_default_instance_.Shutdown();
-  delete file_level_metadata[32].reflection;
-}
-
-void protobuf_InitDefaults_BBPacks_2eproto_impl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::internal::InitProtobufDefaults();
-  _PackA0_default_instance_.DefaultConstruct();
-  _PackA1_default_instance_.DefaultConstruct();
-  _PackA2_default_instance_.DefaultConstruct();
-  _PackA3_default_instance_.DefaultConstruct();
-  _PackA4_default_instance_.DefaultConstruct();
-  _PackA5_default_instance_.DefaultConstruct();
-  _PackA6_default_instance_.DefaultConstruct();
-  _PackA7_default_instance_.DefaultConstruct();
-  _PackA8_default_instance_.DefaultConstruct();
-  _PackA9_default_instance_.DefaultConstruct();
-  _PackB0_default_instance_.DefaultConstruct();
-  _PackB1_default_instance_.DefaultConstruct();
-  _PackB2_default_instance_.DefaultConstruct();
-  _PackB3_default_instance_.DefaultConstruct();
-  _PackB4_default_instance_.DefaultConstruct();
-  _PackB5_default_instance_.DefaultConstruct();
-  _PackC0_default_instance_.DefaultConstruct();
-  _PackC1_default_instance_.DefaultConstruct();
-  _PackC2_default_instance_.DefaultConstruct();
-  _PackC3_default_instance_.DefaultConstruct();
-  _PackD0_default_instance_.DefaultConstruct();
-  _PackD1_default_instance_.DefaultConstruct();
-  _PackD2_default_instance_.DefaultConstruct();
-  _PackD3_default_instance_.DefaultConstruct();
-  _PackD4_default_instance_.DefaultConstruct();
-  _PackE0_default_instance_.DefaultConstruct();
-  _PackE1_default_instance_.DefaultConstruct();
-  _PackE2_default_instance_.DefaultConstruct();
-  _PackE3_default_instance_.DefaultConstruct();
-  _PackE4_default_instance_.DefaultConstruct();
-  _PackE5_default_instance_.DefaultConstruct();
-  _PackE6_default_instance_.DefaultConstruct();
-  _PackE7_default_instance_.DefaultConstruct();
-}
-
-void protobuf_InitDefaults_BBPacks_2eproto() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &protobuf_InitDefaults_BBPacks_2eproto_impl);
-}
-void protobuf_AddDesc_BBPacks_2eproto_impl() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  static const char descriptor[] = {
-      "\n\rBBPacks.proto\022\017ProtobufPackets\"2\n\006Pack"
-      "A0\022\014\n\004name\030\001 \001(\t\022\013\n\003pwd\030\002 \001(\t\022\r\n\005email\030\003"
-      " \001(\t\"F\n\006PackA1\022\020\n\010pwdToken\030\001 \001(\t\022\013\n\003eID\030"
-      "\002 \001(\r\022\020\n\010deviceID\030\003 \001(\r\022\013\n\003msg\030\004 \001(\t\"9\n\006"
-      "PackA2\022\013\n\003eID\030\001 \001(\r\022\020\n\010pwdToken\030\002 \001(\t\022\020\n"
-      "\010deviceID\030\003 \001(\005\"5\n\006PackA3\022\014\n\004name\030\001 \001(\t\022"
-      "\013\n\003pwd\030\002 \001(\t\022\020\n\010deviceID\030\003 \001(\r\"\027\n\006PackA4"
-      "\022\r\n\005email\030\001 \001(\t\"&\n\006PackA5\022\017\n\007success\030\001 \001"
-      "(\010\022\013\n\003msg\030\002 \001(\t\"\037\n\006PackA6\022\025\n\rpwdResetTok"
-      "en\030\001 \001(\t\"&\n\006PackA7\022\017\n\007success\030\001 \001(\010\022\013\n\003m"
-      "sg\030\002 \001(\t\",\n\006PackA8\022\025\n\rpwdResetToken\030\001 \001("
-      "\t\022\013\n\003pwd\030\002 \001(\t\"F\n\006PackA9\022\020\n\010pwdToken\030\001 \001"
-      "(\t\022\013\n\003eID\030\002 \001(\r\022\020\n\010deviceID\030\003 \001(\r\022\013\n\003msg"
-      "\030\004 \001(\t\"\027\n\006PackB0\022\r\n\005email\030\001 \001(\t\"&\n\006PackB"
-      "1\022\017\n\007success\030\001 \001(\010\022\013\n\003msg\030\002 \001(\t\"\034\n\006PackB"
-      "2\022\022\n\nemailToken\030\001 \001(\t\"&\n\006PackB3\022\017\n\007succe"
-      "ss\030\001 \001(\010\022\013\n\003msg\030\002 \001(\t\"\010\n\006PackB4\"8\n\006PackB"
-      "5\022\025\n\rverifiedEmail\030\001 \001(\t\022\027\n\017unverifiedEm"
-      "ail\030\002 \001(\t\"\025\n\006PackC0\022\013\n\003eID\030\001 \001(\r\"\026\n\006Pack"
-      "C1\022\014\n\004name\030\001 \001(\t\"\010\n\006PackC2\"\026\n\006PackC3\022\014\n\004"
-      "name\030\001 \001(\t\"\010\n\006PackD0\"g\n\006PackD1\022\024\n\014folder"
-      "ObjKey\030\001 \001(\t\022\023\n\013accessKeyID\030\002 \001(\t\022\021\n\tacc"
-      "essKey\030\003 \001(\t\022\022\n\nsessionKey\030\004 \001(\t\022\013\n\003msg\030"
-      "\005 \001(\t\"\010\n\006PackD2\"\010\n\006PackD3\"\033\n\006PackD4\022\021\n\th"
-      "asResume\030\001 \001(\010\"\010\n\006PackE0\"j\n\006PackE1\022\024\n\014em"
-      "ployeeEIDs\030\001 \003(\r\022\026\n\016unacceptedEIDs\030\002 \003(\r"
-      "\022\024\n\014acceptedEIDs\030\003 \003(\r\022\017\n\007success\030\004 \001(\010\022"
-      "\013\n\003msg\030\005 \001(\t\"%\n\006PackE2\022\013\n\003eID\030\001 \001(\r\022\016\n\006a"
-      "State\030\002 \001(\005\"3\n\006PackE3\022\017\n\007success\030\001 \001(\010\022\013"
-      "\n\003msg\030\002 \001(\t\022\013\n\003eID\030\003 \001(\r\"\010\n\006PackE4\"%\n\006Pa"
-      "ckE5\022\016\n\006aState\030\001 \001(\005\022\013\n\003msg\030\002 \001(\t\"\030\n\006Pac"
-      "kE6\022\016\n\006accept\030\001 \001(\010\"&\n\006PackE7\022\017\n\007success"
-      "\030\001 \001(\010\022\013\n\003msg\030\002 \001(\tb\006proto3"
+const char descriptor_table_protodef_BBPacks_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rBBPacks.proto\022\017ProtobufPackets\"W\n\014Pack"
+  "HeaderIn\022\022\n\nserverRead\030\001 \001(\010\022\016\n\006locKey\030\002"
+  " \001(\t\022\021\n\tsendToIDs\030\003 \003(\r\022\020\n\010dataSize\030\004 \001("
+  "\r\"E\n\rPackHeaderOut\022\016\n\006locKey\030\001 \001(\t\022\022\n\nse"
+  "ntFromID\030\002 \001(\r\022\020\n\010dataSize\030\003 \001(\r\"2\n\006Pack"
+  "A0\022\014\n\004name\030\001 \001(\t\022\013\n\003pwd\030\002 \001(\t\022\r\n\005email\030\003"
+  " \001(\t\"F\n\006PackA1\022\020\n\010pwdToken\030\001 \001(\t\022\013\n\003eID\030"
+  "\002 \001(\r\022\020\n\010deviceID\030\003 \001(\r\022\013\n\003msg\030\004 \001(\t\"9\n\006"
+  "PackA2\022\013\n\003eID\030\001 \001(\r\022\020\n\010pwdToken\030\002 \001(\t\022\020\n"
+  "\010deviceID\030\003 \001(\005\"5\n\006PackA3\022\014\n\004name\030\001 \001(\t\022"
+  "\013\n\003pwd\030\002 \001(\t\022\020\n\010deviceID\030\003 \001(\r\"\027\n\006PackA4"
+  "\022\r\n\005email\030\001 \001(\t\"&\n\006PackA5\022\017\n\007success\030\001 \001"
+  "(\010\022\013\n\003msg\030\002 \001(\t\"\037\n\006PackA6\022\025\n\rpwdResetTok"
+  "en\030\001 \001(\t\"&\n\006PackA7\022\017\n\007success\030\001 \001(\010\022\013\n\003m"
+  "sg\030\002 \001(\t\",\n\006PackA8\022\025\n\rpwdResetToken\030\001 \001("
+  "\t\022\013\n\003pwd\030\002 \001(\t\"F\n\006PackA9\022\020\n\010pwdToken\030\001 \001"
+  "(\t\022\013\n\003eID\030\002 \001(\r\022\020\n\010deviceID\030\003 \001(\r\022\013\n\003msg"
+  "\030\004 \001(\t\"\027\n\006PackB0\022\r\n\005email\030\001 \001(\t\"&\n\006PackB"
+  "1\022\017\n\007success\030\001 \001(\010\022\013\n\003msg\030\002 \001(\t\"\034\n\006PackB"
+  "2\022\022\n\nemailToken\030\001 \001(\t\"&\n\006PackB3\022\017\n\007succe"
+  "ss\030\001 \001(\010\022\013\n\003msg\030\002 \001(\t\"\010\n\006PackB4\"8\n\006PackB"
+  "5\022\025\n\rverifiedEmail\030\001 \001(\t\022\027\n\017unverifiedEm"
+  "ail\030\002 \001(\t\"\025\n\006PackC0\022\013\n\003eID\030\001 \001(\r\"\026\n\006Pack"
+  "C1\022\014\n\004name\030\001 \001(\t\"\010\n\006PackC2\"\026\n\006PackC3\022\014\n\004"
+  "name\030\001 \001(\t\"\010\n\006PackD0\"g\n\006PackD1\022\024\n\014folder"
+  "ObjKey\030\001 \001(\t\022\023\n\013accessKeyID\030\002 \001(\t\022\021\n\tacc"
+  "essKey\030\003 \001(\t\022\022\n\nsessionKey\030\004 \001(\t\022\013\n\003msg\030"
+  "\005 \001(\t\"\010\n\006PackD2\"\010\n\006PackD3\"\033\n\006PackD4\022\021\n\th"
+  "asResume\030\001 \001(\010\"*\n\006PackE0\022\020\n\010pageSize\030\001 \001"
+  "(\r\022\016\n\006cursor\030\002 \001(\r\"\221\001\n\006PackE1\022\024\n\014employe"
+  "eEIDs\030\001 \003(\r\022\026\n\016unacceptedEIDs\030\002 \003(\r\022\024\n\014a"
+  "cceptedEIDs\030\003 \003(\r\022\017\n\007success\030\004 \001(\010\022\013\n\003ms"
+  "g\030\005 \001(\t\022\022\n\nnextCursor\030\006 \001(\r\022\021\n\tmorePages"
+  "\030\007 \001(\010\"%\n\006PackE2\022\013\n\003eID\030\001 \001(\r\022\016\n\006aState\030"
+  "\002 \001(\005\"3\n\006PackE3\022\017\n\007success\030\001 \001(\010\022\013\n\003msg\030"
+  "\002 \001(\t\022\013\n\003eID\030\003 \001(\r\"\010\n\006PackE4\"%\n\006PackE5\022\016"
+  "\n\006aState\030\001 \001(\005\022\013\n\003msg\030\002 \001(\t\"\030\n\006PackE6\022\016\n"
+  "\006accept\030\001 \001(\010\"&\n\006PackE7\022\017\n\007success\030\001 \001(\010"
+  "\022\013\n\003msg\030\002 \001(\tb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_BBPacks_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_BBPacks_2eproto = {
+    false, false, 1541, descriptor_table_protodef_BBPacks_2eproto,
+    "BBPacks.proto",
+    &descriptor_table_BBPacks_2eproto_once, nullptr, 0, 35,
+    schemas, file_default_instances, TableStruct_BBPacks_2eproto::offsets,
+    file_level_metadata_BBPacks_2eproto, file_level_enum_descriptors_BBPacks_2eproto,
+    file_level_service_descriptors_BBPacks_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_BBPacks_2eproto_getter() {
+  return &descriptor_table_BBPacks_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_BBPacks_2eproto(&descriptor_table_BBPacks_2eproto);
+namespace ProtobufPackets {
+
+// ===================================================================
+
+class PackHeaderIn::_Internal {
+ public:
+};
+
+PackHeaderIn::PackHeaderIn(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackHeaderIn)
+}
+PackHeaderIn::PackHeaderIn(const PackHeaderIn& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackHeaderIn* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sendtoids_){from._impl_.sendtoids_}
+    , /*decltype(_impl_._sendtoids_cached_byte_size_)*/{0}
+    , decltype(_impl_.lockey_){}
+    , decltype(_impl_.serverread_){}
+    , decltype(_impl_.datasize_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.lockey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lockey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_lockey().empty()) {
+    _this->_impl_.lockey_.Set(from._internal_lockey(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.serverread_, &from._impl_.serverread_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.datasize_) -
+    reinterpret_cast<char*>(&_impl_.serverread_)) + sizeof(_impl_.datasize_));
+  // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackHeaderIn)
+}
+
+inline void PackHeaderIn::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sendtoids_){arena}
+    , /*decltype(_impl_._sendtoids_cached_byte_size_)*/{0}
+    , decltype(_impl_.lockey_){}
+    , decltype(_impl_.serverread_){false}
+    , decltype(_impl_.datasize_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
   };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 1307);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "BBPacks.proto", &protobuf_RegisterTypes);
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_BBPacks_2eproto);
+  _impl_.lockey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lockey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PackHeaderIn::~PackHeaderIn() {
+  // @@protoc_insertion_point(destructor:ProtobufPackets.PackHeaderIn)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AddDesc_BBPacks_2eproto_once_);
-void protobuf_AddDesc_BBPacks_2eproto() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AddDesc_BBPacks_2eproto_once_,
-                 &protobuf_AddDesc_BBPacks_2eproto_impl);
+inline void PackHeaderIn::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sendtoids_.~RepeatedField();
+  _impl_.lockey_.Destroy();
 }
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_BBPacks_2eproto {
-  StaticDescriptorInitializer_BBPacks_2eproto() {
-    protobuf_AddDesc_BBPacks_2eproto();
+
+void PackHeaderIn::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PackHeaderIn::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackHeaderIn)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sendtoids_.Clear();
+  _impl_.lockey_.ClearToEmpty();
+  ::memset(&_impl_.serverread_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.datasize_) -
+      reinterpret_cast<char*>(&_impl_.serverread_)) + sizeof(_impl_.datasize_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackHeaderIn::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool serverRead = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.serverread_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string locKey = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_lockey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackHeaderIn.locKey"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 sendToIDs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_sendtoids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_sendtoids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 dataSize = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.datasize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PackHeaderIn::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackHeaderIn)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool serverRead = 1;
+  if (this->_internal_serverread() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_serverread(), target);
   }
-} static_descriptor_initializer_BBPacks_2eproto_;
 
-// ===================================================================
+  // string locKey = 2;
+  if (!this->_internal_lockey().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_lockey().data(), static_cast<int>(this->_internal_lockey().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ProtobufPackets.PackHeaderIn.locKey");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_lockey(), target);
+  }
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackA0::kNameFieldNumber;
-const int PackA0::kPwdFieldNumber;
-const int PackA0::kEmailFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+  // repeated uint32 sendToIDs = 3;
+  {
+    int byte_size = _impl_._sendtoids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_sendtoids(), byte_size, target);
+    }
+  }
 
-PackA0::PackA0()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
+  // uint32 dataSize = 4;
+  if (this->_internal_datasize() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_datasize(), target);
   }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackA0)
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackHeaderIn)
+  return target;
 }
-PackA0::PackA0(const PackA0& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  pwd_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.pwd().size() > 0) {
-    pwd_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwd_);
-  }
-  email_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.email().size() > 0) {
-    email_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.email_);
+
+size_t PackHeaderIn::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackHeaderIn)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 sendToIDs = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.sendtoids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sendtoids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA0)
+
+  // string locKey = 2;
+  if (!this->_internal_lockey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_lockey());
+  }
+
+  // bool serverRead = 1;
+  if (this->_internal_serverread() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 dataSize = 4;
+  if (this->_internal_datasize() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_datasize());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackA0::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  pwd_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  email_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackHeaderIn::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackHeaderIn::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackHeaderIn::GetClassData() const { return &_class_data_; }
+
+
+void PackHeaderIn::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackHeaderIn*>(&to_msg);
+  auto& from = static_cast<const PackHeaderIn&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackHeaderIn)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sendtoids_.MergeFrom(from._impl_.sendtoids_);
+  if (!from._internal_lockey().empty()) {
+    _this->_internal_set_lockey(from._internal_lockey());
+  }
+  if (from._internal_serverread() != 0) {
+    _this->_internal_set_serverread(from._internal_serverread());
+  }
+  if (from._internal_datasize() != 0) {
+    _this->_internal_set_datasize(from._internal_datasize());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-PackA0::~PackA0() {
-  // @@protoc_insertion_point(destructor:ProtobufPackets.PackA0)
-  SharedDtor();
+void PackHeaderIn::CopyFrom(const PackHeaderIn& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackHeaderIn)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-void PackA0::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  pwd_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  email_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+bool PackHeaderIn::IsInitialized() const {
+  return true;
 }
 
-void PackA0::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+void PackHeaderIn::InternalSwap(PackHeaderIn* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.sendtoids_.InternalSwap(&other->_impl_.sendtoids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.lockey_, lhs_arena,
+      &other->_impl_.lockey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PackHeaderIn, _impl_.datasize_)
+      + sizeof(PackHeaderIn::_impl_.datasize_)
+      - PROTOBUF_FIELD_OFFSET(PackHeaderIn, _impl_.serverread_)>(
+          reinterpret_cast<char*>(&_impl_.serverread_),
+          reinterpret_cast<char*>(&other->_impl_.serverread_));
 }
-const ::google::protobuf::Descriptor* PackA0::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[0].descriptor;
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackHeaderIn::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[0]);
 }
 
-const PackA0& PackA0::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
+// ===================================================================
+
+class PackHeaderOut::_Internal {
+ public:
+};
+
+PackHeaderOut::PackHeaderOut(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackHeaderOut)
+}
+PackHeaderOut::PackHeaderOut(const PackHeaderOut& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackHeaderOut* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lockey_){}
+    , decltype(_impl_.sentfromid_){}
+    , decltype(_impl_.datasize_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.lockey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lockey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_lockey().empty()) {
+    _this->_impl_.lockey_.Set(from._internal_lockey(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sentfromid_, &from._impl_.sentfromid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.datasize_) -
+    reinterpret_cast<char*>(&_impl_.sentfromid_)) + sizeof(_impl_.datasize_));
+  // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackHeaderOut)
+}
+
+inline void PackHeaderOut::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lockey_){}
+    , decltype(_impl_.sentfromid_){0u}
+    , decltype(_impl_.datasize_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.lockey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lockey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-PackA0* PackA0::New(::google::protobuf::Arena* arena) const {
-  PackA0* n = new PackA0;
-  if (arena != NULL) {
-    arena->Own(n);
+PackHeaderOut::~PackHeaderOut() {
+  // @@protoc_insertion_point(destructor:ProtobufPackets.PackHeaderOut)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  return n;
+  SharedDtor();
 }
 
-void PackA0::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA0)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  email_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool PackA0::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackA0)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string name = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA0.name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+inline void PackHeaderOut::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lockey_.Destroy();
+}
 
-      // string pwd = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_pwd()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->pwd().data(), this->pwd().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA0.pwd"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+void PackHeaderOut::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-      // string email = 3;
-      case 3: {
-        if (tag == 26u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_email()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->email().data(), this->email().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA0.email"));
-        } else {
+void PackHeaderOut::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackHeaderOut)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.lockey_.ClearToEmpty();
+  ::memset(&_impl_.sentfromid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.datasize_) -
+      reinterpret_cast<char*>(&_impl_.sentfromid_)) + sizeof(_impl_.datasize_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackHeaderOut::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string locKey = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_lockey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackHeaderOut.locKey"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 sentFromID = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sentfromid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 dataSize = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.datasize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackA0)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackA0)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PackA0::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackA0)
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA0.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
+uint8_t* PackHeaderOut::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackHeaderOut)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string locKey = 1;
+  if (!this->_internal_lockey().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_lockey().data(), static_cast<int>(this->_internal_lockey().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ProtobufPackets.PackHeaderOut.locKey");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_lockey(), target);
   }
 
-  // string pwd = 2;
-  if (this->pwd().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwd().data(), this->pwd().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA0.pwd");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->pwd(), output);
+  // uint32 sentFromID = 2;
+  if (this->_internal_sentfromid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_sentfromid(), target);
   }
 
-  // string email = 3;
-  if (this->email().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->email().data(), this->email().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA0.email");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->email(), output);
+  // uint32 dataSize = 3;
+  if (this->_internal_datasize() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_datasize(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackHeaderOut)
+  return target;
+}
+
+size_t PackHeaderOut::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackHeaderOut)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string locKey = 1;
+  if (!this->_internal_lockey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_lockey());
+  }
+
+  // uint32 sentFromID = 2;
+  if (this->_internal_sentfromid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sentfromid());
   }
 
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackA0)
+  // uint32 dataSize = 3;
+  if (this->_internal_datasize() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_datasize());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-::google::protobuf::uint8* PackA0::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackHeaderOut::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackHeaderOut::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackHeaderOut::GetClassData() const { return &_class_data_; }
+
+
+void PackHeaderOut::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackHeaderOut*>(&to_msg);
+  auto& from = static_cast<const PackHeaderOut&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackHeaderOut)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_lockey().empty()) {
+    _this->_internal_set_lockey(from._internal_lockey());
+  }
+  if (from._internal_sentfromid() != 0) {
+    _this->_internal_set_sentfromid(from._internal_sentfromid());
+  }
+  if (from._internal_datasize() != 0) {
+    _this->_internal_set_datasize(from._internal_datasize());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PackHeaderOut::CopyFrom(const PackHeaderOut& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackHeaderOut)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PackHeaderOut::IsInitialized() const {
+  return true;
+}
+
+void PackHeaderOut::InternalSwap(PackHeaderOut* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.lockey_, lhs_arena,
+      &other->_impl_.lockey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PackHeaderOut, _impl_.datasize_)
+      + sizeof(PackHeaderOut::_impl_.datasize_)
+      - PROTOBUF_FIELD_OFFSET(PackHeaderOut, _impl_.sentfromid_)>(
+          reinterpret_cast<char*>(&_impl_.sentfromid_),
+          reinterpret_cast<char*>(&other->_impl_.sentfromid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackHeaderOut::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[1]);
+}
+
+// ===================================================================
+
+class PackA0::_Internal {
+ public:
+};
+
+PackA0::PackA0(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackA0)
+}
+PackA0::PackA0(const PackA0& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackA0* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.pwd_){}
+    , decltype(_impl_.email_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.pwd_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pwd().empty()) {
+    _this->_impl_.pwd_.Set(from._internal_pwd(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.email_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.email_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_email().empty()) {
+    _this->_impl_.email_.Set(from._internal_email(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA0)
+}
+
+inline void PackA0::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.pwd_){}
+    , decltype(_impl_.email_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.pwd_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.email_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.email_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PackA0::~PackA0() {
+  // @@protoc_insertion_point(destructor:ProtobufPackets.PackA0)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PackA0::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.pwd_.Destroy();
+  _impl_.email_.Destroy();
+}
+
+void PackA0::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PackA0::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA0)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.pwd_.ClearToEmpty();
+  _impl_.email_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackA0::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA0.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string pwd = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_pwd();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA0.pwd"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string email = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_email();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA0.email"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PackA0::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackA0)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA0.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // string pwd = 2;
-  if (this->pwd().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwd().data(), this->pwd().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_pwd().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_pwd().data(), static_cast<int>(this->_internal_pwd().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA0.pwd");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->pwd(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_pwd(), target);
   }
 
   // string email = 3;
-  if (this->email().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->email().data(), this->email().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_email().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_email().data(), static_cast<int>(this->_internal_email().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA0.email");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->email(), target);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_email(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackA0)
   return target;
 }
@@ -792,72 +1706,59 @@ size_t PackA0::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackA0)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   // string pwd = 2;
-  if (this->pwd().size() > 0) {
+  if (!this->_internal_pwd().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->pwd());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_pwd());
   }
 
   // string email = 3;
-  if (this->email().size() > 0) {
+  if (!this->_internal_email().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->email());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_email());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackA0::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackA0)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackA0* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackA0>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackA0)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackA0)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackA0::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackA0::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackA0::GetClassData() const { return &_class_data_; }
 
-void PackA0::MergeFrom(const PackA0& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA0)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  if (from.pwd().size() > 0) {
+void PackA0::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackA0*>(&to_msg);
+  auto& from = static_cast<const PackA0&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA0)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    pwd_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwd_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.email().size() > 0) {
-
-    email_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.email_);
+  if (!from._internal_pwd().empty()) {
+    _this->_internal_set_pwd(from._internal_pwd());
   }
-}
-
-void PackA0::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackA0)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackA0::CopyFrom(const PackA0& from) {
@@ -871,403 +1772,237 @@ bool PackA0::IsInitialized() const {
   return true;
 }
 
-void PackA0::Swap(PackA0* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackA0::InternalSwap(PackA0* other) {
-  name_.Swap(&other->name_);
-  pwd_.Swap(&other->pwd_);
-  email_.Swap(&other->email_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackA0::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[0];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackA0
-
-// string name = 1;
-void PackA0::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA0::name() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA0.name)
-  return name_.GetNoArena();
-}
-void PackA0::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA0.name)
-}
-void PackA0::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA0.name)
-}
-void PackA0::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA0.name)
-}
-::std::string* PackA0::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA0.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA0::release_name() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA0.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA0::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
-    
-  } else {
-    
-  }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA0.name)
-}
-
-// string pwd = 2;
-void PackA0::clear_pwd() {
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA0::pwd() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA0.pwd)
-  return pwd_.GetNoArena();
-}
-void PackA0::set_pwd(const ::std::string& value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA0.pwd)
-}
-void PackA0::set_pwd(const char* value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA0.pwd)
-}
-void PackA0::set_pwd(const char* value, size_t size) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA0.pwd)
-}
-::std::string* PackA0::mutable_pwd() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA0.pwd)
-  return pwd_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA0::release_pwd() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA0.pwd)
-  
-  return pwd_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA0::set_allocated_pwd(::std::string* pwd) {
-  if (pwd != NULL) {
-    
-  } else {
-    
-  }
-  pwd_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwd);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA0.pwd)
-}
-
-// string email = 3;
-void PackA0::clear_email() {
-  email_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pwd_, lhs_arena,
+      &other->_impl_.pwd_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.email_, lhs_arena,
+      &other->_impl_.email_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackA0::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[2]);
 }
-const ::std::string& PackA0::email() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA0.email)
-  return email_.GetNoArena();
-}
-void PackA0::set_email(const ::std::string& value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA0.email)
-}
-void PackA0::set_email(const char* value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA0.email)
-}
-void PackA0::set_email(const char* value, size_t size) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA0.email)
-}
-::std::string* PackA0::mutable_email() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA0.email)
-  return email_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA0::release_email() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA0.email)
-  
-  return email_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA0::set_allocated_email(::std::string* email) {
-  if (email != NULL) {
-    
-  } else {
-    
-  }
-  email_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), email);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA0.email)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackA1::kPwdTokenFieldNumber;
-const int PackA1::kEIDFieldNumber;
-const int PackA1::kDeviceIDFieldNumber;
-const int PackA1::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackA1::_Internal {
+ public:
+};
 
-PackA1::PackA1()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackA1)
+PackA1::PackA1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackA1)
 }
 PackA1::PackA1(const PackA1& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  pwdtoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.pwdtoken().size() > 0) {
-    pwdtoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwdtoken_);
-  }
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  ::memcpy(&eid_, &from.eid_,
-    reinterpret_cast<char*>(&deviceid_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(deviceid_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackA1* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pwdtoken_){}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.eid_){}
+    , decltype(_impl_.deviceid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.pwdtoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwdtoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pwdtoken().empty()) {
+    _this->_impl_.pwdtoken_.Set(from._internal_pwdtoken(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.eid_, &from._impl_.eid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.deviceid_) -
+    reinterpret_cast<char*>(&_impl_.eid_)) + sizeof(_impl_.deviceid_));
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA1)
 }
 
-void PackA1::SharedCtor() {
-  pwdtoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&eid_, 0, reinterpret_cast<char*>(&deviceid_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(deviceid_));
-  _cached_size_ = 0;
+inline void PackA1::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pwdtoken_){}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.eid_){0u}
+    , decltype(_impl_.deviceid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.pwdtoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwdtoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackA1::~PackA1() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackA1)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackA1::SharedDtor() {
-  pwdtoken_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackA1::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pwdtoken_.Destroy();
+  _impl_.msg_.Destroy();
 }
 
 void PackA1::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackA1::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[1].descriptor;
-}
-
-const PackA1& PackA1::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackA1* PackA1::New(::google::protobuf::Arena* arena) const {
-  PackA1* n = new PackA1;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackA1::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA1)
-  pwdtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&eid_, 0, reinterpret_cast<char*>(&deviceid_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(deviceid_));
-}
-
-bool PackA1::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackA1)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pwdtoken_.ClearToEmpty();
+  _impl_.msg_.ClearToEmpty();
+  ::memset(&_impl_.eid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.deviceid_) -
+      reinterpret_cast<char*>(&_impl_.eid_)) + sizeof(_impl_.deviceid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackA1::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string pwdToken = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_pwdtoken()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->pwdtoken().data(), this->pwdtoken().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA1.pwdToken"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_pwdtoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA1.pwdToken"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 eID = 2;
-      case 2: {
-        if (tag == 16u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &eid_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.eid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 deviceID = 3;
-      case 3: {
-        if (tag == 24u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &deviceid_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.deviceid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 4;
-      case 4: {
-        if (tag == 34u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA1.msg"));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA1.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackA1)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackA1)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PackA1::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackA1)
-  // string pwdToken = 1;
-  if (this->pwdtoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwdtoken().data(), this->pwdtoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA1.pwdToken");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->pwdtoken(), output);
-  }
-
-  // uint32 eID = 2;
-  if (this->eid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->eid(), output);
-  }
-
-  // uint32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->deviceid(), output);
-  }
-
-  // string msg = 4;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA1.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->msg(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackA1)
-}
-
-::google::protobuf::uint8* PackA1::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackA1::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackA1)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string pwdToken = 1;
-  if (this->pwdtoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwdtoken().data(), this->pwdtoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_pwdtoken().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_pwdtoken().data(), static_cast<int>(this->_internal_pwdtoken().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA1.pwdToken");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->pwdtoken(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_pwdtoken(), target);
   }
 
   // uint32 eID = 2;
-  if (this->eid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->eid(), target);
+  if (this->_internal_eid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_eid(), target);
   }
 
   // uint32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->deviceid(), target);
+  if (this->_internal_deviceid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_deviceid(), target);
   }
 
   // string msg = 4;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA1.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_msg(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackA1)
   return target;
 }
@@ -1276,432 +2011,275 @@ size_t PackA1::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackA1)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string pwdToken = 1;
-  if (this->pwdtoken().size() > 0) {
+  if (!this->_internal_pwdtoken().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->pwdtoken());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_pwdtoken());
   }
 
   // string msg = 4;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
   // uint32 eID = 2;
-  if (this->eid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->eid());
+  if (this->_internal_eid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eid());
   }
 
   // uint32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->deviceid());
-  }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void PackA1::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackA1)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackA1* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackA1>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackA1)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackA1)
-    MergeFrom(*source);
-  }
-}
-
-void PackA1::MergeFrom(const PackA1& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA1)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.pwdtoken().size() > 0) {
-
-    pwdtoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwdtoken_);
-  }
-  if (from.msg().size() > 0) {
-
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  if (from.eid() != 0) {
-    set_eid(from.eid());
+  if (this->_internal_deviceid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_deviceid());
   }
-  if (from.deviceid() != 0) {
-    set_deviceid(from.deviceid());
-  }
-}
 
-void PackA1::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackA1)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackA1::CopyFrom(const PackA1& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackA1)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool PackA1::IsInitialized() const {
-  return true;
-}
-
-void PackA1::Swap(PackA1* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PackA1::InternalSwap(PackA1* other) {
-  pwdtoken_.Swap(&other->pwdtoken_);
-  msg_.Swap(&other->msg_);
-  std::swap(eid_, other->eid_);
-  std::swap(deviceid_, other->deviceid_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackA1::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackA1::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackA1::GetClassData() const { return &_class_data_; }
 
-::google::protobuf::Metadata PackA1::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[1];
-}
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackA1
+void PackA1::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackA1*>(&to_msg);
+  auto& from = static_cast<const PackA1&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA1)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-// string pwdToken = 1;
-void PackA1::clear_pwdtoken() {
-  pwdtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA1::pwdtoken() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA1.pwdToken)
-  return pwdtoken_.GetNoArena();
-}
-void PackA1::set_pwdtoken(const ::std::string& value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA1.pwdToken)
-}
-void PackA1::set_pwdtoken(const char* value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA1.pwdToken)
-}
-void PackA1::set_pwdtoken(const char* value, size_t size) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA1.pwdToken)
-}
-::std::string* PackA1::mutable_pwdtoken() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA1.pwdToken)
-  return pwdtoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA1::release_pwdtoken() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA1.pwdToken)
-  
-  return pwdtoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA1::set_allocated_pwdtoken(::std::string* pwdtoken) {
-  if (pwdtoken != NULL) {
-    
-  } else {
-    
+  if (!from._internal_pwdtoken().empty()) {
+    _this->_internal_set_pwdtoken(from._internal_pwdtoken());
+  }
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
+  }
+  if (from._internal_eid() != 0) {
+    _this->_internal_set_eid(from._internal_eid());
   }
-  pwdtoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwdtoken);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA1.pwdToken)
+  if (from._internal_deviceid() != 0) {
+    _this->_internal_set_deviceid(from._internal_deviceid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-// uint32 eID = 2;
-void PackA1::clear_eid() {
-  eid_ = 0u;
-}
-::google::protobuf::uint32 PackA1::eid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA1.eID)
-  return eid_;
-}
-void PackA1::set_eid(::google::protobuf::uint32 value) {
-  
-  eid_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA1.eID)
+void PackA1::CopyFrom(const PackA1& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackA1)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-// uint32 deviceID = 3;
-void PackA1::clear_deviceid() {
-  deviceid_ = 0u;
-}
-::google::protobuf::uint32 PackA1::deviceid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA1.deviceID)
-  return deviceid_;
-}
-void PackA1::set_deviceid(::google::protobuf::uint32 value) {
-  
-  deviceid_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA1.deviceID)
+bool PackA1::IsInitialized() const {
+  return true;
 }
 
-// string msg = 4;
-void PackA1::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA1::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA1.msg)
-  return msg_.GetNoArena();
-}
-void PackA1::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA1.msg)
-}
-void PackA1::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA1.msg)
-}
-void PackA1::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA1.msg)
-}
-::std::string* PackA1::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA1.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA1::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA1.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA1::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA1.msg)
+void PackA1::InternalSwap(PackA1* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pwdtoken_, lhs_arena,
+      &other->_impl_.pwdtoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PackA1, _impl_.deviceid_)
+      + sizeof(PackA1::_impl_.deviceid_)
+      - PROTOBUF_FIELD_OFFSET(PackA1, _impl_.eid_)>(
+          reinterpret_cast<char*>(&_impl_.eid_),
+          reinterpret_cast<char*>(&other->_impl_.eid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackA1::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[3]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackA2::kEIDFieldNumber;
-const int PackA2::kPwdTokenFieldNumber;
-const int PackA2::kDeviceIDFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackA2::_Internal {
+ public:
+};
 
-PackA2::PackA2()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackA2)
+PackA2::PackA2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackA2)
 }
 PackA2::PackA2(const PackA2& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  pwdtoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.pwdtoken().size() > 0) {
-    pwdtoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwdtoken_);
-  }
-  ::memcpy(&eid_, &from.eid_,
-    reinterpret_cast<char*>(&deviceid_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(deviceid_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackA2* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pwdtoken_){}
+    , decltype(_impl_.eid_){}
+    , decltype(_impl_.deviceid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.pwdtoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwdtoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pwdtoken().empty()) {
+    _this->_impl_.pwdtoken_.Set(from._internal_pwdtoken(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.eid_, &from._impl_.eid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.deviceid_) -
+    reinterpret_cast<char*>(&_impl_.eid_)) + sizeof(_impl_.deviceid_));
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA2)
 }
 
-void PackA2::SharedCtor() {
-  pwdtoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&eid_, 0, reinterpret_cast<char*>(&deviceid_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(deviceid_));
-  _cached_size_ = 0;
+inline void PackA2::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pwdtoken_){}
+    , decltype(_impl_.eid_){0u}
+    , decltype(_impl_.deviceid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.pwdtoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwdtoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackA2::~PackA2() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackA2)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackA2::SharedDtor() {
-  pwdtoken_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackA2::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pwdtoken_.Destroy();
 }
 
 void PackA2::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackA2::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[2].descriptor;
-}
-
-const PackA2& PackA2::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackA2* PackA2::New(::google::protobuf::Arena* arena) const {
-  PackA2* n = new PackA2;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackA2::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA2)
-  pwdtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&eid_, 0, reinterpret_cast<char*>(&deviceid_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(deviceid_));
-}
-
-bool PackA2::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackA2)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pwdtoken_.ClearToEmpty();
+  ::memset(&_impl_.eid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.deviceid_) -
+      reinterpret_cast<char*>(&_impl_.eid_)) + sizeof(_impl_.deviceid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackA2::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 eID = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &eid_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.eid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string pwdToken = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_pwdtoken()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->pwdtoken().data(), this->pwdtoken().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA2.pwdToken"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_pwdtoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA2.pwdToken"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 deviceID = 3;
-      case 3: {
-        if (tag == 24u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &deviceid_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.deviceid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackA2)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackA2)
-  return false;
-#undef DO_
-}
-
-void PackA2::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackA2)
-  // uint32 eID = 1;
-  if (this->eid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->eid(), output);
-  }
-
-  // string pwdToken = 2;
-  if (this->pwdtoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwdtoken().data(), this->pwdtoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA2.pwdToken");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->pwdtoken(), output);
-  }
-
-  // int32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->deviceid(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackA2)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackA2::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackA2::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackA2)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // uint32 eID = 1;
-  if (this->eid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->eid(), target);
+  if (this->_internal_eid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_eid(), target);
   }
 
   // string pwdToken = 2;
-  if (this->pwdtoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwdtoken().data(), this->pwdtoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_pwdtoken().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_pwdtoken().data(), static_cast<int>(this->_internal_pwdtoken().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA2.pwdToken");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->pwdtoken(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_pwdtoken(), target);
   }
 
   // int32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->deviceid(), target);
+  if (this->_internal_deviceid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_deviceid(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackA2)
   return target;
 }
@@ -1710,70 +2288,55 @@ size_t PackA2::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackA2)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string pwdToken = 2;
-  if (this->pwdtoken().size() > 0) {
+  if (!this->_internal_pwdtoken().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->pwdtoken());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_pwdtoken());
   }
 
   // uint32 eID = 1;
-  if (this->eid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->eid());
+  if (this->_internal_eid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eid());
   }
 
   // int32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->deviceid());
+  if (this->_internal_deviceid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_deviceid());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackA2::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackA2)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackA2* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackA2>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackA2)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackA2)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackA2::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackA2::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackA2::GetClassData() const { return &_class_data_; }
+
 
-void PackA2::MergeFrom(const PackA2& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA2)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.pwdtoken().size() > 0) {
+void PackA2::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackA2*>(&to_msg);
+  auto& from = static_cast<const PackA2&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA2)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    pwdtoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwdtoken_);
+  if (!from._internal_pwdtoken().empty()) {
+    _this->_internal_set_pwdtoken(from._internal_pwdtoken());
   }
-  if (from.eid() != 0) {
-    set_eid(from.eid());
+  if (from._internal_eid() != 0) {
+    _this->_internal_set_eid(from._internal_eid());
   }
-  if (from.deviceid() != 0) {
-    set_deviceid(from.deviceid());
+  if (from._internal_deviceid() != 0) {
+    _this->_internal_set_deviceid(from._internal_deviceid());
   }
-}
-
-void PackA2::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackA2)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackA2::CopyFrom(const PackA2& from) {
@@ -1787,315 +2350,215 @@ bool PackA2::IsInitialized() const {
   return true;
 }
 
-void PackA2::Swap(PackA2* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackA2::InternalSwap(PackA2* other) {
-  pwdtoken_.Swap(&other->pwdtoken_);
-  std::swap(eid_, other->eid_);
-  std::swap(deviceid_, other->deviceid_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackA2::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[2];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackA2
-
-// uint32 eID = 1;
-void PackA2::clear_eid() {
-  eid_ = 0u;
-}
-::google::protobuf::uint32 PackA2::eid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA2.eID)
-  return eid_;
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pwdtoken_, lhs_arena,
+      &other->_impl_.pwdtoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PackA2, _impl_.deviceid_)
+      + sizeof(PackA2::_impl_.deviceid_)
+      - PROTOBUF_FIELD_OFFSET(PackA2, _impl_.eid_)>(
+          reinterpret_cast<char*>(&_impl_.eid_),
+          reinterpret_cast<char*>(&other->_impl_.eid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackA2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[4]);
 }
-void PackA2::set_eid(::google::protobuf::uint32 value) {
-  
-  eid_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA2.eID)
-}
-
-// string pwdToken = 2;
-void PackA2::clear_pwdtoken() {
-  pwdtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA2::pwdtoken() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA2.pwdToken)
-  return pwdtoken_.GetNoArena();
-}
-void PackA2::set_pwdtoken(const ::std::string& value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA2.pwdToken)
-}
-void PackA2::set_pwdtoken(const char* value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA2.pwdToken)
-}
-void PackA2::set_pwdtoken(const char* value, size_t size) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA2.pwdToken)
-}
-::std::string* PackA2::mutable_pwdtoken() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA2.pwdToken)
-  return pwdtoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA2::release_pwdtoken() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA2.pwdToken)
-  
-  return pwdtoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA2::set_allocated_pwdtoken(::std::string* pwdtoken) {
-  if (pwdtoken != NULL) {
-    
-  } else {
-    
-  }
-  pwdtoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwdtoken);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA2.pwdToken)
-}
-
-// int32 deviceID = 3;
-void PackA2::clear_deviceid() {
-  deviceid_ = 0;
-}
-::google::protobuf::int32 PackA2::deviceid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA2.deviceID)
-  return deviceid_;
-}
-void PackA2::set_deviceid(::google::protobuf::int32 value) {
-  
-  deviceid_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA2.deviceID)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackA3::kNameFieldNumber;
-const int PackA3::kPwdFieldNumber;
-const int PackA3::kDeviceIDFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackA3::_Internal {
+ public:
+};
 
-PackA3::PackA3()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackA3)
+PackA3::PackA3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackA3)
 }
 PackA3::PackA3(const PackA3& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  pwd_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.pwd().size() > 0) {
-    pwd_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwd_);
-  }
-  deviceid_ = from.deviceid_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackA3* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.pwd_){}
+    , decltype(_impl_.deviceid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.pwd_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pwd().empty()) {
+    _this->_impl_.pwd_.Set(from._internal_pwd(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.deviceid_ = from._impl_.deviceid_;
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA3)
 }
 
-void PackA3::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  pwd_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  deviceid_ = 0u;
-  _cached_size_ = 0;
+inline void PackA3::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.pwd_){}
+    , decltype(_impl_.deviceid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.pwd_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackA3::~PackA3() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackA3)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackA3::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  pwd_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackA3::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.pwd_.Destroy();
 }
 
 void PackA3::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackA3::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[3].descriptor;
-}
-
-const PackA3& PackA3::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackA3* PackA3::New(::google::protobuf::Arena* arena) const {
-  PackA3* n = new PackA3;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackA3::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA3)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  deviceid_ = 0u;
-}
-
-bool PackA3::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackA3)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.pwd_.ClearToEmpty();
+  _impl_.deviceid_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackA3::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string name = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA3.name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA3.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string pwd = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_pwd()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->pwd().data(), this->pwd().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA3.pwd"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_pwd();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA3.pwd"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 deviceID = 3;
-      case 3: {
-        if (tag == 24u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &deviceid_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.deviceid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackA3)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackA3)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PackA3::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackA3)
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA3.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // string pwd = 2;
-  if (this->pwd().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwd().data(), this->pwd().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA3.pwd");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->pwd(), output);
-  }
-
-  // uint32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->deviceid(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackA3)
-}
-
-::google::protobuf::uint8* PackA3::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackA3::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackA3)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA3.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // string pwd = 2;
-  if (this->pwd().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwd().data(), this->pwd().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_pwd().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_pwd().data(), static_cast<int>(this->_internal_pwd().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA3.pwd");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->pwd(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_pwd(), target);
   }
 
   // uint32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->deviceid(), target);
+  if (this->_internal_deviceid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_deviceid(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackA3)
   return target;
 }
@@ -2104,71 +2567,57 @@ size_t PackA3::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackA3)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   // string pwd = 2;
-  if (this->pwd().size() > 0) {
+  if (!this->_internal_pwd().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->pwd());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_pwd());
   }
 
   // uint32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->deviceid());
+  if (this->_internal_deviceid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_deviceid());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackA3::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackA3)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackA3* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackA3>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackA3)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackA3)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackA3::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackA3::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackA3::GetClassData() const { return &_class_data_; }
 
-void PackA3::MergeFrom(const PackA3& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA3)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  if (from.pwd().size() > 0) {
+void PackA3::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackA3*>(&to_msg);
+  auto& from = static_cast<const PackA3&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA3)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    pwd_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwd_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.deviceid() != 0) {
-    set_deviceid(from.deviceid());
+  if (!from._internal_pwd().empty()) {
+    _this->_internal_set_pwd(from._internal_pwd());
   }
-}
-
-void PackA3::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackA3)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_deviceid() != 0) {
+    _this->_internal_set_deviceid(from._internal_deviceid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackA3::CopyFrom(const PackA3& from) {
@@ -2182,274 +2631,160 @@ bool PackA3::IsInitialized() const {
   return true;
 }
 
-void PackA3::Swap(PackA3* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackA3::InternalSwap(PackA3* other) {
-  name_.Swap(&other->name_);
-  pwd_.Swap(&other->pwd_);
-  std::swap(deviceid_, other->deviceid_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackA3::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[3];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackA3
-
-// string name = 1;
-void PackA3::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA3::name() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA3.name)
-  return name_.GetNoArena();
-}
-void PackA3::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA3.name)
-}
-void PackA3::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA3.name)
-}
-void PackA3::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA3.name)
-}
-::std::string* PackA3::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA3.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA3::release_name() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA3.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA3::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
-    
-  } else {
-    
-  }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA3.name)
-}
-
-// string pwd = 2;
-void PackA3::clear_pwd() {
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA3::pwd() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA3.pwd)
-  return pwd_.GetNoArena();
-}
-void PackA3::set_pwd(const ::std::string& value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA3.pwd)
-}
-void PackA3::set_pwd(const char* value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA3.pwd)
-}
-void PackA3::set_pwd(const char* value, size_t size) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA3.pwd)
-}
-::std::string* PackA3::mutable_pwd() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA3.pwd)
-  return pwd_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA3::release_pwd() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA3.pwd)
-  
-  return pwd_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA3::set_allocated_pwd(::std::string* pwd) {
-  if (pwd != NULL) {
-    
-  } else {
-    
-  }
-  pwd_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwd);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA3.pwd)
-}
-
-// uint32 deviceID = 3;
-void PackA3::clear_deviceid() {
-  deviceid_ = 0u;
-}
-::google::protobuf::uint32 PackA3::deviceid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA3.deviceID)
-  return deviceid_;
-}
-void PackA3::set_deviceid(::google::protobuf::uint32 value) {
-  
-  deviceid_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA3.deviceID)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pwd_, lhs_arena,
+      &other->_impl_.pwd_, rhs_arena
+  );
+  swap(_impl_.deviceid_, other->_impl_.deviceid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackA3::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[5]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackA4::kEmailFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackA4::_Internal {
+ public:
+};
 
-PackA4::PackA4()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackA4)
+PackA4::PackA4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackA4)
 }
 PackA4::PackA4(const PackA4& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  email_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.email().size() > 0) {
-    email_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.email_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackA4* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.email_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.email_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.email_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_email().empty()) {
+    _this->_impl_.email_.Set(from._internal_email(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA4)
 }
 
-void PackA4::SharedCtor() {
-  email_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void PackA4::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.email_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.email_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.email_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackA4::~PackA4() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackA4)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackA4::SharedDtor() {
-  email_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackA4::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.email_.Destroy();
 }
 
 void PackA4::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackA4::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[4].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackA4& PackA4::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackA4::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA4)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackA4* PackA4::New(::google::protobuf::Arena* arena) const {
-  PackA4* n = new PackA4;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.email_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackA4::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA4)
-  email_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool PackA4::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackA4)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackA4::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string email = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_email()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->email().data(), this->email().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA4.email"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_email();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA4.email"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackA4)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackA4)
-  return false;
-#undef DO_
-}
-
-void PackA4::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackA4)
-  // string email = 1;
-  if (this->email().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->email().data(), this->email().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA4.email");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->email(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackA4)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackA4::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackA4::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackA4)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string email = 1;
-  if (this->email().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->email().data(), this->email().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_email().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_email().data(), static_cast<int>(this->_internal_email().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA4.email");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->email(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_email(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackA4)
   return target;
 }
@@ -2458,50 +2793,39 @@ size_t PackA4::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackA4)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string email = 1;
-  if (this->email().size() > 0) {
+  if (!this->_internal_email().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->email());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_email());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackA4::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackA4)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackA4* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackA4>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackA4)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackA4)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackA4::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackA4::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackA4::GetClassData() const { return &_class_data_; }
 
-void PackA4::MergeFrom(const PackA4& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA4)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.email().size() > 0) {
 
-    email_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.email_);
-  }
-}
+void PackA4::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackA4*>(&to_msg);
+  auto& from = static_cast<const PackA4&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA4)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void PackA4::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackA4)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackA4::CopyFrom(const PackA4& from) {
@@ -2515,241 +2839,173 @@ bool PackA4::IsInitialized() const {
   return true;
 }
 
-void PackA4::Swap(PackA4* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackA4::InternalSwap(PackA4* other) {
-  email_.Swap(&other->email_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackA4::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[4];
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.email_, lhs_arena,
+      &other->_impl_.email_, rhs_arena
+  );
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackA4
-
-// string email = 1;
-void PackA4::clear_email() {
-  email_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA4::email() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA4.email)
-  return email_.GetNoArena();
-}
-void PackA4::set_email(const ::std::string& value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA4.email)
-}
-void PackA4::set_email(const char* value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA4.email)
-}
-void PackA4::set_email(const char* value, size_t size) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA4.email)
-}
-::std::string* PackA4::mutable_email() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA4.email)
-  return email_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA4::release_email() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA4.email)
-  
-  return email_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA4::set_allocated_email(::std::string* email) {
-  if (email != NULL) {
-    
-  } else {
-    
-  }
-  email_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), email);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA4.email)
+::PROTOBUF_NAMESPACE_ID::Metadata PackA4::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[6]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackA5::kSuccessFieldNumber;
-const int PackA5::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackA5::_Internal {
+ public:
+};
 
-PackA5::PackA5()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackA5)
+PackA5::PackA5(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackA5)
 }
 PackA5::PackA5(const PackA5& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  success_ = from.success_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackA5* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA5)
 }
 
-void PackA5::SharedCtor() {
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-  _cached_size_ = 0;
+inline void PackA5::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackA5::~PackA5() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackA5)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackA5::SharedDtor() {
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackA5::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_.Destroy();
 }
 
 void PackA5::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackA5::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[5].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackA5& PackA5::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackA5::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA5)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackA5* PackA5::New(::google::protobuf::Arena* arena) const {
-  PackA5* n = new PackA5;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.msg_.ClearToEmpty();
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackA5::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA5)
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-}
-
-bool PackA5::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackA5)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackA5::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA5.msg"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA5.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackA5)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackA5)
-  return false;
-#undef DO_
-}
-
-void PackA5::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackA5)
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA5.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->msg(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackA5)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackA5::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackA5::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackA5)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA5.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackA5)
   return target;
 }
@@ -2758,294 +3014,210 @@ size_t PackA5::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackA5)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string msg = 2;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackA5::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackA5)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackA5* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackA5>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackA5)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackA5)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackA5::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackA5::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackA5::GetClassData() const { return &_class_data_; }
+
 
-void PackA5::MergeFrom(const PackA5& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA5)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.msg().size() > 0) {
+void PackA5::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackA5*>(&to_msg);
+  auto& from = static_cast<const PackA5&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA5)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void PackA5::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackA5)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackA5::CopyFrom(const PackA5& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackA5)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
-}
-
-bool PackA5::IsInitialized() const {
-  return true;
-}
-
-void PackA5::Swap(PackA5* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PackA5::InternalSwap(PackA5* other) {
-  msg_.Swap(&other->msg_);
-  std::swap(success_, other->success_);
-  std::swap(_cached_size_, other->_cached_size_);
+  MergeFrom(from);
 }
 
-::google::protobuf::Metadata PackA5::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[5];
+bool PackA5::IsInitialized() const {
+  return true;
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackA5
-
-// bool success = 1;
-void PackA5::clear_success() {
-  success_ = false;
-}
-bool PackA5::success() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA5.success)
-  return success_;
-}
-void PackA5::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA5.success)
+void PackA5::InternalSwap(PackA5* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  swap(_impl_.success_, other->_impl_.success_);
 }
 
-// string msg = 2;
-void PackA5::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA5::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA5.msg)
-  return msg_.GetNoArena();
+::PROTOBUF_NAMESPACE_ID::Metadata PackA5::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[7]);
 }
-void PackA5::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA5.msg)
-}
-void PackA5::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA5.msg)
-}
-void PackA5::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA5.msg)
-}
-::std::string* PackA5::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA5.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA5::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA5.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA5::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA5.msg)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackA6::kPwdResetTokenFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackA6::_Internal {
+ public:
+};
 
-PackA6::PackA6()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackA6)
+PackA6::PackA6(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackA6)
 }
 PackA6::PackA6(const PackA6& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  pwdresettoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.pwdresettoken().size() > 0) {
-    pwdresettoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwdresettoken_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackA6* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pwdresettoken_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.pwdresettoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwdresettoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pwdresettoken().empty()) {
+    _this->_impl_.pwdresettoken_.Set(from._internal_pwdresettoken(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA6)
 }
 
-void PackA6::SharedCtor() {
-  pwdresettoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void PackA6::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pwdresettoken_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.pwdresettoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwdresettoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackA6::~PackA6() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackA6)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackA6::SharedDtor() {
-  pwdresettoken_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackA6::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pwdresettoken_.Destroy();
 }
 
 void PackA6::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackA6::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[6].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackA6& PackA6::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackA6::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA6)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackA6* PackA6::New(::google::protobuf::Arena* arena) const {
-  PackA6* n = new PackA6;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.pwdresettoken_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackA6::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA6)
-  pwdresettoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool PackA6::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackA6)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackA6::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string pwdResetToken = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_pwdresettoken()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->pwdresettoken().data(), this->pwdresettoken().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA6.pwdResetToken"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_pwdresettoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA6.pwdResetToken"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackA6)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackA6)
-  return false;
-#undef DO_
-}
-
-void PackA6::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackA6)
-  // string pwdResetToken = 1;
-  if (this->pwdresettoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwdresettoken().data(), this->pwdresettoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA6.pwdResetToken");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->pwdresettoken(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackA6)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackA6::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackA6::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackA6)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string pwdResetToken = 1;
-  if (this->pwdresettoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwdresettoken().data(), this->pwdresettoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_pwdresettoken().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_pwdresettoken().data(), static_cast<int>(this->_internal_pwdresettoken().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA6.pwdResetToken");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->pwdresettoken(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_pwdresettoken(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackA6)
   return target;
 }
@@ -3054,50 +3226,39 @@ size_t PackA6::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackA6)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string pwdResetToken = 1;
-  if (this->pwdresettoken().size() > 0) {
+  if (!this->_internal_pwdresettoken().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->pwdresettoken());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_pwdresettoken());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackA6::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackA6)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackA6* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackA6>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackA6)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackA6)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackA6::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackA6::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackA6::GetClassData() const { return &_class_data_; }
 
-void PackA6::MergeFrom(const PackA6& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA6)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.pwdresettoken().size() > 0) {
 
-    pwdresettoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwdresettoken_);
-  }
-}
+void PackA6::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackA6*>(&to_msg);
+  auto& from = static_cast<const PackA6&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA6)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void PackA6::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackA6)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_pwdresettoken().empty()) {
+    _this->_internal_set_pwdresettoken(from._internal_pwdresettoken());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackA6::CopyFrom(const PackA6& from) {
@@ -3111,241 +3272,173 @@ bool PackA6::IsInitialized() const {
   return true;
 }
 
-void PackA6::Swap(PackA6* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackA6::InternalSwap(PackA6* other) {
-  pwdresettoken_.Swap(&other->pwdresettoken_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackA6::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[6];
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pwdresettoken_, lhs_arena,
+      &other->_impl_.pwdresettoken_, rhs_arena
+  );
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackA6
-
-// string pwdResetToken = 1;
-void PackA6::clear_pwdresettoken() {
-  pwdresettoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA6::pwdresettoken() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA6.pwdResetToken)
-  return pwdresettoken_.GetNoArena();
-}
-void PackA6::set_pwdresettoken(const ::std::string& value) {
-  
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA6.pwdResetToken)
-}
-void PackA6::set_pwdresettoken(const char* value) {
-  
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA6.pwdResetToken)
-}
-void PackA6::set_pwdresettoken(const char* value, size_t size) {
-  
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA6.pwdResetToken)
-}
-::std::string* PackA6::mutable_pwdresettoken() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA6.pwdResetToken)
-  return pwdresettoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA6::release_pwdresettoken() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA6.pwdResetToken)
-  
-  return pwdresettoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA6::set_allocated_pwdresettoken(::std::string* pwdresettoken) {
-  if (pwdresettoken != NULL) {
-    
-  } else {
-    
-  }
-  pwdresettoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwdresettoken);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA6.pwdResetToken)
+::PROTOBUF_NAMESPACE_ID::Metadata PackA6::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[8]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackA7::kSuccessFieldNumber;
-const int PackA7::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackA7::_Internal {
+ public:
+};
 
-PackA7::PackA7()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackA7)
+PackA7::PackA7(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackA7)
 }
 PackA7::PackA7(const PackA7& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  success_ = from.success_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackA7* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA7)
 }
 
-void PackA7::SharedCtor() {
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-  _cached_size_ = 0;
+inline void PackA7::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackA7::~PackA7() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackA7)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackA7::SharedDtor() {
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackA7::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_.Destroy();
 }
 
 void PackA7::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackA7::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[7].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackA7& PackA7::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackA7::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA7)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackA7* PackA7::New(::google::protobuf::Arena* arena) const {
-  PackA7* n = new PackA7;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.msg_.ClearToEmpty();
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackA7::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA7)
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-}
-
-bool PackA7::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackA7)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackA7::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA7.msg"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA7.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackA7)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackA7)
-  return false;
-#undef DO_
-}
-
-void PackA7::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackA7)
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA7.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->msg(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackA7)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackA7::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackA7::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackA7)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA7.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackA7)
   return target;
 }
@@ -3354,58 +3447,47 @@ size_t PackA7::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackA7)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string msg = 2;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackA7::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackA7)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackA7* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackA7>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackA7)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackA7)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackA7::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackA7::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackA7::GetClassData() const { return &_class_data_; }
 
-void PackA7::MergeFrom(const PackA7& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA7)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.msg().size() > 0) {
 
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
+void PackA7::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackA7*>(&to_msg);
+  auto& from = static_cast<const PackA7&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA7)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void PackA7::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackA7)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackA7::CopyFrom(const PackA7& from) {
@@ -3419,273 +3501,192 @@ bool PackA7::IsInitialized() const {
   return true;
 }
 
-void PackA7::Swap(PackA7* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackA7::InternalSwap(PackA7* other) {
-  msg_.Swap(&other->msg_);
-  std::swap(success_, other->success_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackA7::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[7];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackA7
-
-// bool success = 1;
-void PackA7::clear_success() {
-  success_ = false;
-}
-bool PackA7::success() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA7.success)
-  return success_;
-}
-void PackA7::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA7.success)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  swap(_impl_.success_, other->_impl_.success_);
 }
 
-// string msg = 2;
-void PackA7::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA7::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA7.msg)
-  return msg_.GetNoArena();
-}
-void PackA7::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA7.msg)
-}
-void PackA7::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA7.msg)
-}
-void PackA7::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA7.msg)
-}
-::std::string* PackA7::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA7.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA7::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA7.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA7::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA7.msg)
+::PROTOBUF_NAMESPACE_ID::Metadata PackA7::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[9]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackA8::kPwdResetTokenFieldNumber;
-const int PackA8::kPwdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackA8::_Internal {
+ public:
+};
 
-PackA8::PackA8()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackA8)
+PackA8::PackA8(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackA8)
 }
 PackA8::PackA8(const PackA8& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  pwdresettoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.pwdresettoken().size() > 0) {
-    pwdresettoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwdresettoken_);
-  }
-  pwd_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.pwd().size() > 0) {
-    pwd_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwd_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackA8* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pwdresettoken_){}
+    , decltype(_impl_.pwd_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.pwdresettoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwdresettoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pwdresettoken().empty()) {
+    _this->_impl_.pwdresettoken_.Set(from._internal_pwdresettoken(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.pwd_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pwd().empty()) {
+    _this->_impl_.pwd_.Set(from._internal_pwd(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA8)
 }
 
-void PackA8::SharedCtor() {
-  pwdresettoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  pwd_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void PackA8::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pwdresettoken_){}
+    , decltype(_impl_.pwd_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.pwdresettoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwdresettoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.pwd_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackA8::~PackA8() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackA8)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackA8::SharedDtor() {
-  pwdresettoken_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  pwd_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackA8::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pwdresettoken_.Destroy();
+  _impl_.pwd_.Destroy();
 }
 
 void PackA8::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackA8::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[8].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackA8& PackA8::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackA8::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA8)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackA8* PackA8::New(::google::protobuf::Arena* arena) const {
-  PackA8* n = new PackA8;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.pwdresettoken_.ClearToEmpty();
+  _impl_.pwd_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackA8::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA8)
-  pwdresettoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool PackA8::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackA8)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackA8::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string pwdResetToken = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_pwdresettoken()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->pwdresettoken().data(), this->pwdresettoken().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA8.pwdResetToken"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_pwdresettoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA8.pwdResetToken"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string pwd = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_pwd()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->pwd().data(), this->pwd().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA8.pwd"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_pwd();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA8.pwd"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackA8)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackA8)
-  return false;
-#undef DO_
-}
-
-void PackA8::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackA8)
-  // string pwdResetToken = 1;
-  if (this->pwdresettoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwdresettoken().data(), this->pwdresettoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA8.pwdResetToken");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->pwdresettoken(), output);
-  }
-
-  // string pwd = 2;
-  if (this->pwd().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwd().data(), this->pwd().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA8.pwd");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->pwd(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackA8)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackA8::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackA8::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackA8)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string pwdResetToken = 1;
-  if (this->pwdresettoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwdresettoken().data(), this->pwdresettoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_pwdresettoken().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_pwdresettoken().data(), static_cast<int>(this->_internal_pwdresettoken().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA8.pwdResetToken");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->pwdresettoken(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_pwdresettoken(), target);
   }
 
   // string pwd = 2;
-  if (this->pwd().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwd().data(), this->pwd().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_pwd().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_pwd().data(), static_cast<int>(this->_internal_pwd().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA8.pwd");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->pwd(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_pwd(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackA8)
   return target;
 }
@@ -3694,61 +3695,49 @@ size_t PackA8::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackA8)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string pwdResetToken = 1;
-  if (this->pwdresettoken().size() > 0) {
+  if (!this->_internal_pwdresettoken().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->pwdresettoken());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_pwdresettoken());
   }
 
   // string pwd = 2;
-  if (this->pwd().size() > 0) {
+  if (!this->_internal_pwd().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->pwd());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_pwd());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackA8::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackA8)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackA8* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackA8>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackA8)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackA8)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackA8::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackA8::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackA8::GetClassData() const { return &_class_data_; }
 
-void PackA8::MergeFrom(const PackA8& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA8)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.pwdresettoken().size() > 0) {
 
-    pwdresettoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwdresettoken_);
-  }
-  if (from.pwd().size() > 0) {
+void PackA8::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackA8*>(&to_msg);
+  auto& from = static_cast<const PackA8&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA8)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    pwd_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwd_);
+  if (!from._internal_pwdresettoken().empty()) {
+    _this->_internal_set_pwdresettoken(from._internal_pwdresettoken());
   }
-}
-
-void PackA8::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackA8)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_pwd().empty()) {
+    _this->_internal_set_pwd(from._internal_pwd());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackA8::CopyFrom(const PackA8& from) {
@@ -3762,358 +3751,233 @@ bool PackA8::IsInitialized() const {
   return true;
 }
 
-void PackA8::Swap(PackA8* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackA8::InternalSwap(PackA8* other) {
-  pwdresettoken_.Swap(&other->pwdresettoken_);
-  pwd_.Swap(&other->pwd_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackA8::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[8];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackA8
-
-// string pwdResetToken = 1;
-void PackA8::clear_pwdresettoken() {
-  pwdresettoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA8::pwdresettoken() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA8.pwdResetToken)
-  return pwdresettoken_.GetNoArena();
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pwdresettoken_, lhs_arena,
+      &other->_impl_.pwdresettoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pwd_, lhs_arena,
+      &other->_impl_.pwd_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackA8::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[10]);
 }
-void PackA8::set_pwdresettoken(const ::std::string& value) {
-  
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA8.pwdResetToken)
-}
-void PackA8::set_pwdresettoken(const char* value) {
-  
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA8.pwdResetToken)
-}
-void PackA8::set_pwdresettoken(const char* value, size_t size) {
-  
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA8.pwdResetToken)
-}
-::std::string* PackA8::mutable_pwdresettoken() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA8.pwdResetToken)
-  return pwdresettoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA8::release_pwdresettoken() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA8.pwdResetToken)
-  
-  return pwdresettoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA8::set_allocated_pwdresettoken(::std::string* pwdresettoken) {
-  if (pwdresettoken != NULL) {
-    
-  } else {
-    
-  }
-  pwdresettoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwdresettoken);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA8.pwdResetToken)
-}
-
-// string pwd = 2;
-void PackA8::clear_pwd() {
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA8::pwd() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA8.pwd)
-  return pwd_.GetNoArena();
-}
-void PackA8::set_pwd(const ::std::string& value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA8.pwd)
-}
-void PackA8::set_pwd(const char* value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA8.pwd)
-}
-void PackA8::set_pwd(const char* value, size_t size) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA8.pwd)
-}
-::std::string* PackA8::mutable_pwd() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA8.pwd)
-  return pwd_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA8::release_pwd() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA8.pwd)
-  
-  return pwd_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA8::set_allocated_pwd(::std::string* pwd) {
-  if (pwd != NULL) {
-    
-  } else {
-    
-  }
-  pwd_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwd);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA8.pwd)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackA9::kPwdTokenFieldNumber;
-const int PackA9::kEIDFieldNumber;
-const int PackA9::kDeviceIDFieldNumber;
-const int PackA9::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackA9::_Internal {
+ public:
+};
 
-PackA9::PackA9()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackA9)
+PackA9::PackA9(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackA9)
 }
 PackA9::PackA9(const PackA9& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  pwdtoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.pwdtoken().size() > 0) {
-    pwdtoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwdtoken_);
-  }
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  ::memcpy(&eid_, &from.eid_,
-    reinterpret_cast<char*>(&deviceid_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(deviceid_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackA9* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pwdtoken_){}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.eid_){}
+    , decltype(_impl_.deviceid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.pwdtoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwdtoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pwdtoken().empty()) {
+    _this->_impl_.pwdtoken_.Set(from._internal_pwdtoken(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.eid_, &from._impl_.eid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.deviceid_) -
+    reinterpret_cast<char*>(&_impl_.eid_)) + sizeof(_impl_.deviceid_));
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackA9)
 }
 
-void PackA9::SharedCtor() {
-  pwdtoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&eid_, 0, reinterpret_cast<char*>(&deviceid_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(deviceid_));
-  _cached_size_ = 0;
+inline void PackA9::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pwdtoken_){}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.eid_){0u}
+    , decltype(_impl_.deviceid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.pwdtoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pwdtoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackA9::~PackA9() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackA9)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackA9::SharedDtor() {
-  pwdtoken_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackA9::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pwdtoken_.Destroy();
+  _impl_.msg_.Destroy();
 }
 
 void PackA9::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackA9::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[9].descriptor;
-}
-
-const PackA9& PackA9::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackA9* PackA9::New(::google::protobuf::Arena* arena) const {
-  PackA9* n = new PackA9;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackA9::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackA9)
-  pwdtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&eid_, 0, reinterpret_cast<char*>(&deviceid_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(deviceid_));
-}
-
-bool PackA9::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackA9)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pwdtoken_.ClearToEmpty();
+  _impl_.msg_.ClearToEmpty();
+  ::memset(&_impl_.eid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.deviceid_) -
+      reinterpret_cast<char*>(&_impl_.eid_)) + sizeof(_impl_.deviceid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackA9::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string pwdToken = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_pwdtoken()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->pwdtoken().data(), this->pwdtoken().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA9.pwdToken"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_pwdtoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA9.pwdToken"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 eID = 2;
-      case 2: {
-        if (tag == 16u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &eid_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.eid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 deviceID = 3;
-      case 3: {
-        if (tag == 24u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &deviceid_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.deviceid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 4;
-      case 4: {
-        if (tag == 34u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackA9.msg"));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackA9.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackA9)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackA9)
-  return false;
-#undef DO_
-}
-
-void PackA9::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackA9)
-  // string pwdToken = 1;
-  if (this->pwdtoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwdtoken().data(), this->pwdtoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA9.pwdToken");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->pwdtoken(), output);
-  }
-
-  // uint32 eID = 2;
-  if (this->eid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->eid(), output);
-  }
-
-  // uint32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->deviceid(), output);
-  }
-
-  // string msg = 4;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackA9.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->msg(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackA9)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackA9::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackA9::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackA9)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string pwdToken = 1;
-  if (this->pwdtoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->pwdtoken().data(), this->pwdtoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_pwdtoken().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_pwdtoken().data(), static_cast<int>(this->_internal_pwdtoken().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA9.pwdToken");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->pwdtoken(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_pwdtoken(), target);
   }
 
   // uint32 eID = 2;
-  if (this->eid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->eid(), target);
+  if (this->_internal_eid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_eid(), target);
   }
 
   // uint32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->deviceid(), target);
+  if (this->_internal_deviceid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_deviceid(), target);
   }
 
   // string msg = 4;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackA9.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_msg(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackA9)
   return target;
 }
@@ -4122,377 +3986,237 @@ size_t PackA9::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackA9)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string pwdToken = 1;
-  if (this->pwdtoken().size() > 0) {
+  if (!this->_internal_pwdtoken().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->pwdtoken());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_pwdtoken());
   }
 
   // string msg = 4;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
   // uint32 eID = 2;
-  if (this->eid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->eid());
+  if (this->_internal_eid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eid());
   }
 
   // uint32 deviceID = 3;
-  if (this->deviceid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->deviceid());
-  }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void PackA9::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackA9)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackA9* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackA9>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackA9)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackA9)
-    MergeFrom(*source);
-  }
-}
-
-void PackA9::MergeFrom(const PackA9& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA9)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.pwdtoken().size() > 0) {
-
-    pwdtoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.pwdtoken_);
-  }
-  if (from.msg().size() > 0) {
-
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  if (from.eid() != 0) {
-    set_eid(from.eid());
+  if (this->_internal_deviceid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_deviceid());
   }
-  if (from.deviceid() != 0) {
-    set_deviceid(from.deviceid());
-  }
-}
-
-void PackA9::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackA9)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void PackA9::CopyFrom(const PackA9& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackA9)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool PackA9::IsInitialized() const {
-  return true;
-}
 
-void PackA9::Swap(PackA9* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PackA9::InternalSwap(PackA9* other) {
-  pwdtoken_.Swap(&other->pwdtoken_);
-  msg_.Swap(&other->msg_);
-  std::swap(eid_, other->eid_);
-  std::swap(deviceid_, other->deviceid_);
-  std::swap(_cached_size_, other->_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-::google::protobuf::Metadata PackA9::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[9];
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackA9::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackA9::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackA9::GetClassData() const { return &_class_data_; }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackA9
 
-// string pwdToken = 1;
-void PackA9::clear_pwdtoken() {
-  pwdtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA9::pwdtoken() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA9.pwdToken)
-  return pwdtoken_.GetNoArena();
-}
-void PackA9::set_pwdtoken(const ::std::string& value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA9.pwdToken)
-}
-void PackA9::set_pwdtoken(const char* value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA9.pwdToken)
-}
-void PackA9::set_pwdtoken(const char* value, size_t size) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA9.pwdToken)
-}
-::std::string* PackA9::mutable_pwdtoken() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA9.pwdToken)
-  return pwdtoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA9::release_pwdtoken() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA9.pwdToken)
-  
-  return pwdtoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA9::set_allocated_pwdtoken(::std::string* pwdtoken) {
-  if (pwdtoken != NULL) {
-    
-  } else {
-    
+void PackA9::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackA9*>(&to_msg);
+  auto& from = static_cast<const PackA9&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackA9)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_pwdtoken().empty()) {
+    _this->_internal_set_pwdtoken(from._internal_pwdtoken());
+  }
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
+  }
+  if (from._internal_eid() != 0) {
+    _this->_internal_set_eid(from._internal_eid());
+  }
+  if (from._internal_deviceid() != 0) {
+    _this->_internal_set_deviceid(from._internal_deviceid());
   }
-  pwdtoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwdtoken);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA9.pwdToken)
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-// uint32 eID = 2;
-void PackA9::clear_eid() {
-  eid_ = 0u;
-}
-::google::protobuf::uint32 PackA9::eid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA9.eID)
-  return eid_;
-}
-void PackA9::set_eid(::google::protobuf::uint32 value) {
-  
-  eid_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA9.eID)
+void PackA9::CopyFrom(const PackA9& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackA9)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-// uint32 deviceID = 3;
-void PackA9::clear_deviceid() {
-  deviceid_ = 0u;
-}
-::google::protobuf::uint32 PackA9::deviceid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA9.deviceID)
-  return deviceid_;
-}
-void PackA9::set_deviceid(::google::protobuf::uint32 value) {
-  
-  deviceid_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA9.deviceID)
+bool PackA9::IsInitialized() const {
+  return true;
 }
 
-// string msg = 4;
-void PackA9::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackA9::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackA9.msg)
-  return msg_.GetNoArena();
-}
-void PackA9::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackA9.msg)
-}
-void PackA9::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA9.msg)
-}
-void PackA9::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA9.msg)
-}
-::std::string* PackA9::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA9.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackA9::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackA9.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackA9::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA9.msg)
+void PackA9::InternalSwap(PackA9* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pwdtoken_, lhs_arena,
+      &other->_impl_.pwdtoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PackA9, _impl_.deviceid_)
+      + sizeof(PackA9::_impl_.deviceid_)
+      - PROTOBUF_FIELD_OFFSET(PackA9, _impl_.eid_)>(
+          reinterpret_cast<char*>(&_impl_.eid_),
+          reinterpret_cast<char*>(&other->_impl_.eid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackA9::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[11]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackB0::kEmailFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackB0::_Internal {
+ public:
+};
 
-PackB0::PackB0()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackB0)
+PackB0::PackB0(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackB0)
 }
 PackB0::PackB0(const PackB0& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  email_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.email().size() > 0) {
-    email_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.email_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackB0* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.email_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.email_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.email_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_email().empty()) {
+    _this->_impl_.email_.Set(from._internal_email(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackB0)
 }
 
-void PackB0::SharedCtor() {
-  email_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void PackB0::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.email_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.email_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.email_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackB0::~PackB0() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackB0)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackB0::SharedDtor() {
-  email_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackB0::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.email_.Destroy();
 }
 
 void PackB0::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackB0::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[10].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackB0& PackB0::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackB0::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB0)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackB0* PackB0::New(::google::protobuf::Arena* arena) const {
-  PackB0* n = new PackB0;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.email_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackB0::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB0)
-  email_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool PackB0::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackB0)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackB0::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string email = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_email()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->email().data(), this->email().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackB0.email"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_email();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackB0.email"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackB0)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackB0)
-  return false;
-#undef DO_
-}
-
-void PackB0::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackB0)
-  // string email = 1;
-  if (this->email().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->email().data(), this->email().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackB0.email");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->email(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackB0)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackB0::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackB0::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackB0)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string email = 1;
-  if (this->email().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->email().data(), this->email().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_email().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_email().data(), static_cast<int>(this->_internal_email().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackB0.email");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->email(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_email(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackB0)
   return target;
 }
@@ -4501,50 +4225,39 @@ size_t PackB0::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackB0)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string email = 1;
-  if (this->email().size() > 0) {
+  if (!this->_internal_email().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->email());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_email());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackB0::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackB0)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackB0* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackB0>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackB0)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackB0)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackB0::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackB0::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackB0::GetClassData() const { return &_class_data_; }
 
-void PackB0::MergeFrom(const PackB0& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB0)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.email().size() > 0) {
 
-    email_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.email_);
-  }
-}
+void PackB0::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackB0*>(&to_msg);
+  auto& from = static_cast<const PackB0&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB0)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void PackB0::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackB0)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackB0::CopyFrom(const PackB0& from) {
@@ -4558,241 +4271,173 @@ bool PackB0::IsInitialized() const {
   return true;
 }
 
-void PackB0::Swap(PackB0* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackB0::InternalSwap(PackB0* other) {
-  email_.Swap(&other->email_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackB0::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[10];
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.email_, lhs_arena,
+      &other->_impl_.email_, rhs_arena
+  );
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackB0
-
-// string email = 1;
-void PackB0::clear_email() {
-  email_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackB0::email() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackB0.email)
-  return email_.GetNoArena();
-}
-void PackB0::set_email(const ::std::string& value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackB0.email)
-}
-void PackB0::set_email(const char* value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB0.email)
+::PROTOBUF_NAMESPACE_ID::Metadata PackB0::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[12]);
 }
-void PackB0::set_email(const char* value, size_t size) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB0.email)
-}
-::std::string* PackB0::mutable_email() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB0.email)
-  return email_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackB0::release_email() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackB0.email)
-  
-  return email_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackB0::set_allocated_email(::std::string* email) {
-  if (email != NULL) {
-    
-  } else {
-    
-  }
-  email_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), email);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB0.email)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackB1::kSuccessFieldNumber;
-const int PackB1::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackB1::_Internal {
+ public:
+};
 
-PackB1::PackB1()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackB1)
+PackB1::PackB1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackB1)
 }
 PackB1::PackB1(const PackB1& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  success_ = from.success_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackB1* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackB1)
 }
 
-void PackB1::SharedCtor() {
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-  _cached_size_ = 0;
+inline void PackB1::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackB1::~PackB1() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackB1)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackB1::SharedDtor() {
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackB1::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_.Destroy();
 }
 
 void PackB1::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackB1::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[11].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackB1& PackB1::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackB1::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB1)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackB1* PackB1::New(::google::protobuf::Arena* arena) const {
-  PackB1* n = new PackB1;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.msg_.ClearToEmpty();
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackB1::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB1)
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-}
-
-bool PackB1::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackB1)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackB1::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackB1.msg"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackB1.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackB1)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackB1)
-  return false;
-#undef DO_
-}
-
-void PackB1::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackB1)
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackB1.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->msg(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackB1)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackB1::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackB1::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackB1)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackB1.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackB1)
   return target;
 }
@@ -4801,58 +4446,47 @@ size_t PackB1::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackB1)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string msg = 2;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackB1::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackB1)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackB1* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackB1>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackB1)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackB1)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackB1::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackB1::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackB1::GetClassData() const { return &_class_data_; }
+
 
-void PackB1::MergeFrom(const PackB1& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB1)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.msg().size() > 0) {
+void PackB1::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackB1*>(&to_msg);
+  auto& from = static_cast<const PackB1&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB1)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void PackB1::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackB1)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackB1::CopyFrom(const PackB1& from) {
@@ -4866,229 +4500,156 @@ bool PackB1::IsInitialized() const {
   return true;
 }
 
-void PackB1::Swap(PackB1* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackB1::InternalSwap(PackB1* other) {
-  msg_.Swap(&other->msg_);
-  std::swap(success_, other->success_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackB1::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[11];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackB1
-
-// bool success = 1;
-void PackB1::clear_success() {
-  success_ = false;
-}
-bool PackB1::success() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackB1.success)
-  return success_;
-}
-void PackB1::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackB1.success)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  swap(_impl_.success_, other->_impl_.success_);
 }
 
-// string msg = 2;
-void PackB1::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackB1::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackB1.msg)
-  return msg_.GetNoArena();
-}
-void PackB1::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackB1.msg)
-}
-void PackB1::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB1.msg)
-}
-void PackB1::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB1.msg)
-}
-::std::string* PackB1::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB1.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+::PROTOBUF_NAMESPACE_ID::Metadata PackB1::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[13]);
 }
-::std::string* PackB1::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackB1.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackB1::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB1.msg)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackB2::kEmailTokenFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackB2::_Internal {
+ public:
+};
 
-PackB2::PackB2()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackB2)
+PackB2::PackB2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackB2)
 }
 PackB2::PackB2(const PackB2& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  emailtoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.emailtoken().size() > 0) {
-    emailtoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.emailtoken_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackB2* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.emailtoken_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.emailtoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.emailtoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_emailtoken().empty()) {
+    _this->_impl_.emailtoken_.Set(from._internal_emailtoken(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackB2)
 }
 
-void PackB2::SharedCtor() {
-  emailtoken_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void PackB2::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.emailtoken_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.emailtoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.emailtoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackB2::~PackB2() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackB2)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackB2::SharedDtor() {
-  emailtoken_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackB2::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.emailtoken_.Destroy();
 }
 
 void PackB2::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackB2::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[12].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackB2& PackB2::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackB2::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB2)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackB2* PackB2::New(::google::protobuf::Arena* arena) const {
-  PackB2* n = new PackB2;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.emailtoken_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackB2::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB2)
-  emailtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool PackB2::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackB2)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackB2::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string emailToken = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_emailtoken()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->emailtoken().data(), this->emailtoken().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackB2.emailToken"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_emailtoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackB2.emailToken"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackB2)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackB2)
-  return false;
-#undef DO_
-}
-
-void PackB2::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackB2)
-  // string emailToken = 1;
-  if (this->emailtoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->emailtoken().data(), this->emailtoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackB2.emailToken");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->emailtoken(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackB2)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackB2::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackB2::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackB2)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string emailToken = 1;
-  if (this->emailtoken().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->emailtoken().data(), this->emailtoken().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_emailtoken().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_emailtoken().data(), static_cast<int>(this->_internal_emailtoken().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackB2.emailToken");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->emailtoken(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_emailtoken(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackB2)
   return target;
 }
@@ -5097,50 +4658,39 @@ size_t PackB2::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackB2)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string emailToken = 1;
-  if (this->emailtoken().size() > 0) {
+  if (!this->_internal_emailtoken().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->emailtoken());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_emailtoken());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackB2::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackB2)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackB2* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackB2>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackB2)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackB2)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackB2::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackB2::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackB2::GetClassData() const { return &_class_data_; }
 
-void PackB2::MergeFrom(const PackB2& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB2)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.emailtoken().size() > 0) {
 
-    emailtoken_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.emailtoken_);
-  }
-}
+void PackB2::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackB2*>(&to_msg);
+  auto& from = static_cast<const PackB2&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB2)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void PackB2::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackB2)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_emailtoken().empty()) {
+    _this->_internal_set_emailtoken(from._internal_emailtoken());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackB2::CopyFrom(const PackB2& from) {
@@ -5154,241 +4704,173 @@ bool PackB2::IsInitialized() const {
   return true;
 }
 
-void PackB2::Swap(PackB2* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackB2::InternalSwap(PackB2* other) {
-  emailtoken_.Swap(&other->emailtoken_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackB2::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[12];
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.emailtoken_, lhs_arena,
+      &other->_impl_.emailtoken_, rhs_arena
+  );
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackB2
-
-// string emailToken = 1;
-void PackB2::clear_emailtoken() {
-  emailtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackB2::emailtoken() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackB2.emailToken)
-  return emailtoken_.GetNoArena();
-}
-void PackB2::set_emailtoken(const ::std::string& value) {
-  
-  emailtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackB2.emailToken)
-}
-void PackB2::set_emailtoken(const char* value) {
-  
-  emailtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB2.emailToken)
-}
-void PackB2::set_emailtoken(const char* value, size_t size) {
-  
-  emailtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB2.emailToken)
-}
-::std::string* PackB2::mutable_emailtoken() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB2.emailToken)
-  return emailtoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackB2::release_emailtoken() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackB2.emailToken)
-  
-  return emailtoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackB2::set_allocated_emailtoken(::std::string* emailtoken) {
-  if (emailtoken != NULL) {
-    
-  } else {
-    
-  }
-  emailtoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), emailtoken);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB2.emailToken)
+::PROTOBUF_NAMESPACE_ID::Metadata PackB2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[14]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackB3::kSuccessFieldNumber;
-const int PackB3::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackB3::_Internal {
+ public:
+};
 
-PackB3::PackB3()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackB3)
+PackB3::PackB3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackB3)
 }
 PackB3::PackB3(const PackB3& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  success_ = from.success_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackB3* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackB3)
 }
 
-void PackB3::SharedCtor() {
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-  _cached_size_ = 0;
+inline void PackB3::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackB3::~PackB3() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackB3)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackB3::SharedDtor() {
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackB3::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_.Destroy();
 }
 
 void PackB3::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackB3::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[13].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackB3& PackB3::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackB3::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB3)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackB3* PackB3::New(::google::protobuf::Arena* arena) const {
-  PackB3* n = new PackB3;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.msg_.ClearToEmpty();
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackB3::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB3)
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-}
-
-bool PackB3::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackB3)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackB3::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackB3.msg"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackB3.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackB3)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackB3)
-  return false;
-#undef DO_
-}
-
-void PackB3::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackB3)
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackB3.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->msg(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackB3)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackB3::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackB3::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackB3)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackB3.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackB3)
   return target;
 }
@@ -5397,506 +4879,286 @@ size_t PackB3::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackB3)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string msg = 2;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void PackB3::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackB3)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackB3* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackB3>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackB3)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackB3)
-    MergeFrom(*source);
-  }
-}
-
-void PackB3::MergeFrom(const PackB3& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB3)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.msg().size() > 0) {
-
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  if (from.success() != 0) {
-    set_success(from.success());
-  }
-}
-
-void PackB3::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackB3)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void PackB3::CopyFrom(const PackB3& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackB3)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool PackB3::IsInitialized() const {
-  return true;
-}
-
-void PackB3::Swap(PackB3* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PackB3::InternalSwap(PackB3* other) {
-  msg_.Swap(&other->msg_);
-  std::swap(success_, other->success_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackB3::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[13];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackB3
-
-// bool success = 1;
-void PackB3::clear_success() {
-  success_ = false;
-}
-bool PackB3::success() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackB3.success)
-  return success_;
-}
-void PackB3::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackB3.success)
-}
-
-// string msg = 2;
-void PackB3::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackB3::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackB3.msg)
-  return msg_.GetNoArena();
-}
-void PackB3::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackB3.msg)
-}
-void PackB3::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB3.msg)
-}
-void PackB3::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB3.msg)
-}
-::std::string* PackB3::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB3.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackB3::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackB3.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackB3::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB3.msg)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// ===================================================================
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-PackB4::PackB4()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackB4)
-}
-PackB4::PackB4(const PackB4& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackB4)
-}
-
-void PackB4::SharedCtor() {
-  _cached_size_ = 0;
-}
-
-PackB4::~PackB4() {
-  // @@protoc_insertion_point(destructor:ProtobufPackets.PackB4)
-  SharedDtor();
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackB4::SharedDtor() {
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackB3::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackB3::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackB3::GetClassData() const { return &_class_data_; }
 
-void PackB4::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackB4::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[14].descriptor;
-}
 
-const PackB4& PackB4::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackB3::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackB3*>(&to_msg);
+  auto& from = static_cast<const PackB3&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB3)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-PackB4* PackB4::New(::google::protobuf::Arena* arena) const {
-  PackB4* n = new PackB4;
-  if (arena != NULL) {
-    arena->Own(n);
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
   }
-  return n;
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PackB4::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB4)
+void PackB3::CopyFrom(const PackB3& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackB3)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-bool PackB4::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackB4)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackB4)
+bool PackB3::IsInitialized() const {
   return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackB4)
-  return false;
-#undef DO_
 }
 
-void PackB4::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackB4)
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackB4)
+void PackB3::InternalSwap(PackB3* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  swap(_impl_.success_, other->_impl_.success_);
 }
 
-::google::protobuf::uint8* PackB4::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackB4)
-  // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackB4)
-  return target;
+::PROTOBUF_NAMESPACE_ID::Metadata PackB3::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[15]);
 }
 
-size_t PackB4::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackB4)
-  size_t total_size = 0;
+// ===================================================================
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+class PackB4::_Internal {
+ public:
+};
 
-void PackB4::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackB4)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackB4* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackB4>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackB4)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackB4)
-    MergeFrom(*source);
-  }
+PackB4::PackB4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackB4)
 }
-
-void PackB4::MergeFrom(const PackB4& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB4)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+PackB4::PackB4(const PackB4& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  PackB4* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackB4)
 }
 
-void PackB4::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackB4)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-void PackB4::CopyFrom(const PackB4& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackB4)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool PackB4::IsInitialized() const {
-  return true;
-}
 
-void PackB4::Swap(PackB4* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PackB4::InternalSwap(PackB4* other) {
-  std::swap(_cached_size_, other->_cached_size_);
-}
 
-::google::protobuf::Metadata PackB4::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[14];
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackB4::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackB4::GetClassData() const { return &_class_data_; }
+
+
+
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackB4
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackB4::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[16]);
+}
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackB5::kVerifiedEmailFieldNumber;
-const int PackB5::kUnverifiedEmailFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackB5::_Internal {
+ public:
+};
 
-PackB5::PackB5()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackB5)
+PackB5::PackB5(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackB5)
 }
 PackB5::PackB5(const PackB5& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  verifiedemail_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.verifiedemail().size() > 0) {
-    verifiedemail_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.verifiedemail_);
-  }
-  unverifiedemail_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.unverifiedemail().size() > 0) {
-    unverifiedemail_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.unverifiedemail_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackB5* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.verifiedemail_){}
+    , decltype(_impl_.unverifiedemail_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.verifiedemail_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.verifiedemail_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_verifiedemail().empty()) {
+    _this->_impl_.verifiedemail_.Set(from._internal_verifiedemail(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.unverifiedemail_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.unverifiedemail_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_unverifiedemail().empty()) {
+    _this->_impl_.unverifiedemail_.Set(from._internal_unverifiedemail(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackB5)
 }
 
-void PackB5::SharedCtor() {
-  verifiedemail_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  unverifiedemail_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void PackB5::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.verifiedemail_){}
+    , decltype(_impl_.unverifiedemail_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.verifiedemail_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.verifiedemail_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.unverifiedemail_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.unverifiedemail_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackB5::~PackB5() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackB5)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackB5::SharedDtor() {
-  verifiedemail_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  unverifiedemail_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackB5::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.verifiedemail_.Destroy();
+  _impl_.unverifiedemail_.Destroy();
 }
 
 void PackB5::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackB5::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[15].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackB5& PackB5::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackB5::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB5)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackB5* PackB5::New(::google::protobuf::Arena* arena) const {
-  PackB5* n = new PackB5;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.verifiedemail_.ClearToEmpty();
+  _impl_.unverifiedemail_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackB5::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackB5)
-  verifiedemail_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  unverifiedemail_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool PackB5::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackB5)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackB5::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string verifiedEmail = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_verifiedemail()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->verifiedemail().data(), this->verifiedemail().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackB5.verifiedEmail"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_verifiedemail();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackB5.verifiedEmail"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string unverifiedEmail = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_unverifiedemail()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->unverifiedemail().data(), this->unverifiedemail().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackB5.unverifiedEmail"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_unverifiedemail();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackB5.unverifiedEmail"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackB5)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackB5)
-  return false;
-#undef DO_
-}
-
-void PackB5::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackB5)
-  // string verifiedEmail = 1;
-  if (this->verifiedemail().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->verifiedemail().data(), this->verifiedemail().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackB5.verifiedEmail");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->verifiedemail(), output);
-  }
-
-  // string unverifiedEmail = 2;
-  if (this->unverifiedemail().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->unverifiedemail().data(), this->unverifiedemail().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackB5.unverifiedEmail");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->unverifiedemail(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackB5)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackB5::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackB5::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackB5)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string verifiedEmail = 1;
-  if (this->verifiedemail().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->verifiedemail().data(), this->verifiedemail().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_verifiedemail().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_verifiedemail().data(), static_cast<int>(this->_internal_verifiedemail().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackB5.verifiedEmail");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->verifiedemail(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_verifiedemail(), target);
   }
 
   // string unverifiedEmail = 2;
-  if (this->unverifiedemail().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->unverifiedemail().data(), this->unverifiedemail().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_unverifiedemail().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_unverifiedemail().data(), static_cast<int>(this->_internal_unverifiedemail().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackB5.unverifiedEmail");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->unverifiedemail(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_unverifiedemail(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackB5)
   return target;
 }
@@ -5905,61 +5167,49 @@ size_t PackB5::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackB5)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string verifiedEmail = 1;
-  if (this->verifiedemail().size() > 0) {
+  if (!this->_internal_verifiedemail().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->verifiedemail());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_verifiedemail());
   }
 
   // string unverifiedEmail = 2;
-  if (this->unverifiedemail().size() > 0) {
+  if (!this->_internal_unverifiedemail().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->unverifiedemail());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_unverifiedemail());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackB5::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackB5)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackB5* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackB5>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackB5)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackB5)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackB5::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackB5::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackB5::GetClassData() const { return &_class_data_; }
 
-void PackB5::MergeFrom(const PackB5& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB5)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.verifiedemail().size() > 0) {
 
-    verifiedemail_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.verifiedemail_);
-  }
-  if (from.unverifiedemail().size() > 0) {
+void PackB5::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackB5*>(&to_msg);
+  auto& from = static_cast<const PackB5&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackB5)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    unverifiedemail_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.unverifiedemail_);
+  if (!from._internal_verifiedemail().empty()) {
+    _this->_internal_set_verifiedemail(from._internal_verifiedemail());
   }
-}
-
-void PackB5::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackB5)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_unverifiedemail().empty()) {
+    _this->_internal_set_unverifiedemail(from._internal_unverifiedemail());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackB5::CopyFrom(const PackB5& from) {
@@ -5973,242 +5223,141 @@ bool PackB5::IsInitialized() const {
   return true;
 }
 
-void PackB5::Swap(PackB5* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackB5::InternalSwap(PackB5* other) {
-  verifiedemail_.Swap(&other->verifiedemail_);
-  unverifiedemail_.Swap(&other->unverifiedemail_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackB5::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[15];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackB5
-
-// string verifiedEmail = 1;
-void PackB5::clear_verifiedemail() {
-  verifiedemail_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackB5::verifiedemail() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackB5.verifiedEmail)
-  return verifiedemail_.GetNoArena();
-}
-void PackB5::set_verifiedemail(const ::std::string& value) {
-  
-  verifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackB5.verifiedEmail)
-}
-void PackB5::set_verifiedemail(const char* value) {
-  
-  verifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB5.verifiedEmail)
-}
-void PackB5::set_verifiedemail(const char* value, size_t size) {
-  
-  verifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB5.verifiedEmail)
-}
-::std::string* PackB5::mutable_verifiedemail() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB5.verifiedEmail)
-  return verifiedemail_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.verifiedemail_, lhs_arena,
+      &other->_impl_.verifiedemail_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.unverifiedemail_, lhs_arena,
+      &other->_impl_.unverifiedemail_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackB5::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[17]);
 }
-::std::string* PackB5::release_verifiedemail() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackB5.verifiedEmail)
-  
-  return verifiedemail_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackB5::set_allocated_verifiedemail(::std::string* verifiedemail) {
-  if (verifiedemail != NULL) {
-    
-  } else {
-    
-  }
-  verifiedemail_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), verifiedemail);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB5.verifiedEmail)
-}
-
-// string unverifiedEmail = 2;
-void PackB5::clear_unverifiedemail() {
-  unverifiedemail_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackB5::unverifiedemail() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackB5.unverifiedEmail)
-  return unverifiedemail_.GetNoArena();
-}
-void PackB5::set_unverifiedemail(const ::std::string& value) {
-  
-  unverifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackB5.unverifiedEmail)
-}
-void PackB5::set_unverifiedemail(const char* value) {
-  
-  unverifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB5.unverifiedEmail)
-}
-void PackB5::set_unverifiedemail(const char* value, size_t size) {
-  
-  unverifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB5.unverifiedEmail)
-}
-::std::string* PackB5::mutable_unverifiedemail() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB5.unverifiedEmail)
-  return unverifiedemail_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackB5::release_unverifiedemail() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackB5.unverifiedEmail)
-  
-  return unverifiedemail_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackB5::set_allocated_unverifiedemail(::std::string* unverifiedemail) {
-  if (unverifiedemail != NULL) {
-    
-  } else {
-    
-  }
-  unverifiedemail_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), unverifiedemail);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB5.unverifiedEmail)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackC0::kEIDFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackC0::_Internal {
+ public:
+};
 
-PackC0::PackC0()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackC0)
+PackC0::PackC0(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackC0)
 }
 PackC0::PackC0(const PackC0& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  eid_ = from.eid_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackC0* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.eid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.eid_ = from._impl_.eid_;
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackC0)
 }
 
-void PackC0::SharedCtor() {
-  eid_ = 0u;
-  _cached_size_ = 0;
+inline void PackC0::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.eid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 PackC0::~PackC0() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackC0)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackC0::SharedDtor() {
+inline void PackC0::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void PackC0::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackC0::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[16].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackC0& PackC0::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackC0::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackC0)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackC0* PackC0::New(::google::protobuf::Arena* arena) const {
-  PackC0* n = new PackC0;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.eid_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackC0::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackC0)
-  eid_ = 0u;
-}
-
-bool PackC0::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackC0)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackC0::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 eID = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &eid_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.eid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackC0)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackC0)
-  return false;
-#undef DO_
-}
-
-void PackC0::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackC0)
-  // uint32 eID = 1;
-  if (this->eid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->eid(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackC0)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackC0::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackC0::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackC0)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // uint32 eID = 1;
-  if (this->eid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->eid(), target);
+  if (this->_internal_eid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_eid(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackC0)
   return target;
 }
@@ -6217,49 +5366,37 @@ size_t PackC0::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackC0)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // uint32 eID = 1;
-  if (this->eid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->eid());
+  if (this->_internal_eid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eid());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackC0::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackC0)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackC0* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackC0>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackC0)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackC0)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackC0::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackC0::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackC0::GetClassData() const { return &_class_data_; }
 
-void PackC0::MergeFrom(const PackC0& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackC0)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.eid() != 0) {
-    set_eid(from.eid());
-  }
-}
 
-void PackC0::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackC0)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void PackC0::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackC0*>(&to_msg);
+  auto& from = static_cast<const PackC0&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackC0)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_eid() != 0) {
+    _this->_internal_set_eid(from._internal_eid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackC0::CopyFrom(const PackC0& from) {
@@ -6273,184 +5410,150 @@ bool PackC0::IsInitialized() const {
   return true;
 }
 
-void PackC0::Swap(PackC0* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackC0::InternalSwap(PackC0* other) {
-  std::swap(eid_, other->eid_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackC0::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[16];
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.eid_, other->_impl_.eid_);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackC0
-
-// uint32 eID = 1;
-void PackC0::clear_eid() {
-  eid_ = 0u;
-}
-::google::protobuf::uint32 PackC0::eid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackC0.eID)
-  return eid_;
-}
-void PackC0::set_eid(::google::protobuf::uint32 value) {
-  
-  eid_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackC0.eID)
+::PROTOBUF_NAMESPACE_ID::Metadata PackC0::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[18]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackC1::kNameFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackC1::_Internal {
+ public:
+};
 
-PackC1::PackC1()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackC1)
+PackC1::PackC1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackC1)
 }
 PackC1::PackC1(const PackC1& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackC1* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackC1)
 }
 
-void PackC1::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void PackC1::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackC1::~PackC1() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackC1)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackC1::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackC1::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
 void PackC1::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackC1::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[17].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackC1& PackC1::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackC1::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackC1)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackC1* PackC1::New(::google::protobuf::Arena* arena) const {
-  PackC1* n = new PackC1;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackC1::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackC1)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool PackC1::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackC1)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackC1::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string name = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackC1.name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackC1.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackC1)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackC1)
-  return false;
-#undef DO_
-}
-
-void PackC1::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackC1)
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackC1.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackC1)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackC1::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackC1::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackC1)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackC1.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackC1)
   return target;
 }
@@ -6459,50 +5562,39 @@ size_t PackC1::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackC1)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackC1::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackC1)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackC1* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackC1>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackC1)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackC1)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackC1::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackC1::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackC1::GetClassData() const { return &_class_data_; }
 
-void PackC1::MergeFrom(const PackC1& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackC1)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-}
+void PackC1::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackC1*>(&to_msg);
+  auto& from = static_cast<const PackC1&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackC1)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void PackC1::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackC1)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackC1::CopyFrom(const PackC1& from) {
@@ -6516,382 +5608,195 @@ bool PackC1::IsInitialized() const {
   return true;
 }
 
-void PackC1::Swap(PackC1* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackC1::InternalSwap(PackC1* other) {
-  name_.Swap(&other->name_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata PackC1::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[17];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackC1
-
-// string name = 1;
-void PackC1::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackC1::name() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackC1.name)
-  return name_.GetNoArena();
-}
-void PackC1::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackC1.name)
-}
-void PackC1::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackC1.name)
-}
-void PackC1::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackC1.name)
-}
-::std::string* PackC1::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackC1.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+::PROTOBUF_NAMESPACE_ID::Metadata PackC1::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[19]);
 }
-::std::string* PackC1::release_name() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackC1.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackC1::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
-    
-  } else {
-    
-  }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackC1.name)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackC2::_Internal {
+ public:
+};
 
-PackC2::PackC2()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackC2)
+PackC2::PackC2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackC2)
 }
 PackC2::PackC2(const PackC2& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  PackC2* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackC2)
 }
 
-void PackC2::SharedCtor() {
-  _cached_size_ = 0;
-}
-
-PackC2::~PackC2() {
-  // @@protoc_insertion_point(destructor:ProtobufPackets.PackC2)
-  SharedDtor();
-}
-
-void PackC2::SharedDtor() {
-}
-
-void PackC2::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackC2::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[18].descriptor;
-}
-
-const PackC2& PackC2::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackC2* PackC2::New(::google::protobuf::Arena* arena) const {
-  PackC2* n = new PackC2;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
-}
-
-void PackC2::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackC2)
-}
-
-bool PackC2::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackC2)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackC2)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackC2)
-  return false;
-#undef DO_
-}
 
-void PackC2::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackC2)
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackC2)
-}
 
-::google::protobuf::uint8* PackC2::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackC2)
-  // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackC2)
-  return target;
-}
 
-size_t PackC2::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackC2)
-  size_t total_size = 0;
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackC2::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackC2::GetClassData() const { return &_class_data_; }
 
-void PackC2::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackC2)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackC2* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackC2>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackC2)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackC2)
-    MergeFrom(*source);
-  }
-}
 
-void PackC2::MergeFrom(const PackC2& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackC2)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-}
 
-void PackC2::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackC2)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-void PackC2::CopyFrom(const PackC2& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackC2)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool PackC2::IsInitialized() const {
-  return true;
-}
 
-void PackC2::Swap(PackC2* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PackC2::InternalSwap(PackC2* other) {
-  std::swap(_cached_size_, other->_cached_size_);
-}
 
-::google::protobuf::Metadata PackC2::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[18];
+::PROTOBUF_NAMESPACE_ID::Metadata PackC2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[20]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackC2
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackC3::kNameFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackC3::_Internal {
+ public:
+};
 
-PackC3::PackC3()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackC3)
+PackC3::PackC3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackC3)
 }
 PackC3::PackC3(const PackC3& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackC3* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackC3)
 }
 
-void PackC3::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void PackC3::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackC3::~PackC3() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackC3)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackC3::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackC3::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
 void PackC3::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackC3::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[19].descriptor;
-}
-
-const PackC3& PackC3::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackC3* PackC3::New(::google::protobuf::Arena* arena) const {
-  PackC3* n = new PackC3;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackC3::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackC3)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool PackC3::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackC3)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackC3::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string name = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackC3.name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackC3.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackC3)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackC3)
-  return false;
-#undef DO_
-}
-
-void PackC3::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackC3)
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackC3.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackC3)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackC3::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackC3::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackC3)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackC3.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackC3)
   return target;
 }
@@ -6900,50 +5805,39 @@ size_t PackC3::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackC3)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackC3::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackC3)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackC3* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackC3>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackC3)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackC3)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackC3::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackC3::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackC3::GetClassData() const { return &_class_data_; }
 
-void PackC3::MergeFrom(const PackC3& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackC3)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-}
+void PackC3::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackC3*>(&to_msg);
+  auto& from = static_cast<const PackC3&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackC3)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void PackC3::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackC3)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackC3::CopyFrom(const PackC3& from) {
@@ -6957,558 +5851,339 @@ bool PackC3::IsInitialized() const {
   return true;
 }
 
-void PackC3::Swap(PackC3* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackC3::InternalSwap(PackC3* other) {
-  name_.Swap(&other->name_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackC3::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[19];
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackC3
-
-// string name = 1;
-void PackC3::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackC3::name() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackC3.name)
-  return name_.GetNoArena();
-}
-void PackC3::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackC3.name)
-}
-void PackC3::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackC3.name)
-}
-void PackC3::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackC3.name)
-}
-::std::string* PackC3::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackC3.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackC3::release_name() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackC3.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackC3::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
-    
-  } else {
-    
-  }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackC3.name)
+::PROTOBUF_NAMESPACE_ID::Metadata PackC3::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[21]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackD0::_Internal {
+ public:
+};
 
-PackD0::PackD0()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackD0)
+PackD0::PackD0(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackD0)
 }
 PackD0::PackD0(const PackD0& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  PackD0* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackD0)
 }
 
-void PackD0::SharedCtor() {
-  _cached_size_ = 0;
-}
-
-PackD0::~PackD0() {
-  // @@protoc_insertion_point(destructor:ProtobufPackets.PackD0)
-  SharedDtor();
-}
-
-void PackD0::SharedDtor() {
-}
-
-void PackD0::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackD0::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[20].descriptor;
-}
-
-const PackD0& PackD0::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackD0* PackD0::New(::google::protobuf::Arena* arena) const {
-  PackD0* n = new PackD0;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
-}
-
-void PackD0::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackD0)
-}
-
-bool PackD0::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackD0)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackD0)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackD0)
-  return false;
-#undef DO_
-}
 
-void PackD0::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackD0)
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackD0)
-}
 
-::google::protobuf::uint8* PackD0::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackD0)
-  // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackD0)
-  return target;
-}
 
-size_t PackD0::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackD0)
-  size_t total_size = 0;
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackD0::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackD0::GetClassData() const { return &_class_data_; }
 
-void PackD0::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackD0)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackD0* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackD0>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackD0)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackD0)
-    MergeFrom(*source);
-  }
-}
 
-void PackD0::MergeFrom(const PackD0& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackD0)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-}
 
-void PackD0::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackD0)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-void PackD0::CopyFrom(const PackD0& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackD0)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool PackD0::IsInitialized() const {
-  return true;
-}
 
-void PackD0::Swap(PackD0* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PackD0::InternalSwap(PackD0* other) {
-  std::swap(_cached_size_, other->_cached_size_);
-}
 
-::google::protobuf::Metadata PackD0::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[20];
+::PROTOBUF_NAMESPACE_ID::Metadata PackD0::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[22]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackD0
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackD1::kFolderObjKeyFieldNumber;
-const int PackD1::kAccessKeyIDFieldNumber;
-const int PackD1::kAccessKeyFieldNumber;
-const int PackD1::kSessionKeyFieldNumber;
-const int PackD1::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackD1::_Internal {
+ public:
+};
 
-PackD1::PackD1()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackD1)
+PackD1::PackD1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackD1)
 }
 PackD1::PackD1(const PackD1& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  folderobjkey_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.folderobjkey().size() > 0) {
-    folderobjkey_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.folderobjkey_);
-  }
-  accesskeyid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.accesskeyid().size() > 0) {
-    accesskeyid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.accesskeyid_);
-  }
-  accesskey_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.accesskey().size() > 0) {
-    accesskey_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.accesskey_);
-  }
-  sessionkey_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.sessionkey().size() > 0) {
-    sessionkey_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.sessionkey_);
-  }
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackD1* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.folderobjkey_){}
+    , decltype(_impl_.accesskeyid_){}
+    , decltype(_impl_.accesskey_){}
+    , decltype(_impl_.sessionkey_){}
+    , decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.folderobjkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.folderobjkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_folderobjkey().empty()) {
+    _this->_impl_.folderobjkey_.Set(from._internal_folderobjkey(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.accesskeyid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.accesskeyid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_accesskeyid().empty()) {
+    _this->_impl_.accesskeyid_.Set(from._internal_accesskeyid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.accesskey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.accesskey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_accesskey().empty()) {
+    _this->_impl_.accesskey_.Set(from._internal_accesskey(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.sessionkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sessionkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_sessionkey().empty()) {
+    _this->_impl_.sessionkey_.Set(from._internal_sessionkey(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackD1)
 }
 
-void PackD1::SharedCtor() {
-  folderobjkey_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  accesskeyid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  accesskey_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  sessionkey_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void PackD1::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.folderobjkey_){}
+    , decltype(_impl_.accesskeyid_){}
+    , decltype(_impl_.accesskey_){}
+    , decltype(_impl_.sessionkey_){}
+    , decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.folderobjkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.folderobjkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.accesskeyid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.accesskeyid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.accesskey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.accesskey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sessionkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sessionkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackD1::~PackD1() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackD1)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackD1::SharedDtor() {
-  folderobjkey_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  accesskeyid_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  accesskey_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  sessionkey_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackD1::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.folderobjkey_.Destroy();
+  _impl_.accesskeyid_.Destroy();
+  _impl_.accesskey_.Destroy();
+  _impl_.sessionkey_.Destroy();
+  _impl_.msg_.Destroy();
 }
 
 void PackD1::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackD1::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[21].descriptor;
-}
-
-const PackD1& PackD1::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackD1* PackD1::New(::google::protobuf::Arena* arena) const {
-  PackD1* n = new PackD1;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackD1::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackD1)
-  folderobjkey_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  accesskeyid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  accesskey_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  sessionkey_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool PackD1::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackD1)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.folderobjkey_.ClearToEmpty();
+  _impl_.accesskeyid_.ClearToEmpty();
+  _impl_.accesskey_.ClearToEmpty();
+  _impl_.sessionkey_.ClearToEmpty();
+  _impl_.msg_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackD1::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string folderObjKey = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_folderobjkey()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->folderobjkey().data(), this->folderobjkey().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackD1.folderObjKey"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_folderobjkey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackD1.folderObjKey"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string accessKeyID = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_accesskeyid()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->accesskeyid().data(), this->accesskeyid().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackD1.accessKeyID"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_accesskeyid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackD1.accessKeyID"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string accessKey = 3;
-      case 3: {
-        if (tag == 26u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_accesskey()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->accesskey().data(), this->accesskey().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackD1.accessKey"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_accesskey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackD1.accessKey"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string sessionKey = 4;
-      case 4: {
-        if (tag == 34u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_sessionkey()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->sessionkey().data(), this->sessionkey().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackD1.sessionKey"));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_sessionkey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackD1.sessionKey"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 5;
-      case 5: {
-        if (tag == 42u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackD1.msg"));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackD1.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackD1)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackD1)
-  return false;
-#undef DO_
-}
-
-void PackD1::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackD1)
-  // string folderObjKey = 1;
-  if (this->folderobjkey().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->folderobjkey().data(), this->folderobjkey().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackD1.folderObjKey");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->folderobjkey(), output);
-  }
-
-  // string accessKeyID = 2;
-  if (this->accesskeyid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->accesskeyid().data(), this->accesskeyid().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackD1.accessKeyID");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->accesskeyid(), output);
-  }
-
-  // string accessKey = 3;
-  if (this->accesskey().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->accesskey().data(), this->accesskey().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackD1.accessKey");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->accesskey(), output);
-  }
-
-  // string sessionKey = 4;
-  if (this->sessionkey().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->sessionkey().data(), this->sessionkey().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackD1.sessionKey");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->sessionkey(), output);
-  }
-
-  // string msg = 5;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackD1.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->msg(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackD1)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackD1::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackD1::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackD1)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // string folderObjKey = 1;
-  if (this->folderobjkey().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->folderobjkey().data(), this->folderobjkey().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_folderobjkey().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_folderobjkey().data(), static_cast<int>(this->_internal_folderobjkey().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackD1.folderObjKey");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->folderobjkey(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_folderobjkey(), target);
   }
 
   // string accessKeyID = 2;
-  if (this->accesskeyid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->accesskeyid().data(), this->accesskeyid().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_accesskeyid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_accesskeyid().data(), static_cast<int>(this->_internal_accesskeyid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackD1.accessKeyID");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->accesskeyid(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_accesskeyid(), target);
   }
 
   // string accessKey = 3;
-  if (this->accesskey().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->accesskey().data(), this->accesskey().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_accesskey().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_accesskey().data(), static_cast<int>(this->_internal_accesskey().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackD1.accessKey");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->accesskey(), target);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_accesskey(), target);
   }
 
   // string sessionKey = 4;
-  if (this->sessionkey().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->sessionkey().data(), this->sessionkey().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_sessionkey().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_sessionkey().data(), static_cast<int>(this->_internal_sessionkey().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackD1.sessionKey");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->sessionkey(), target);
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_sessionkey(), target);
   }
 
   // string msg = 5;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackD1.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        5, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_msg(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackD1)
   return target;
 }
@@ -7517,94 +6192,79 @@ size_t PackD1::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackD1)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string folderObjKey = 1;
-  if (this->folderobjkey().size() > 0) {
+  if (!this->_internal_folderobjkey().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->folderobjkey());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_folderobjkey());
   }
 
   // string accessKeyID = 2;
-  if (this->accesskeyid().size() > 0) {
+  if (!this->_internal_accesskeyid().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->accesskeyid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_accesskeyid());
   }
 
   // string accessKey = 3;
-  if (this->accesskey().size() > 0) {
+  if (!this->_internal_accesskey().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->accesskey());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_accesskey());
   }
 
   // string sessionKey = 4;
-  if (this->sessionkey().size() > 0) {
+  if (!this->_internal_sessionkey().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->sessionkey());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sessionkey());
   }
 
   // string msg = 5;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackD1::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackD1)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackD1* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackD1>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackD1)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackD1)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackD1::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackD1::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackD1::GetClassData() const { return &_class_data_; }
 
-void PackD1::MergeFrom(const PackD1& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackD1)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.folderobjkey().size() > 0) {
 
-    folderobjkey_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.folderobjkey_);
-  }
-  if (from.accesskeyid().size() > 0) {
+void PackD1::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackD1*>(&to_msg);
+  auto& from = static_cast<const PackD1&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackD1)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    accesskeyid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.accesskeyid_);
+  if (!from._internal_folderobjkey().empty()) {
+    _this->_internal_set_folderobjkey(from._internal_folderobjkey());
   }
-  if (from.accesskey().size() > 0) {
-
-    accesskey_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.accesskey_);
+  if (!from._internal_accesskeyid().empty()) {
+    _this->_internal_set_accesskeyid(from._internal_accesskeyid());
   }
-  if (from.sessionkey().size() > 0) {
-
-    sessionkey_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.sessionkey_);
+  if (!from._internal_accesskey().empty()) {
+    _this->_internal_set_accesskey(from._internal_accesskey());
   }
-  if (from.msg().size() > 0) {
-
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
+  if (!from._internal_sessionkey().empty()) {
+    _this->_internal_set_sessionkey(from._internal_sessionkey());
   }
-}
-
-void PackD1::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackD1)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackD1::CopyFrom(const PackD1& from) {
@@ -7618,713 +6278,233 @@ bool PackD1::IsInitialized() const {
   return true;
 }
 
-void PackD1::Swap(PackD1* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackD1::InternalSwap(PackD1* other) {
-  folderobjkey_.Swap(&other->folderobjkey_);
-  accesskeyid_.Swap(&other->accesskeyid_);
-  accesskey_.Swap(&other->accesskey_);
-  sessionkey_.Swap(&other->sessionkey_);
-  msg_.Swap(&other->msg_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackD1::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[21];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackD1
-
-// string folderObjKey = 1;
-void PackD1::clear_folderobjkey() {
-  folderobjkey_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackD1::folderobjkey() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackD1.folderObjKey)
-  return folderobjkey_.GetNoArena();
-}
-void PackD1::set_folderobjkey(const ::std::string& value) {
-  
-  folderobjkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackD1.folderObjKey)
-}
-void PackD1::set_folderobjkey(const char* value) {
-  
-  folderobjkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackD1.folderObjKey)
-}
-void PackD1::set_folderobjkey(const char* value, size_t size) {
-  
-  folderobjkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackD1.folderObjKey)
-}
-::std::string* PackD1::mutable_folderobjkey() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.folderObjKey)
-  return folderobjkey_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackD1::release_folderobjkey() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackD1.folderObjKey)
-  
-  return folderobjkey_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackD1::set_allocated_folderobjkey(::std::string* folderobjkey) {
-  if (folderobjkey != NULL) {
-    
-  } else {
-    
-  }
-  folderobjkey_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), folderobjkey);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackD1.folderObjKey)
-}
-
-// string accessKeyID = 2;
-void PackD1::clear_accesskeyid() {
-  accesskeyid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackD1::accesskeyid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackD1.accessKeyID)
-  return accesskeyid_.GetNoArena();
-}
-void PackD1::set_accesskeyid(const ::std::string& value) {
-  
-  accesskeyid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackD1.accessKeyID)
-}
-void PackD1::set_accesskeyid(const char* value) {
-  
-  accesskeyid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackD1.accessKeyID)
-}
-void PackD1::set_accesskeyid(const char* value, size_t size) {
-  
-  accesskeyid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackD1.accessKeyID)
-}
-::std::string* PackD1::mutable_accesskeyid() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.accessKeyID)
-  return accesskeyid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackD1::release_accesskeyid() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackD1.accessKeyID)
-  
-  return accesskeyid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackD1::set_allocated_accesskeyid(::std::string* accesskeyid) {
-  if (accesskeyid != NULL) {
-    
-  } else {
-    
-  }
-  accesskeyid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), accesskeyid);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackD1.accessKeyID)
-}
-
-// string accessKey = 3;
-void PackD1::clear_accesskey() {
-  accesskey_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackD1::accesskey() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackD1.accessKey)
-  return accesskey_.GetNoArena();
-}
-void PackD1::set_accesskey(const ::std::string& value) {
-  
-  accesskey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackD1.accessKey)
-}
-void PackD1::set_accesskey(const char* value) {
-  
-  accesskey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackD1.accessKey)
-}
-void PackD1::set_accesskey(const char* value, size_t size) {
-  
-  accesskey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackD1.accessKey)
-}
-::std::string* PackD1::mutable_accesskey() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.accessKey)
-  return accesskey_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackD1::release_accesskey() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackD1.accessKey)
-  
-  return accesskey_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackD1::set_allocated_accesskey(::std::string* accesskey) {
-  if (accesskey != NULL) {
-    
-  } else {
-    
-  }
-  accesskey_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), accesskey);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackD1.accessKey)
-}
-
-// string sessionKey = 4;
-void PackD1::clear_sessionkey() {
-  sessionkey_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackD1::sessionkey() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackD1.sessionKey)
-  return sessionkey_.GetNoArena();
-}
-void PackD1::set_sessionkey(const ::std::string& value) {
-  
-  sessionkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackD1.sessionKey)
-}
-void PackD1::set_sessionkey(const char* value) {
-  
-  sessionkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackD1.sessionKey)
-}
-void PackD1::set_sessionkey(const char* value, size_t size) {
-  
-  sessionkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackD1.sessionKey)
-}
-::std::string* PackD1::mutable_sessionkey() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.sessionKey)
-  return sessionkey_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackD1::release_sessionkey() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackD1.sessionKey)
-  
-  return sessionkey_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackD1::set_allocated_sessionkey(::std::string* sessionkey) {
-  if (sessionkey != NULL) {
-    
-  } else {
-    
-  }
-  sessionkey_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), sessionkey);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackD1.sessionKey)
-}
-
-// string msg = 5;
-void PackD1::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackD1::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackD1.msg)
-  return msg_.GetNoArena();
-}
-void PackD1::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackD1.msg)
-}
-void PackD1::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackD1.msg)
-}
-void PackD1::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackD1.msg)
-}
-::std::string* PackD1::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackD1::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackD1.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackD1::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackD1.msg)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.folderobjkey_, lhs_arena,
+      &other->_impl_.folderobjkey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.accesskeyid_, lhs_arena,
+      &other->_impl_.accesskeyid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.accesskey_, lhs_arena,
+      &other->_impl_.accesskey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sessionkey_, lhs_arena,
+      &other->_impl_.sessionkey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackD1::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[23]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackD2::_Internal {
+ public:
+};
 
-PackD2::PackD2()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackD2)
+PackD2::PackD2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackD2)
 }
 PackD2::PackD2(const PackD2& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  PackD2* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackD2)
 }
 
-void PackD2::SharedCtor() {
-  _cached_size_ = 0;
-}
-
-PackD2::~PackD2() {
-  // @@protoc_insertion_point(destructor:ProtobufPackets.PackD2)
-  SharedDtor();
-}
-
-void PackD2::SharedDtor() {
-}
-
-void PackD2::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackD2::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[22].descriptor;
-}
-
-const PackD2& PackD2::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackD2* PackD2::New(::google::protobuf::Arena* arena) const {
-  PackD2* n = new PackD2;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
-}
-
-void PackD2::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackD2)
-}
-
-bool PackD2::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackD2)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackD2)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackD2)
-  return false;
-#undef DO_
-}
 
-void PackD2::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackD2)
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackD2)
-}
 
-::google::protobuf::uint8* PackD2::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackD2)
-  // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackD2)
-  return target;
-}
 
-size_t PackD2::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackD2)
-  size_t total_size = 0;
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackD2::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackD2::GetClassData() const { return &_class_data_; }
 
-void PackD2::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackD2)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackD2* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackD2>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackD2)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackD2)
-    MergeFrom(*source);
-  }
-}
 
-void PackD2::MergeFrom(const PackD2& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackD2)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-}
 
-void PackD2::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackD2)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-void PackD2::CopyFrom(const PackD2& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackD2)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool PackD2::IsInitialized() const {
-  return true;
-}
 
-void PackD2::Swap(PackD2* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PackD2::InternalSwap(PackD2* other) {
-  std::swap(_cached_size_, other->_cached_size_);
-}
 
-::google::protobuf::Metadata PackD2::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[22];
+::PROTOBUF_NAMESPACE_ID::Metadata PackD2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[24]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackD2
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackD3::_Internal {
+ public:
+};
 
-PackD3::PackD3()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackD3)
+PackD3::PackD3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackD3)
 }
 PackD3::PackD3(const PackD3& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  PackD3* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackD3)
 }
 
-void PackD3::SharedCtor() {
-  _cached_size_ = 0;
-}
-
-PackD3::~PackD3() {
-  // @@protoc_insertion_point(destructor:ProtobufPackets.PackD3)
-  SharedDtor();
-}
-
-void PackD3::SharedDtor() {
-}
-
-void PackD3::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackD3::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[23].descriptor;
-}
-
-const PackD3& PackD3::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackD3* PackD3::New(::google::protobuf::Arena* arena) const {
-  PackD3* n = new PackD3;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
-}
-
-void PackD3::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackD3)
-}
-
-bool PackD3::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackD3)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackD3)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackD3)
-  return false;
-#undef DO_
-}
 
-void PackD3::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackD3)
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackD3)
-}
 
-::google::protobuf::uint8* PackD3::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackD3)
-  // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackD3)
-  return target;
-}
 
-size_t PackD3::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackD3)
-  size_t total_size = 0;
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackD3::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackD3::GetClassData() const { return &_class_data_; }
 
-void PackD3::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackD3)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackD3* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackD3>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackD3)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackD3)
-    MergeFrom(*source);
-  }
-}
 
-void PackD3::MergeFrom(const PackD3& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackD3)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-}
 
-void PackD3::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackD3)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-void PackD3::CopyFrom(const PackD3& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackD3)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool PackD3::IsInitialized() const {
-  return true;
-}
 
-void PackD3::Swap(PackD3* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PackD3::InternalSwap(PackD3* other) {
-  std::swap(_cached_size_, other->_cached_size_);
-}
 
-::google::protobuf::Metadata PackD3::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[23];
+::PROTOBUF_NAMESPACE_ID::Metadata PackD3::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[25]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackD3
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackD4::kHasResumeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackD4::_Internal {
+ public:
+};
 
-PackD4::PackD4()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackD4)
+PackD4::PackD4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackD4)
 }
 PackD4::PackD4(const PackD4& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  hasresume_ = from.hasresume_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackD4* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hasresume_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.hasresume_ = from._impl_.hasresume_;
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackD4)
 }
 
-void PackD4::SharedCtor() {
-  hasresume_ = false;
-  _cached_size_ = 0;
+inline void PackD4::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hasresume_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 PackD4::~PackD4() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackD4)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackD4::SharedDtor() {
+inline void PackD4::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void PackD4::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackD4::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[24].descriptor;
-}
-
-const PackD4& PackD4::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackD4* PackD4::New(::google::protobuf::Arena* arena) const {
-  PackD4* n = new PackD4;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackD4::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackD4)
-  hasresume_ = false;
-}
-
-bool PackD4::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackD4)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // bool hasResume = 1;
-      case 1: {
-        if (tag == 8u) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &hasresume_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackD4)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackD4)
-  return false;
-#undef DO_
+  _impl_.hasresume_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackD4::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackD4)
-  // bool hasResume = 1;
-  if (this->hasresume() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->hasresume(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackD4)
+const char* PackD4::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool hasResume = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.hasresume_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackD4::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackD4::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackD4)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // bool hasResume = 1;
-  if (this->hasresume() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->hasresume(), target);
+  if (this->_internal_hasresume() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_hasresume(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackD4)
   return target;
 }
@@ -8333,47 +6513,37 @@ size_t PackD4::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackD4)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bool hasResume = 1;
-  if (this->hasresume() != 0) {
+  if (this->_internal_hasresume() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackD4::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackD4)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackD4* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackD4>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackD4)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackD4)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackD4::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackD4::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackD4::GetClassData() const { return &_class_data_; }
 
-void PackD4::MergeFrom(const PackD4& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackD4)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.hasresume() != 0) {
-    set_hasresume(from.hasresume());
-  }
-}
 
-void PackD4::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackD4)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void PackD4::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackD4*>(&to_msg);
+  auto& from = static_cast<const PackD4&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackD4)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_hasresume() != 0) {
+    _this->_internal_set_hasresume(from._internal_hasresume());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackD4::CopyFrom(const PackD4& from) {
@@ -8387,135 +6557,152 @@ bool PackD4::IsInitialized() const {
   return true;
 }
 
-void PackD4::Swap(PackD4* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackD4::InternalSwap(PackD4* other) {
-  std::swap(hasresume_, other->hasresume_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackD4::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[24];
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.hasresume_, other->_impl_.hasresume_);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackD4
-
-// bool hasResume = 1;
-void PackD4::clear_hasresume() {
-  hasresume_ = false;
-}
-bool PackD4::hasresume() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackD4.hasResume)
-  return hasresume_;
-}
-void PackD4::set_hasresume(bool value) {
-  
-  hasresume_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackD4.hasResume)
+::PROTOBUF_NAMESPACE_ID::Metadata PackD4::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[26]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackE0::_Internal {
+ public:
+};
 
-PackE0::PackE0()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackE0)
+PackE0::PackE0(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackE0)
 }
 PackE0::PackE0(const PackE0& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackE0* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pagesize_){}
+    , decltype(_impl_.cursor_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.pagesize_, &from._impl_.pagesize_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cursor_) -
+    reinterpret_cast<char*>(&_impl_.pagesize_)) + sizeof(_impl_.cursor_));
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackE0)
 }
 
-void PackE0::SharedCtor() {
-  _cached_size_ = 0;
+inline void PackE0::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pagesize_){0u}
+    , decltype(_impl_.cursor_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 PackE0::~PackE0() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackE0)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackE0::SharedDtor() {
+inline void PackE0::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void PackE0::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackE0::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[25].descriptor;
-}
-
-const PackE0& PackE0::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackE0* PackE0::New(::google::protobuf::Arena* arena) const {
-  PackE0* n = new PackE0;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackE0::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE0)
-}
-
-bool PackE0::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackE0)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.pagesize_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cursor_) -
+      reinterpret_cast<char*>(&_impl_.pagesize_)) + sizeof(_impl_.cursor_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackE0::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 pageSize = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.pagesize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cursor = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cursor_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
   handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackE0)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackE0)
-  return false;
-#undef DO_
-}
-
-void PackE0::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackE0)
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackE0)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackE0::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackE0::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackE0)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 pageSize = 1;
+  if (this->_internal_pagesize() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_pagesize(), target);
+  }
+
+  // uint32 cursor = 2;
+  if (this->_internal_cursor() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cursor(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackE0)
   return target;
 }
@@ -8524,39 +6711,45 @@ size_t PackE0::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackE0)
   size_t total_size = 0;
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void PackE0::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackE0)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackE0* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackE0>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackE0)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackE0)
-    MergeFrom(*source);
+  // uint32 pageSize = 1;
+  if (this->_internal_pagesize() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pagesize());
+  }
+
+  // uint32 cursor = 2;
+  if (this->_internal_cursor() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cursor());
   }
-}
 
-void PackE0::MergeFrom(const PackE0& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE0)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackE0::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackE0)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackE0::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackE0::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackE0::GetClassData() const { return &_class_data_; }
+
+
+void PackE0::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackE0*>(&to_msg);
+  auto& from = static_cast<const PackE0&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE0)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_pagesize() != 0) {
+    _this->_internal_set_pagesize(from._internal_pagesize());
+  }
+  if (from._internal_cursor() != 0) {
+    _this->_internal_set_cursor(from._internal_cursor());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackE0::CopyFrom(const PackE0& from) {
@@ -8570,325 +6763,287 @@ bool PackE0::IsInitialized() const {
   return true;
 }
 
-void PackE0::Swap(PackE0* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackE0::InternalSwap(PackE0* other) {
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PackE0, _impl_.cursor_)
+      + sizeof(PackE0::_impl_.cursor_)
+      - PROTOBUF_FIELD_OFFSET(PackE0, _impl_.pagesize_)>(
+          reinterpret_cast<char*>(&_impl_.pagesize_),
+          reinterpret_cast<char*>(&other->_impl_.pagesize_));
 }
 
-::google::protobuf::Metadata PackE0::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[25];
+::PROTOBUF_NAMESPACE_ID::Metadata PackE0::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[27]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackE0
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackE1::kEmployeeEIDsFieldNumber;
-const int PackE1::kUnacceptedEIDsFieldNumber;
-const int PackE1::kAcceptedEIDsFieldNumber;
-const int PackE1::kSuccessFieldNumber;
-const int PackE1::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackE1::_Internal {
+ public:
+};
 
-PackE1::PackE1()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackE1)
+PackE1::PackE1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackE1)
 }
 PackE1::PackE1(const PackE1& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      employeeeids_(from.employeeeids_),
-      unacceptedeids_(from.unacceptedeids_),
-      acceptedeids_(from.acceptedeids_),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  success_ = from.success_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackE1* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.employeeeids_){from._impl_.employeeeids_}
+    , /*decltype(_impl_._employeeeids_cached_byte_size_)*/{0}
+    , decltype(_impl_.unacceptedeids_){from._impl_.unacceptedeids_}
+    , /*decltype(_impl_._unacceptedeids_cached_byte_size_)*/{0}
+    , decltype(_impl_.acceptedeids_){from._impl_.acceptedeids_}
+    , /*decltype(_impl_._acceptedeids_cached_byte_size_)*/{0}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.morepages_){}
+    , decltype(_impl_.nextcursor_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.success_, &from._impl_.success_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.nextcursor_) -
+    reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.nextcursor_));
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackE1)
 }
 
-void PackE1::SharedCtor() {
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-  _cached_size_ = 0;
+inline void PackE1::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.employeeeids_){arena}
+    , /*decltype(_impl_._employeeeids_cached_byte_size_)*/{0}
+    , decltype(_impl_.unacceptedeids_){arena}
+    , /*decltype(_impl_._unacceptedeids_cached_byte_size_)*/{0}
+    , decltype(_impl_.acceptedeids_){arena}
+    , /*decltype(_impl_._acceptedeids_cached_byte_size_)*/{0}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.morepages_){false}
+    , decltype(_impl_.nextcursor_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackE1::~PackE1() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackE1)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackE1::SharedDtor() {
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackE1::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.employeeeids_.~RepeatedField();
+  _impl_.unacceptedeids_.~RepeatedField();
+  _impl_.acceptedeids_.~RepeatedField();
+  _impl_.msg_.Destroy();
 }
 
 void PackE1::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackE1::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[26].descriptor;
-}
-
-const PackE1& PackE1::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackE1* PackE1::New(::google::protobuf::Arena* arena) const {
-  PackE1* n = new PackE1;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackE1::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE1)
-  employeeeids_.Clear();
-  unacceptedeids_.Clear();
-  acceptedeids_.Clear();
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-}
-
-bool PackE1::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackE1)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.employeeeids_.Clear();
+  _impl_.unacceptedeids_.Clear();
+  _impl_.acceptedeids_.Clear();
+  _impl_.msg_.ClearToEmpty();
+  ::memset(&_impl_.success_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.nextcursor_) -
+      reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.nextcursor_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackE1::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated uint32 employeeEIDs = 1;
-      case 1: {
-        if (tag == 10u) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, this->mutable_employeeeids())));
-        } else if (tag == 8u) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 1, 10u, input, this->mutable_employeeeids())));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_employeeeids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_employeeeids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated uint32 unacceptedEIDs = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, this->mutable_unacceptedeids())));
-        } else if (tag == 16u) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 1, 18u, input, this->mutable_unacceptedeids())));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_unacceptedeids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_unacceptedeids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated uint32 acceptedEIDs = 3;
-      case 3: {
-        if (tag == 26u) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, this->mutable_acceptedeids())));
-        } else if (tag == 24u) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 1, 26u, input, this->mutable_acceptedeids())));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_acceptedeids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_acceptedeids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool success = 4;
-      case 4: {
-        if (tag == 32u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 5;
-      case 5: {
-        if (tag == 42u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackE1.msg"));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackE1.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      // uint32 nextCursor = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.nextcursor_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool morePages = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.morepages_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackE1)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackE1)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PackE1::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackE1)
+uint8_t* PackE1::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackE1)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // repeated uint32 employeeEIDs = 1;
-  if (this->employeeeids_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(1, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_employeeeids_cached_byte_size_);
-  }
-  for (int i = 0; i < this->employeeeids_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
-      this->employeeeids(i), output);
+  {
+    int byte_size = _impl_._employeeeids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_employeeeids(), byte_size, target);
+    }
   }
 
   // repeated uint32 unacceptedEIDs = 2;
-  if (this->unacceptedeids_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_unacceptedeids_cached_byte_size_);
-  }
-  for (int i = 0; i < this->unacceptedeids_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
-      this->unacceptedeids(i), output);
+  {
+    int byte_size = _impl_._unacceptedeids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_unacceptedeids(), byte_size, target);
+    }
   }
 
   // repeated uint32 acceptedEIDs = 3;
-  if (this->acceptedeids_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(3, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_acceptedeids_cached_byte_size_);
-  }
-  for (int i = 0; i < this->acceptedeids_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
-      this->acceptedeids(i), output);
+  {
+    int byte_size = _impl_._acceptedeids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_acceptedeids(), byte_size, target);
+    }
   }
 
   // bool success = 4;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->success(), output);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_success(), target);
   }
 
   // string msg = 5;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackE1.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->msg(), output);
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_msg(), target);
   }
 
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackE1)
-}
-
-::google::protobuf::uint8* PackE1::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackE1)
-  // repeated uint32 employeeEIDs = 1;
-  if (this->employeeeids_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      1,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _employeeeids_cached_byte_size_, target);
-  }
-  for (int i = 0; i < this->employeeeids_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt32NoTagToArray(this->employeeeids(i), target);
-  }
-
-  // repeated uint32 unacceptedEIDs = 2;
-  if (this->unacceptedeids_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      2,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _unacceptedeids_cached_byte_size_, target);
-  }
-  for (int i = 0; i < this->unacceptedeids_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt32NoTagToArray(this->unacceptedeids(i), target);
-  }
-
-  // repeated uint32 acceptedEIDs = 3;
-  if (this->acceptedeids_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      3,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _acceptedeids_cached_byte_size_, target);
-  }
-  for (int i = 0; i < this->acceptedeids_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt32NoTagToArray(this->acceptedeids(i), target);
+  // uint32 nextCursor = 6;
+  if (this->_internal_nextcursor() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_nextcursor(), target);
   }
 
-  // bool success = 4;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->success(), target);
+  // bool morePages = 7;
+  if (this->_internal_morepages() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_morepages(), target);
   }
 
-  // string msg = 5;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackE1.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        5, this->msg(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackE1)
   return target;
 }
@@ -8897,118 +7052,108 @@ size_t PackE1::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackE1)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated uint32 employeeEIDs = 1;
   {
-    size_t data_size = 0;
-    unsigned int count = this->employeeeids_size();
-    for (unsigned int i = 0; i < count; i++) {
-      data_size += ::google::protobuf::internal::WireFormatLite::
-        UInt32Size(this->employeeeids(i));
-    }
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.employeeeids_);
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _employeeeids_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._employeeeids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // repeated uint32 unacceptedEIDs = 2;
   {
-    size_t data_size = 0;
-    unsigned int count = this->unacceptedeids_size();
-    for (unsigned int i = 0; i < count; i++) {
-      data_size += ::google::protobuf::internal::WireFormatLite::
-        UInt32Size(this->unacceptedeids(i));
-    }
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.unacceptedeids_);
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _unacceptedeids_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._unacceptedeids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // repeated uint32 acceptedEIDs = 3;
   {
-    size_t data_size = 0;
-    unsigned int count = this->acceptedeids_size();
-    for (unsigned int i = 0; i < count; i++) {
-      data_size += ::google::protobuf::internal::WireFormatLite::
-        UInt32Size(this->acceptedeids(i));
-    }
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.acceptedeids_);
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _acceptedeids_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._acceptedeids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // string msg = 5;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
   // bool success = 4;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  // bool morePages = 7;
+  if (this->_internal_morepages() != 0) {
+    total_size += 1 + 1;
+  }
 
-void PackE1::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackE1)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackE1* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackE1>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackE1)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackE1)
-    MergeFrom(*source);
+  // uint32 nextCursor = 6;
+  if (this->_internal_nextcursor() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_nextcursor());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackE1::MergeFrom(const PackE1& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE1)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  employeeeids_.MergeFrom(from.employeeeids_);
-  unacceptedeids_.MergeFrom(from.unacceptedeids_);
-  acceptedeids_.MergeFrom(from.acceptedeids_);
-  if (from.msg().size() > 0) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackE1::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackE1::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackE1::GetClassData() const { return &_class_data_; }
+
+
+void PackE1::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackE1*>(&to_msg);
+  auto& from = static_cast<const PackE1&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE1)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
+  _this->_impl_.employeeeids_.MergeFrom(from._impl_.employeeeids_);
+  _this->_impl_.unacceptedeids_.MergeFrom(from._impl_.unacceptedeids_);
+  _this->_impl_.acceptedeids_.MergeFrom(from._impl_.acceptedeids_);
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void PackE1::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackE1)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_morepages() != 0) {
+    _this->_internal_set_morepages(from._internal_morepages());
+  }
+  if (from._internal_nextcursor() != 0) {
+    _this->_internal_set_nextcursor(from._internal_nextcursor());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackE1::CopyFrom(const PackE1& from) {
@@ -9022,333 +7167,166 @@ bool PackE1::IsInitialized() const {
   return true;
 }
 
-void PackE1::Swap(PackE1* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackE1::InternalSwap(PackE1* other) {
-  employeeeids_.UnsafeArenaSwap(&other->employeeeids_);
-  unacceptedeids_.UnsafeArenaSwap(&other->unacceptedeids_);
-  acceptedeids_.UnsafeArenaSwap(&other->acceptedeids_);
-  msg_.Swap(&other->msg_);
-  std::swap(success_, other->success_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackE1::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[26];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackE1
-
-// repeated uint32 employeeEIDs = 1;
-int PackE1::employeeeids_size() const {
-  return employeeeids_.size();
-}
-void PackE1::clear_employeeeids() {
-  employeeeids_.Clear();
-}
-::google::protobuf::uint32 PackE1::employeeeids(int index) const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.employeeEIDs)
-  return employeeeids_.Get(index);
-}
-void PackE1::set_employeeeids(int index, ::google::protobuf::uint32 value) {
-  employeeeids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.employeeEIDs)
-}
-void PackE1::add_employeeeids(::google::protobuf::uint32 value) {
-  employeeeids_.Add(value);
-  // @@protoc_insertion_point(field_add:ProtobufPackets.PackE1.employeeEIDs)
-}
-const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-PackE1::employeeeids() const {
-  // @@protoc_insertion_point(field_list:ProtobufPackets.PackE1.employeeEIDs)
-  return employeeeids_;
-}
-::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-PackE1::mutable_employeeeids() {
-  // @@protoc_insertion_point(field_mutable_list:ProtobufPackets.PackE1.employeeEIDs)
-  return &employeeeids_;
-}
-
-// repeated uint32 unacceptedEIDs = 2;
-int PackE1::unacceptedeids_size() const {
-  return unacceptedeids_.size();
-}
-void PackE1::clear_unacceptedeids() {
-  unacceptedeids_.Clear();
-}
-::google::protobuf::uint32 PackE1::unacceptedeids(int index) const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.unacceptedEIDs)
-  return unacceptedeids_.Get(index);
-}
-void PackE1::set_unacceptedeids(int index, ::google::protobuf::uint32 value) {
-  unacceptedeids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.unacceptedEIDs)
-}
-void PackE1::add_unacceptedeids(::google::protobuf::uint32 value) {
-  unacceptedeids_.Add(value);
-  // @@protoc_insertion_point(field_add:ProtobufPackets.PackE1.unacceptedEIDs)
-}
-const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-PackE1::unacceptedeids() const {
-  // @@protoc_insertion_point(field_list:ProtobufPackets.PackE1.unacceptedEIDs)
-  return unacceptedeids_;
-}
-::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-PackE1::mutable_unacceptedeids() {
-  // @@protoc_insertion_point(field_mutable_list:ProtobufPackets.PackE1.unacceptedEIDs)
-  return &unacceptedeids_;
-}
-
-// repeated uint32 acceptedEIDs = 3;
-int PackE1::acceptedeids_size() const {
-  return acceptedeids_.size();
-}
-void PackE1::clear_acceptedeids() {
-  acceptedeids_.Clear();
-}
-::google::protobuf::uint32 PackE1::acceptedeids(int index) const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.acceptedEIDs)
-  return acceptedeids_.Get(index);
-}
-void PackE1::set_acceptedeids(int index, ::google::protobuf::uint32 value) {
-  acceptedeids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.acceptedEIDs)
-}
-void PackE1::add_acceptedeids(::google::protobuf::uint32 value) {
-  acceptedeids_.Add(value);
-  // @@protoc_insertion_point(field_add:ProtobufPackets.PackE1.acceptedEIDs)
-}
-const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-PackE1::acceptedeids() const {
-  // @@protoc_insertion_point(field_list:ProtobufPackets.PackE1.acceptedEIDs)
-  return acceptedeids_;
-}
-::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-PackE1::mutable_acceptedeids() {
-  // @@protoc_insertion_point(field_mutable_list:ProtobufPackets.PackE1.acceptedEIDs)
-  return &acceptedeids_;
-}
-
-// bool success = 4;
-void PackE1::clear_success() {
-  success_ = false;
-}
-bool PackE1::success() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.success)
-  return success_;
-}
-void PackE1::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.success)
-}
-
-// string msg = 5;
-void PackE1::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackE1::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.msg)
-  return msg_.GetNoArena();
-}
-void PackE1::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.msg)
-}
-void PackE1::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackE1.msg)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.employeeeids_.InternalSwap(&other->_impl_.employeeeids_);
+  _impl_.unacceptedeids_.InternalSwap(&other->_impl_.unacceptedeids_);
+  _impl_.acceptedeids_.InternalSwap(&other->_impl_.acceptedeids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PackE1, _impl_.nextcursor_)
+      + sizeof(PackE1::_impl_.nextcursor_)
+      - PROTOBUF_FIELD_OFFSET(PackE1, _impl_.success_)>(
+          reinterpret_cast<char*>(&_impl_.success_),
+          reinterpret_cast<char*>(&other->_impl_.success_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackE1::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[28]);
 }
-void PackE1::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackE1.msg)
-}
-::std::string* PackE1::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE1.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackE1::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackE1.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackE1::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackE1.msg)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackE2::kEIDFieldNumber;
-const int PackE2::kAStateFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackE2::_Internal {
+ public:
+};
 
-PackE2::PackE2()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackE2)
+PackE2::PackE2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackE2)
 }
 PackE2::PackE2(const PackE2& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&eid_, &from.eid_,
-    reinterpret_cast<char*>(&astate_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(astate_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackE2* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.eid_){}
+    , decltype(_impl_.astate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.eid_, &from._impl_.eid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.astate_) -
+    reinterpret_cast<char*>(&_impl_.eid_)) + sizeof(_impl_.astate_));
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackE2)
 }
 
-void PackE2::SharedCtor() {
-  ::memset(&eid_, 0, reinterpret_cast<char*>(&astate_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(astate_));
-  _cached_size_ = 0;
+inline void PackE2::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.eid_){0u}
+    , decltype(_impl_.astate_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 PackE2::~PackE2() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackE2)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackE2::SharedDtor() {
+inline void PackE2::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void PackE2::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackE2::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[27].descriptor;
-}
-
-const PackE2& PackE2::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackE2* PackE2::New(::google::protobuf::Arena* arena) const {
-  PackE2* n = new PackE2;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackE2::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE2)
-  ::memset(&eid_, 0, reinterpret_cast<char*>(&astate_) -
-    reinterpret_cast<char*>(&eid_) + sizeof(astate_));
-}
-
-bool PackE2::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackE2)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.eid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.astate_) -
+      reinterpret_cast<char*>(&_impl_.eid_)) + sizeof(_impl_.astate_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackE2::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 eID = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &eid_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.eid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 aState = 2;
-      case 2: {
-        if (tag == 16u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &astate_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.astate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackE2)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackE2)
-  return false;
-#undef DO_
-}
-
-void PackE2::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackE2)
-  // uint32 eID = 1;
-  if (this->eid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->eid(), output);
-  }
-
-  // int32 aState = 2;
-  if (this->astate() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->astate(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackE2)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackE2::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackE2::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackE2)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // uint32 eID = 1;
-  if (this->eid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->eid(), target);
+  if (this->_internal_eid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_eid(), target);
   }
 
   // int32 aState = 2;
-  if (this->astate() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->astate(), target);
+  if (this->_internal_astate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_astate(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackE2)
   return target;
 }
@@ -9357,59 +7335,45 @@ size_t PackE2::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackE2)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // uint32 eID = 1;
-  if (this->eid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->eid());
+  if (this->_internal_eid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eid());
   }
 
   // int32 aState = 2;
-  if (this->astate() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->astate());
+  if (this->_internal_astate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_astate());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackE2::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackE2)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackE2* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackE2>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackE2)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackE2)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackE2::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackE2::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackE2::GetClassData() const { return &_class_data_; }
+
+
+void PackE2::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackE2*>(&to_msg);
+  auto& from = static_cast<const PackE2&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE2)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void PackE2::MergeFrom(const PackE2& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE2)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.eid() != 0) {
-    set_eid(from.eid());
+  if (from._internal_eid() != 0) {
+    _this->_internal_set_eid(from._internal_eid());
   }
-  if (from.astate() != 0) {
-    set_astate(from.astate());
+  if (from._internal_astate() != 0) {
+    _this->_internal_set_astate(from._internal_astate());
   }
-}
-
-void PackE2::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackE2)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackE2::CopyFrom(const PackE2& from) {
@@ -9423,254 +7387,193 @@ bool PackE2::IsInitialized() const {
   return true;
 }
 
-void PackE2::Swap(PackE2* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackE2::InternalSwap(PackE2* other) {
-  std::swap(eid_, other->eid_);
-  std::swap(astate_, other->astate_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackE2::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[27];
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PackE2, _impl_.astate_)
+      + sizeof(PackE2::_impl_.astate_)
+      - PROTOBUF_FIELD_OFFSET(PackE2, _impl_.eid_)>(
+          reinterpret_cast<char*>(&_impl_.eid_),
+          reinterpret_cast<char*>(&other->_impl_.eid_));
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackE2
-
-// uint32 eID = 1;
-void PackE2::clear_eid() {
-  eid_ = 0u;
-}
-::google::protobuf::uint32 PackE2::eid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE2.eID)
-  return eid_;
-}
-void PackE2::set_eid(::google::protobuf::uint32 value) {
-  
-  eid_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE2.eID)
-}
-
-// int32 aState = 2;
-void PackE2::clear_astate() {
-  astate_ = 0;
-}
-::google::protobuf::int32 PackE2::astate() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE2.aState)
-  return astate_;
+::PROTOBUF_NAMESPACE_ID::Metadata PackE2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[29]);
 }
-void PackE2::set_astate(::google::protobuf::int32 value) {
-  
-  astate_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE2.aState)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackE3::kSuccessFieldNumber;
-const int PackE3::kMsgFieldNumber;
-const int PackE3::kEIDFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackE3::_Internal {
+ public:
+};
 
-PackE3::PackE3()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackE3)
+PackE3::PackE3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackE3)
 }
 PackE3::PackE3(const PackE3& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  ::memcpy(&success_, &from.success_,
-    reinterpret_cast<char*>(&eid_) -
-    reinterpret_cast<char*>(&success_) + sizeof(eid_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackE3* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.eid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.success_, &from._impl_.success_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.eid_) -
+    reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.eid_));
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackE3)
 }
 
-void PackE3::SharedCtor() {
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&success_, 0, reinterpret_cast<char*>(&eid_) -
-    reinterpret_cast<char*>(&success_) + sizeof(eid_));
-  _cached_size_ = 0;
+inline void PackE3::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.eid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackE3::~PackE3() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackE3)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackE3::SharedDtor() {
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackE3::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_.Destroy();
 }
 
 void PackE3::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackE3::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[28].descriptor;
-}
-
-const PackE3& PackE3::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackE3* PackE3::New(::google::protobuf::Arena* arena) const {
-  PackE3* n = new PackE3;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void PackE3::Clear() {
 // @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE3)
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&success_, 0, reinterpret_cast<char*>(&eid_) -
-    reinterpret_cast<char*>(&success_) + sizeof(eid_));
-}
-
-bool PackE3::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackE3)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.msg_.ClearToEmpty();
+  ::memset(&_impl_.success_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.eid_) -
+      reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.eid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackE3::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackE3.msg"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint32 eID = 3;
-      case 3: {
-        if (tag == 24u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &eid_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackE3.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackE3)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackE3)
-  return false;
-#undef DO_
-}
-
-void PackE3::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackE3)
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackE3.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->msg(), output);
-  }
-
-  // uint32 eID = 3;
-  if (this->eid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->eid(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackE3)
+        continue;
+      // uint32 eID = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.eid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackE3::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackE3::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackE3)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackE3.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg(), target);
   }
 
   // uint32 eID = 3;
-  if (this->eid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->eid(), target);
+  if (this->_internal_eid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_eid(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackE3)
   return target;
 }
@@ -9679,68 +7582,55 @@ size_t PackE3::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackE3)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string msg = 2;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
   // uint32 eID = 3;
-  if (this->eid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->eid());
+  if (this->_internal_eid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eid());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackE3::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackE3)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackE3* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackE3>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackE3)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackE3)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackE3::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackE3::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackE3::GetClassData() const { return &_class_data_; }
 
-void PackE3::MergeFrom(const PackE3& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE3)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.msg().size() > 0) {
 
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
+void PackE3::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackE3*>(&to_msg);
+  auto& from = static_cast<const PackE3&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE3)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-  if (from.eid() != 0) {
-    set_eid(from.eid());
+  if (from._internal_eid() != 0) {
+    _this->_internal_set_eid(from._internal_eid());
   }
-}
-
-void PackE3::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackE3)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackE3::CopyFrom(const PackE3& from) {
@@ -9754,439 +7644,219 @@ bool PackE3::IsInitialized() const {
   return true;
 }
 
-void PackE3::Swap(PackE3* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackE3::InternalSwap(PackE3* other) {
-  msg_.Swap(&other->msg_);
-  std::swap(success_, other->success_);
-  std::swap(eid_, other->eid_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackE3::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[28];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackE3
-
-// bool success = 1;
-void PackE3::clear_success() {
-  success_ = false;
-}
-bool PackE3::success() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE3.success)
-  return success_;
-}
-void PackE3::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE3.success)
-}
-
-// string msg = 2;
-void PackE3::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackE3::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE3.msg)
-  return msg_.GetNoArena();
-}
-void PackE3::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE3.msg)
-}
-void PackE3::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackE3.msg)
-}
-void PackE3::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackE3.msg)
-}
-::std::string* PackE3::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE3.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackE3::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackE3.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackE3::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackE3.msg)
-}
-
-// uint32 eID = 3;
-void PackE3::clear_eid() {
-  eid_ = 0u;
-}
-::google::protobuf::uint32 PackE3::eid() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE3.eID)
-  return eid_;
-}
-void PackE3::set_eid(::google::protobuf::uint32 value) {
-  
-  eid_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE3.eID)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PackE3, _impl_.eid_)
+      + sizeof(PackE3::_impl_.eid_)
+      - PROTOBUF_FIELD_OFFSET(PackE3, _impl_.success_)>(
+          reinterpret_cast<char*>(&_impl_.success_),
+          reinterpret_cast<char*>(&other->_impl_.success_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackE3::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[30]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackE4::_Internal {
+ public:
+};
 
-PackE4::PackE4()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackE4)
+PackE4::PackE4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackE4)
 }
 PackE4::PackE4(const PackE4& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  PackE4* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackE4)
 }
 
-void PackE4::SharedCtor() {
-  _cached_size_ = 0;
-}
-
-PackE4::~PackE4() {
-  // @@protoc_insertion_point(destructor:ProtobufPackets.PackE4)
-  SharedDtor();
-}
-
-void PackE4::SharedDtor() {
-}
-
-void PackE4::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackE4::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[29].descriptor;
-}
-
-const PackE4& PackE4::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
-
-PackE4* PackE4::New(::google::protobuf::Arena* arena) const {
-  PackE4* n = new PackE4;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
-}
-
-void PackE4::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE4)
-}
-
-bool PackE4::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackE4)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackE4)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackE4)
-  return false;
-#undef DO_
-}
 
-void PackE4::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackE4)
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackE4)
-}
 
-::google::protobuf::uint8* PackE4::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackE4)
-  // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackE4)
-  return target;
-}
 
-size_t PackE4::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackE4)
-  size_t total_size = 0;
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackE4::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackE4::GetClassData() const { return &_class_data_; }
 
-void PackE4::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackE4)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackE4* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackE4>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackE4)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackE4)
-    MergeFrom(*source);
-  }
-}
 
-void PackE4::MergeFrom(const PackE4& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE4)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-}
 
-void PackE4::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackE4)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-void PackE4::CopyFrom(const PackE4& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ProtobufPackets.PackE4)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool PackE4::IsInitialized() const {
-  return true;
-}
 
-void PackE4::Swap(PackE4* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PackE4::InternalSwap(PackE4* other) {
-  std::swap(_cached_size_, other->_cached_size_);
-}
 
-::google::protobuf::Metadata PackE4::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[29];
+::PROTOBUF_NAMESPACE_ID::Metadata PackE4::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[31]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackE4
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackE5::kAStateFieldNumber;
-const int PackE5::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackE5::_Internal {
+ public:
+};
 
-PackE5::PackE5()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackE5)
+PackE5::PackE5(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackE5)
 }
 PackE5::PackE5(const PackE5& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  astate_ = from.astate_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackE5* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.astate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.astate_ = from._impl_.astate_;
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackE5)
 }
 
-void PackE5::SharedCtor() {
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  astate_ = 0;
-  _cached_size_ = 0;
+inline void PackE5::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.astate_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackE5::~PackE5() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackE5)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackE5::SharedDtor() {
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackE5::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_.Destroy();
 }
 
 void PackE5::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackE5::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[30].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackE5& PackE5::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackE5::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE5)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackE5* PackE5::New(::google::protobuf::Arena* arena) const {
-  PackE5* n = new PackE5;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.msg_.ClearToEmpty();
+  _impl_.astate_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackE5::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE5)
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  astate_ = 0;
-}
-
-bool PackE5::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackE5)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackE5::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // int32 aState = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &astate_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.astate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackE5.msg"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackE5.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackE5)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackE5)
-  return false;
-#undef DO_
-}
-
-void PackE5::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackE5)
-  // int32 aState = 1;
-  if (this->astate() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->astate(), output);
-  }
-
-  // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackE5.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->msg(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackE5)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackE5::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackE5::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackE5)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // int32 aState = 1;
-  if (this->astate() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->astate(), target);
+  if (this->_internal_astate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_astate(), target);
   }
 
   // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackE5.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackE5)
   return target;
 }
@@ -10195,60 +7865,47 @@ size_t PackE5::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackE5)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string msg = 2;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
   // int32 aState = 1;
-  if (this->astate() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->astate());
+  if (this->_internal_astate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_astate());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackE5::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackE5)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackE5* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackE5>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackE5)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackE5)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackE5::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackE5::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackE5::GetClassData() const { return &_class_data_; }
+
 
-void PackE5::MergeFrom(const PackE5& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE5)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.msg().size() > 0) {
+void PackE5::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackE5*>(&to_msg);
+  auto& from = static_cast<const PackE5&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE5)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
   }
-  if (from.astate() != 0) {
-    set_astate(from.astate());
+  if (from._internal_astate() != 0) {
+    _this->_internal_set_astate(from._internal_astate());
   }
-}
-
-void PackE5::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackE5)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackE5::CopyFrom(const PackE5& from) {
@@ -10262,212 +7919,138 @@ bool PackE5::IsInitialized() const {
   return true;
 }
 
-void PackE5::Swap(PackE5* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackE5::InternalSwap(PackE5* other) {
-  msg_.Swap(&other->msg_);
-  std::swap(astate_, other->astate_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  swap(_impl_.astate_, other->_impl_.astate_);
 }
 
-::google::protobuf::Metadata PackE5::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[30];
+::PROTOBUF_NAMESPACE_ID::Metadata PackE5::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[32]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackE5
-
-// int32 aState = 1;
-void PackE5::clear_astate() {
-  astate_ = 0;
-}
-::google::protobuf::int32 PackE5::astate() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE5.aState)
-  return astate_;
-}
-void PackE5::set_astate(::google::protobuf::int32 value) {
-  
-  astate_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE5.aState)
-}
-
-// string msg = 2;
-void PackE5::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& PackE5::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE5.msg)
-  return msg_.GetNoArena();
-}
-void PackE5::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE5.msg)
-}
-void PackE5::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackE5.msg)
-}
-void PackE5::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackE5.msg)
-}
-::std::string* PackE5::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE5.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* PackE5::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackE5.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void PackE5::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackE5.msg)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackE6::kAcceptFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackE6::_Internal {
+ public:
+};
 
-PackE6::PackE6()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackE6)
+PackE6::PackE6(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackE6)
 }
 PackE6::PackE6(const PackE6& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  accept_ = from.accept_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackE6* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.accept_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.accept_ = from._impl_.accept_;
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackE6)
 }
 
-void PackE6::SharedCtor() {
-  accept_ = false;
-  _cached_size_ = 0;
+inline void PackE6::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.accept_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 PackE6::~PackE6() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackE6)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackE6::SharedDtor() {
+inline void PackE6::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void PackE6::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackE6::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[31].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackE6& PackE6::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackE6::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE6)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackE6* PackE6::New(::google::protobuf::Arena* arena) const {
-  PackE6* n = new PackE6;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.accept_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackE6::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE6)
-  accept_ = false;
-}
-
-bool PackE6::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackE6)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackE6::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool accept = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &accept_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.accept_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackE6)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackE6)
-  return false;
-#undef DO_
-}
-
-void PackE6::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackE6)
-  // bool accept = 1;
-  if (this->accept() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->accept(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackE6)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackE6::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackE6::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackE6)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // bool accept = 1;
-  if (this->accept() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->accept(), target);
+  if (this->_internal_accept() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_accept(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackE6)
   return target;
 }
@@ -10476,47 +8059,37 @@ size_t PackE6::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackE6)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bool accept = 1;
-  if (this->accept() != 0) {
+  if (this->_internal_accept() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackE6::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackE6)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackE6* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackE6>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackE6)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackE6)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackE6::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackE6::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackE6::GetClassData() const { return &_class_data_; }
 
-void PackE6::MergeFrom(const PackE6& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE6)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.accept() != 0) {
-    set_accept(from.accept());
-  }
-}
 
-void PackE6::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackE6)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void PackE6::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackE6*>(&to_msg);
+  auto& from = static_cast<const PackE6&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE6)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_accept() != 0) {
+    _this->_internal_set_accept(from._internal_accept());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackE6::CopyFrom(const PackE6& from) {
@@ -10530,211 +8103,168 @@ bool PackE6::IsInitialized() const {
   return true;
 }
 
-void PackE6::Swap(PackE6* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackE6::InternalSwap(PackE6* other) {
-  std::swap(accept_, other->accept_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata PackE6::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[31];
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.accept_, other->_impl_.accept_);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackE6
-
-// bool accept = 1;
-void PackE6::clear_accept() {
-  accept_ = false;
-}
-bool PackE6::accept() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE6.accept)
-  return accept_;
+::PROTOBUF_NAMESPACE_ID::Metadata PackE6::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[33]);
 }
-void PackE6::set_accept(bool value) {
-  
-  accept_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE6.accept)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PackE7::kSuccessFieldNumber;
-const int PackE7::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PackE7::_Internal {
+ public:
+};
 
-PackE7::PackE7()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_InitDefaults_BBPacks_2eproto();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:ProtobufPackets.PackE7)
+PackE7::PackE7(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtobufPackets.PackE7)
 }
 PackE7::PackE7(const PackE7& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.msg().size() > 0) {
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-  success_ = from.success_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackE7* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:ProtobufPackets.PackE7)
 }
 
-void PackE7::SharedCtor() {
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-  _cached_size_ = 0;
+inline void PackE7::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PackE7::~PackE7() {
   // @@protoc_insertion_point(destructor:ProtobufPackets.PackE7)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PackE7::SharedDtor() {
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PackE7::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_.Destroy();
 }
 
 void PackE7::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PackE7::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[32].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PackE7& PackE7::default_instance() {
-  protobuf_InitDefaults_BBPacks_2eproto();
-  return *internal_default_instance();
-}
+void PackE7::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE7)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PackE7* PackE7::New(::google::protobuf::Arena* arena) const {
-  PackE7* n = new PackE7;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.msg_.ClearToEmpty();
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PackE7::Clear() {
-// @@protoc_insertion_point(message_clear_start:ProtobufPackets.PackE7)
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
-}
-
-bool PackE7::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:ProtobufPackets.PackE7)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PackE7::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (tag == 8u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string msg = 2;
-      case 2: {
-        if (tag == 18u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "ProtobufPackets.PackE7.msg"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ProtobufPackets.PackE7.msg"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:ProtobufPackets.PackE7)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:ProtobufPackets.PackE7)
-  return false;
-#undef DO_
-}
-
-void PackE7::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:ProtobufPackets.PackE7)
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "ProtobufPackets.PackE7.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->msg(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:ProtobufPackets.PackE7)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PackE7::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PackE7::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ProtobufPackets.PackE7)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "ProtobufPackets.PackE7.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:ProtobufPackets.PackE7)
   return target;
 }
@@ -10743,58 +8273,47 @@ size_t PackE7::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ProtobufPackets.PackE7)
   size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string msg = 2;
-  if (this->msg().size() > 0) {
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PackE7::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ProtobufPackets.PackE7)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PackE7* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PackE7>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ProtobufPackets.PackE7)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ProtobufPackets.PackE7)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackE7::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackE7::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackE7::GetClassData() const { return &_class_data_; }
+
 
-void PackE7::MergeFrom(const PackE7& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE7)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.msg().size() > 0) {
+void PackE7::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackE7*>(&to_msg);
+  auto& from = static_cast<const PackE7&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtobufPackets.PackE7)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void PackE7::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ProtobufPackets.PackE7)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PackE7::CopyFrom(const PackE7& from) {
@@ -10808,86 +8327,168 @@ bool PackE7::IsInitialized() const {
   return true;
 }
 
-void PackE7::Swap(PackE7* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PackE7::InternalSwap(PackE7* other) {
-  msg_.Swap(&other->msg_);
-  std::swap(success_, other->success_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  swap(_impl_.success_, other->_impl_.success_);
 }
 
-::google::protobuf::Metadata PackE7::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  return file_level_metadata[32];
+::PROTOBUF_NAMESPACE_ID::Metadata PackE7::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BBPacks_2eproto_getter, &descriptor_table_BBPacks_2eproto_once,
+      file_level_metadata_BBPacks_2eproto[34]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PackE7
-
-// bool success = 1;
-void PackE7::clear_success() {
-  success_ = false;
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtobufPackets
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackHeaderIn*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackHeaderIn >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackHeaderIn >(arena);
 }
-bool PackE7::success() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE7.success)
-  return success_;
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackHeaderOut*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackHeaderOut >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackHeaderOut >(arena);
 }
-void PackE7::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE7.success)
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackA0*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackA0 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackA0 >(arena);
 }
-
-// string msg = 2;
-void PackE7::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackA1*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackA1 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackA1 >(arena);
 }
-const ::std::string& PackE7::msg() const {
-  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE7.msg)
-  return msg_.GetNoArena();
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackA2*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackA2 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackA2 >(arena);
 }
-void PackE7::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE7.msg)
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackA3*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackA3 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackA3 >(arena);
 }
-void PackE7::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackE7.msg)
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackA4*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackA4 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackA4 >(arena);
 }
-void PackE7::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackE7.msg)
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackA5*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackA5 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackA5 >(arena);
 }
-::std::string* PackE7::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE7.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackA6*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackA6 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackA6 >(arena);
 }
-::std::string* PackE7::release_msg() {
-  // @@protoc_insertion_point(field_release:ProtobufPackets.PackE7.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackA7*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackA7 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackA7 >(arena);
 }
-void PackE7::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackE7.msg)
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackA8*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackA8 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackA8 >(arena);
 }
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace ProtobufPackets
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackA9*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackA9 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackA9 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackB0*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackB0 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackB0 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackB1*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackB1 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackB1 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackB2*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackB2 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackB2 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackB3*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackB3 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackB3 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackB4*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackB4 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackB4 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackB5*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackB5 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackB5 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackC0*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackC0 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackC0 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackC1*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackC1 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackC1 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackC2*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackC2 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackC2 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackC3*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackC3 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackC3 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackD0*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackD0 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackD0 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackD1*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackD1 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackD1 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackD2*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackD2 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackD2 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackD3*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackD3 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackD3 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackD4*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackD4 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackD4 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackE0*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackE0 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackE0 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackE1*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackE1 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackE1 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackE2*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackE2 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackE2 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackE3*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackE3 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackE3 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackE4*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackE4 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackE4 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackE5*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackE5 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackE5 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackE6*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackE6 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackE6 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtobufPackets::PackE7*
+Arena::CreateMaybeMessage< ::ProtobufPackets::PackE7 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtobufPackets::PackE7 >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,1627 +1,3032 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: BBPacks.proto
 
-#ifndef PROTOBUF_BBPacks_2eproto__INCLUDED
-#define PROTOBUF_BBPacks_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_BBPacks_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_BBPacks_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3001000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3001000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_BBPacks_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_BBPacks_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_BBPacks_2eproto;
 namespace ProtobufPackets {
 class PackA0;
-class PackA0DefaultTypeInternal;
+struct PackA0DefaultTypeInternal;
 extern PackA0DefaultTypeInternal _PackA0_default_instance_;
 class PackA1;
-class PackA1DefaultTypeInternal;
+struct PackA1DefaultTypeInternal;
 extern PackA1DefaultTypeInternal _PackA1_default_instance_;
 class PackA2;
-class PackA2DefaultTypeInternal;
+struct PackA2DefaultTypeInternal;
 extern PackA2DefaultTypeInternal _PackA2_default_instance_;
 class PackA3;
-class PackA3DefaultTypeInternal;
+struct PackA3DefaultTypeInternal;
 extern PackA3DefaultTypeInternal _PackA3_default_instance_;
 class PackA4;
-class PackA4DefaultTypeInternal;
+struct PackA4DefaultTypeInternal;
 extern PackA4DefaultTypeInternal _PackA4_default_instance_;
 class PackA5;
-class PackA5DefaultTypeInternal;
+struct PackA5DefaultTypeInternal;
 extern PackA5DefaultTypeInternal _PackA5_default_instance_;
 class PackA6;
-class PackA6DefaultTypeInternal;
+struct PackA6DefaultTypeInternal;
 extern PackA6DefaultTypeInternal _PackA6_default_instance_;
 class PackA7;
-class PackA7DefaultTypeInternal;
+struct PackA7DefaultTypeInternal;
 extern PackA7DefaultTypeInternal _PackA7_default_instance_;
 class PackA8;
-class PackA8DefaultTypeInternal;
+struct PackA8DefaultTypeInternal;
 extern PackA8DefaultTypeInternal _PackA8_default_instance_;
 class PackA9;
-class PackA9DefaultTypeInternal;
+struct PackA9DefaultTypeInternal;
 extern PackA9DefaultTypeInternal _PackA9_default_instance_;
 class PackB0;
-class PackB0DefaultTypeInternal;
+struct PackB0DefaultTypeInternal;
 extern PackB0DefaultTypeInternal _PackB0_default_instance_;
 class PackB1;
-class PackB1DefaultTypeInternal;
+struct PackB1DefaultTypeInternal;
 extern PackB1DefaultTypeInternal _PackB1_default_instance_;
 class PackB2;
-class PackB2DefaultTypeInternal;
+struct PackB2DefaultTypeInternal;
 extern PackB2DefaultTypeInternal _PackB2_default_instance_;
 class PackB3;
-class PackB3DefaultTypeInternal;
+struct PackB3DefaultTypeInternal;
 extern PackB3DefaultTypeInternal _PackB3_default_instance_;
 class PackB4;
-class PackB4DefaultTypeInternal;
+struct PackB4DefaultTypeInternal;
 extern PackB4DefaultTypeInternal _PackB4_default_instance_;
 class PackB5;
-class PackB5DefaultTypeInternal;
+struct PackB5DefaultTypeInternal;
 extern PackB5DefaultTypeInternal _PackB5_default_instance_;
 class PackC0;
-class PackC0DefaultTypeInternal;
+struct PackC0DefaultTypeInternal;
 extern PackC0DefaultTypeInternal _PackC0_default_instance_;
 class PackC1;
-class PackC1DefaultTypeInternal;
+struct PackC1DefaultTypeInternal;
 extern PackC1DefaultTypeInternal _PackC1_default_instance_;
 class PackC2;
-class PackC2DefaultTypeInternal;
+struct PackC2DefaultTypeInternal;
 extern PackC2DefaultTypeInternal _PackC2_default_instance_;
 class PackC3;
-class PackC3DefaultTypeInternal;
+struct PackC3DefaultTypeInternal;
 extern PackC3DefaultTypeInternal _PackC3_default_instance_;
 class PackD0;
-class PackD0DefaultTypeInternal;
+struct PackD0DefaultTypeInternal;
 extern PackD0DefaultTypeInternal _PackD0_default_instance_;
 class PackD1;
-class PackD1DefaultTypeInternal;
+struct PackD1DefaultTypeInternal;
 extern PackD1DefaultTypeInternal _PackD1_default_instance_;
 class PackD2;
-class PackD2DefaultTypeInternal;
+struct PackD2DefaultTypeInternal;
 extern PackD2DefaultTypeInternal _PackD2_default_instance_;
 class PackD3;
-class PackD3DefaultTypeInternal;
+struct PackD3DefaultTypeInternal;
 extern PackD3DefaultTypeInternal _PackD3_default_instance_;
 class PackD4;
-class PackD4DefaultTypeInternal;
+struct PackD4DefaultTypeInternal;
 extern PackD4DefaultTypeInternal _PackD4_default_instance_;
 class PackE0;
-class PackE0DefaultTypeInternal;
+struct PackE0DefaultTypeInternal;
 extern PackE0DefaultTypeInternal _PackE0_default_instance_;
 class PackE1;
-class PackE1DefaultTypeInternal;
+struct PackE1DefaultTypeInternal;
 extern PackE1DefaultTypeInternal _PackE1_default_instance_;
 class PackE2;
-class PackE2DefaultTypeInternal;
+struct PackE2DefaultTypeInternal;
 extern PackE2DefaultTypeInternal _PackE2_default_instance_;
 class PackE3;
-class PackE3DefaultTypeInternal;
+struct PackE3DefaultTypeInternal;
 extern PackE3DefaultTypeInternal _PackE3_default_instance_;
 class PackE4;
-class PackE4DefaultTypeInternal;
+struct PackE4DefaultTypeInternal;
 extern PackE4DefaultTypeInternal _PackE4_default_instance_;
 class PackE5;
-class PackE5DefaultTypeInternal;
+struct PackE5DefaultTypeInternal;
 extern PackE5DefaultTypeInternal _PackE5_default_instance_;
 class PackE6;
-class PackE6DefaultTypeInternal;
+struct PackE6DefaultTypeInternal;
 extern PackE6DefaultTypeInternal _PackE6_default_instance_;
 class PackE7;
-class PackE7DefaultTypeInternal;
+struct PackE7DefaultTypeInternal;
 extern PackE7DefaultTypeInternal _PackE7_default_instance_;
+class PackHeaderIn;
+struct PackHeaderInDefaultTypeInternal;
+extern PackHeaderInDefaultTypeInternal _PackHeaderIn_default_instance_;
+class PackHeaderOut;
+struct PackHeaderOutDefaultTypeInternal;
+extern PackHeaderOutDefaultTypeInternal _PackHeaderOut_default_instance_;
 }  // namespace ProtobufPackets
-
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ProtobufPackets::PackA0* Arena::CreateMaybeMessage<::ProtobufPackets::PackA0>(Arena*);
+template<> ::ProtobufPackets::PackA1* Arena::CreateMaybeMessage<::ProtobufPackets::PackA1>(Arena*);
+template<> ::ProtobufPackets::PackA2* Arena::CreateMaybeMessage<::ProtobufPackets::PackA2>(Arena*);
+template<> ::ProtobufPackets::PackA3* Arena::CreateMaybeMessage<::ProtobufPackets::PackA3>(Arena*);
+template<> ::ProtobufPackets::PackA4* Arena::CreateMaybeMessage<::ProtobufPackets::PackA4>(Arena*);
+template<> ::ProtobufPackets::PackA5* Arena::CreateMaybeMessage<::ProtobufPackets::PackA5>(Arena*);
+template<> ::ProtobufPackets::PackA6* Arena::CreateMaybeMessage<::ProtobufPackets::PackA6>(Arena*);
+template<> ::ProtobufPackets::PackA7* Arena::CreateMaybeMessage<::ProtobufPackets::PackA7>(Arena*);
+template<> ::ProtobufPackets::PackA8* Arena::CreateMaybeMessage<::ProtobufPackets::PackA8>(Arena*);
+template<> ::ProtobufPackets::PackA9* Arena::CreateMaybeMessage<::ProtobufPackets::PackA9>(Arena*);
+template<> ::ProtobufPackets::PackB0* Arena::CreateMaybeMessage<::ProtobufPackets::PackB0>(Arena*);
+template<> ::ProtobufPackets::PackB1* Arena::CreateMaybeMessage<::ProtobufPackets::PackB1>(Arena*);
+template<> ::ProtobufPackets::PackB2* Arena::CreateMaybeMessage<::ProtobufPackets::PackB2>(Arena*);
+template<> ::ProtobufPackets::PackB3* Arena::CreateMaybeMessage<::ProtobufPackets::PackB3>(Arena*);
+template<> ::ProtobufPackets::PackB4* Arena::CreateMaybeMessage<::ProtobufPackets::PackB4>(Arena*);
+template<> ::ProtobufPackets::PackB5* Arena::CreateMaybeMessage<::ProtobufPackets::PackB5>(Arena*);
+template<> ::ProtobufPackets::PackC0* Arena::CreateMaybeMessage<::ProtobufPackets::PackC0>(Arena*);
+template<> ::ProtobufPackets::PackC1* Arena::CreateMaybeMessage<::ProtobufPackets::PackC1>(Arena*);
+template<> ::ProtobufPackets::PackC2* Arena::CreateMaybeMessage<::ProtobufPackets::PackC2>(Arena*);
+template<> ::ProtobufPackets::PackC3* Arena::CreateMaybeMessage<::ProtobufPackets::PackC3>(Arena*);
+template<> ::ProtobufPackets::PackD0* Arena::CreateMaybeMessage<::ProtobufPackets::PackD0>(Arena*);
+template<> ::ProtobufPackets::PackD1* Arena::CreateMaybeMessage<::ProtobufPackets::PackD1>(Arena*);
+template<> ::ProtobufPackets::PackD2* Arena::CreateMaybeMessage<::ProtobufPackets::PackD2>(Arena*);
+template<> ::ProtobufPackets::PackD3* Arena::CreateMaybeMessage<::ProtobufPackets::PackD3>(Arena*);
+template<> ::ProtobufPackets::PackD4* Arena::CreateMaybeMessage<::ProtobufPackets::PackD4>(Arena*);
+template<> ::ProtobufPackets::PackE0* Arena::CreateMaybeMessage<::ProtobufPackets::PackE0>(Arena*);
+template<> ::ProtobufPackets::PackE1* Arena::CreateMaybeMessage<::ProtobufPackets::PackE1>(Arena*);
+template<> ::ProtobufPackets::PackE2* Arena::CreateMaybeMessage<::ProtobufPackets::PackE2>(Arena*);
+template<> ::ProtobufPackets::PackE3* Arena::CreateMaybeMessage<::ProtobufPackets::PackE3>(Arena*);
+template<> ::ProtobufPackets::PackE4* Arena::CreateMaybeMessage<::ProtobufPackets::PackE4>(Arena*);
+template<> ::ProtobufPackets::PackE5* Arena::CreateMaybeMessage<::ProtobufPackets::PackE5>(Arena*);
+template<> ::ProtobufPackets::PackE6* Arena::CreateMaybeMessage<::ProtobufPackets::PackE6>(Arena*);
+template<> ::ProtobufPackets::PackE7* Arena::CreateMaybeMessage<::ProtobufPackets::PackE7>(Arena*);
+template<> ::ProtobufPackets::PackHeaderIn* Arena::CreateMaybeMessage<::ProtobufPackets::PackHeaderIn>(Arena*);
+template<> ::ProtobufPackets::PackHeaderOut* Arena::CreateMaybeMessage<::ProtobufPackets::PackHeaderOut>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace ProtobufPackets {
 
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_BBPacks_2eproto();
-void protobuf_InitDefaults_BBPacks_2eproto();
-
 // ===================================================================
 
-class PackA0 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA0) */ {
+class PackHeaderIn final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackHeaderIn) */ {
  public:
-  PackA0();
-  virtual ~PackA0();
+  inline PackHeaderIn() : PackHeaderIn(nullptr) {}
+  ~PackHeaderIn() override;
+  explicit PROTOBUF_CONSTEXPR PackHeaderIn(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PackHeaderIn(const PackHeaderIn& from);
+  PackHeaderIn(PackHeaderIn&& from) noexcept
+    : PackHeaderIn() {
+    *this = ::std::move(from);
+  }
+
+  inline PackHeaderIn& operator=(const PackHeaderIn& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PackHeaderIn& operator=(PackHeaderIn&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackHeaderIn& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PackHeaderIn* internal_default_instance() {
+    return reinterpret_cast<const PackHeaderIn*>(
+               &_PackHeaderIn_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PackHeaderIn& a, PackHeaderIn& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackHeaderIn* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackHeaderIn* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PackHeaderIn* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackHeaderIn>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PackHeaderIn& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackHeaderIn& from) {
+    PackHeaderIn::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PackHeaderIn* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackHeaderIn";
+  }
+  protected:
+  explicit PackHeaderIn(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSendToIDsFieldNumber = 3,
+    kLocKeyFieldNumber = 2,
+    kServerReadFieldNumber = 1,
+    kDataSizeFieldNumber = 4,
+  };
+  // repeated uint32 sendToIDs = 3;
+  int sendtoids_size() const;
+  private:
+  int _internal_sendtoids_size() const;
+  public:
+  void clear_sendtoids();
+  private:
+  uint32_t _internal_sendtoids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_sendtoids() const;
+  void _internal_add_sendtoids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_sendtoids();
+  public:
+  uint32_t sendtoids(int index) const;
+  void set_sendtoids(int index, uint32_t value);
+  void add_sendtoids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      sendtoids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_sendtoids();
+
+  // string locKey = 2;
+  void clear_lockey();
+  const std::string& lockey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_lockey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_lockey();
+  PROTOBUF_NODISCARD std::string* release_lockey();
+  void set_allocated_lockey(std::string* lockey);
+  private:
+  const std::string& _internal_lockey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_lockey(const std::string& value);
+  std::string* _internal_mutable_lockey();
+  public:
+
+  // bool serverRead = 1;
+  void clear_serverread();
+  bool serverread() const;
+  void set_serverread(bool value);
+  private:
+  bool _internal_serverread() const;
+  void _internal_set_serverread(bool value);
+  public:
+
+  // uint32 dataSize = 4;
+  void clear_datasize();
+  uint32_t datasize() const;
+  void set_datasize(uint32_t value);
+  private:
+  uint32_t _internal_datasize() const;
+  void _internal_set_datasize(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ProtobufPackets.PackHeaderIn)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > sendtoids_;
+    mutable std::atomic<int> _sendtoids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr lockey_;
+    bool serverread_;
+    uint32_t datasize_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PackHeaderOut final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackHeaderOut) */ {
+ public:
+  inline PackHeaderOut() : PackHeaderOut(nullptr) {}
+  ~PackHeaderOut() override;
+  explicit PROTOBUF_CONSTEXPR PackHeaderOut(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PackHeaderOut(const PackHeaderOut& from);
+  PackHeaderOut(PackHeaderOut&& from) noexcept
+    : PackHeaderOut() {
+    *this = ::std::move(from);
+  }
+
+  inline PackHeaderOut& operator=(const PackHeaderOut& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PackHeaderOut& operator=(PackHeaderOut&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackHeaderOut& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PackHeaderOut* internal_default_instance() {
+    return reinterpret_cast<const PackHeaderOut*>(
+               &_PackHeaderOut_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(PackHeaderOut& a, PackHeaderOut& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackHeaderOut* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackHeaderOut* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PackHeaderOut* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackHeaderOut>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PackHeaderOut& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackHeaderOut& from) {
+    PackHeaderOut::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PackHeaderOut* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackHeaderOut";
+  }
+  protected:
+  explicit PackHeaderOut(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLocKeyFieldNumber = 1,
+    kSentFromIDFieldNumber = 2,
+    kDataSizeFieldNumber = 3,
+  };
+  // string locKey = 1;
+  void clear_lockey();
+  const std::string& lockey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_lockey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_lockey();
+  PROTOBUF_NODISCARD std::string* release_lockey();
+  void set_allocated_lockey(std::string* lockey);
+  private:
+  const std::string& _internal_lockey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_lockey(const std::string& value);
+  std::string* _internal_mutable_lockey();
+  public:
+
+  // uint32 sentFromID = 2;
+  void clear_sentfromid();
+  uint32_t sentfromid() const;
+  void set_sentfromid(uint32_t value);
+  private:
+  uint32_t _internal_sentfromid() const;
+  void _internal_set_sentfromid(uint32_t value);
+  public:
+
+  // uint32 dataSize = 3;
+  void clear_datasize();
+  uint32_t datasize() const;
+  void set_datasize(uint32_t value);
+  private:
+  uint32_t _internal_datasize() const;
+  void _internal_set_datasize(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ProtobufPackets.PackHeaderOut)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr lockey_;
+    uint32_t sentfromid_;
+    uint32_t datasize_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PackA0 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA0) */ {
+ public:
+  inline PackA0() : PackA0(nullptr) {}
+  ~PackA0() override;
+  explicit PROTOBUF_CONSTEXPR PackA0(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackA0(const PackA0& from);
+  PackA0(PackA0&& from) noexcept
+    : PackA0() {
+    *this = ::std::move(from);
+  }
 
   inline PackA0& operator=(const PackA0& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackA0& operator=(PackA0&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackA0& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackA0& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackA0* internal_default_instance() {
     return reinterpret_cast<const PackA0*>(
                &_PackA0_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(PackA0* other);
+  friend void swap(PackA0& a, PackA0& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackA0* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackA0* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackA0* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackA0* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackA0* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackA0>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackA0& from);
-  void MergeFrom(const PackA0& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackA0& from) {
+    PackA0::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackA0* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackA0";
   }
+  protected:
+  explicit PackA0(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kPwdFieldNumber = 2,
+    kEmailFieldNumber = 3,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // string pwd = 2;
   void clear_pwd();
-  static const int kPwdFieldNumber = 2;
-  const ::std::string& pwd() const;
-  void set_pwd(const ::std::string& value);
-  void set_pwd(const char* value);
-  void set_pwd(const char* value, size_t size);
-  ::std::string* mutable_pwd();
-  ::std::string* release_pwd();
-  void set_allocated_pwd(::std::string* pwd);
+  const std::string& pwd() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwd(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pwd();
+  PROTOBUF_NODISCARD std::string* release_pwd();
+  void set_allocated_pwd(std::string* pwd);
+  private:
+  const std::string& _internal_pwd() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwd(const std::string& value);
+  std::string* _internal_mutable_pwd();
+  public:
 
   // string email = 3;
   void clear_email();
-  static const int kEmailFieldNumber = 3;
-  const ::std::string& email() const;
-  void set_email(const ::std::string& value);
-  void set_email(const char* value);
-  void set_email(const char* value, size_t size);
-  ::std::string* mutable_email();
-  ::std::string* release_email();
-  void set_allocated_email(::std::string* email);
+  const std::string& email() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_email(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_email();
+  PROTOBUF_NODISCARD std::string* release_email();
+  void set_allocated_email(std::string* email);
+  private:
+  const std::string& _internal_email() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_email(const std::string& value);
+  std::string* _internal_mutable_email();
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackA0)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::internal::ArenaStringPtr pwd_;
-  ::google::protobuf::internal::ArenaStringPtr email_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackA1 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA1) */ {
+class PackA1 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA1) */ {
  public:
-  PackA1();
-  virtual ~PackA1();
+  inline PackA1() : PackA1(nullptr) {}
+  ~PackA1() override;
+  explicit PROTOBUF_CONSTEXPR PackA1(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackA1(const PackA1& from);
+  PackA1(PackA1&& from) noexcept
+    : PackA1() {
+    *this = ::std::move(from);
+  }
 
   inline PackA1& operator=(const PackA1& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackA1& operator=(PackA1&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackA1& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackA1& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackA1* internal_default_instance() {
     return reinterpret_cast<const PackA1*>(
                &_PackA1_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(PackA1* other);
+  friend void swap(PackA1& a, PackA1& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackA1* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackA1* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackA1* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackA1* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackA1* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackA1>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackA1& from);
-  void MergeFrom(const PackA1& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackA1& from) {
+    PackA1::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackA1* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackA1";
   }
+  protected:
+  explicit PackA1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPwdTokenFieldNumber = 1,
+    kMsgFieldNumber = 4,
+    kEIDFieldNumber = 2,
+    kDeviceIDFieldNumber = 3,
+  };
   // string pwdToken = 1;
   void clear_pwdtoken();
-  static const int kPwdTokenFieldNumber = 1;
-  const ::std::string& pwdtoken() const;
-  void set_pwdtoken(const ::std::string& value);
-  void set_pwdtoken(const char* value);
-  void set_pwdtoken(const char* value, size_t size);
-  ::std::string* mutable_pwdtoken();
-  ::std::string* release_pwdtoken();
-  void set_allocated_pwdtoken(::std::string* pwdtoken);
+  const std::string& pwdtoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwdtoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pwdtoken();
+  PROTOBUF_NODISCARD std::string* release_pwdtoken();
+  void set_allocated_pwdtoken(std::string* pwdtoken);
+  private:
+  const std::string& _internal_pwdtoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwdtoken(const std::string& value);
+  std::string* _internal_mutable_pwdtoken();
+  public:
+
+  // string msg = 4;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
 
   // uint32 eID = 2;
   void clear_eid();
-  static const int kEIDFieldNumber = 2;
-  ::google::protobuf::uint32 eid() const;
-  void set_eid(::google::protobuf::uint32 value);
+  uint32_t eid() const;
+  void set_eid(uint32_t value);
+  private:
+  uint32_t _internal_eid() const;
+  void _internal_set_eid(uint32_t value);
+  public:
 
   // uint32 deviceID = 3;
   void clear_deviceid();
-  static const int kDeviceIDFieldNumber = 3;
-  ::google::protobuf::uint32 deviceid() const;
-  void set_deviceid(::google::protobuf::uint32 value);
-
-  // string msg = 4;
-  void clear_msg();
-  static const int kMsgFieldNumber = 4;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  uint32_t deviceid() const;
+  void set_deviceid(uint32_t value);
+  private:
+  uint32_t _internal_deviceid() const;
+  void _internal_set_deviceid(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackA1)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr pwdtoken_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  ::google::protobuf::uint32 eid_;
-  ::google::protobuf::uint32 deviceid_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwdtoken_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    uint32_t eid_;
+    uint32_t deviceid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackA2 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA2) */ {
+class PackA2 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA2) */ {
  public:
-  PackA2();
-  virtual ~PackA2();
+  inline PackA2() : PackA2(nullptr) {}
+  ~PackA2() override;
+  explicit PROTOBUF_CONSTEXPR PackA2(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackA2(const PackA2& from);
+  PackA2(PackA2&& from) noexcept
+    : PackA2() {
+    *this = ::std::move(from);
+  }
 
   inline PackA2& operator=(const PackA2& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackA2& operator=(PackA2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackA2& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackA2& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackA2* internal_default_instance() {
     return reinterpret_cast<const PackA2*>(
                &_PackA2_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(PackA2* other);
+  friend void swap(PackA2& a, PackA2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackA2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackA2* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackA2* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackA2* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackA2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackA2>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackA2& from);
-  void MergeFrom(const PackA2& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackA2& from) {
+    PackA2::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackA2* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackA2";
   }
+  protected:
+  explicit PackA2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // uint32 eID = 1;
-  void clear_eid();
-  static const int kEIDFieldNumber = 1;
-  ::google::protobuf::uint32 eid() const;
-  void set_eid(::google::protobuf::uint32 value);
-
+  enum : int {
+    kPwdTokenFieldNumber = 2,
+    kEIDFieldNumber = 1,
+    kDeviceIDFieldNumber = 3,
+  };
   // string pwdToken = 2;
   void clear_pwdtoken();
-  static const int kPwdTokenFieldNumber = 2;
-  const ::std::string& pwdtoken() const;
-  void set_pwdtoken(const ::std::string& value);
-  void set_pwdtoken(const char* value);
-  void set_pwdtoken(const char* value, size_t size);
-  ::std::string* mutable_pwdtoken();
-  ::std::string* release_pwdtoken();
-  void set_allocated_pwdtoken(::std::string* pwdtoken);
+  const std::string& pwdtoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwdtoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pwdtoken();
+  PROTOBUF_NODISCARD std::string* release_pwdtoken();
+  void set_allocated_pwdtoken(std::string* pwdtoken);
+  private:
+  const std::string& _internal_pwdtoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwdtoken(const std::string& value);
+  std::string* _internal_mutable_pwdtoken();
+  public:
+
+  // uint32 eID = 1;
+  void clear_eid();
+  uint32_t eid() const;
+  void set_eid(uint32_t value);
+  private:
+  uint32_t _internal_eid() const;
+  void _internal_set_eid(uint32_t value);
+  public:
 
   // int32 deviceID = 3;
   void clear_deviceid();
-  static const int kDeviceIDFieldNumber = 3;
-  ::google::protobuf::int32 deviceid() const;
-  void set_deviceid(::google::protobuf::int32 value);
+  int32_t deviceid() const;
+  void set_deviceid(int32_t value);
+  private:
+  int32_t _internal_deviceid() const;
+  void _internal_set_deviceid(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackA2)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr pwdtoken_;
-  ::google::protobuf::uint32 eid_;
-  ::google::protobuf::int32 deviceid_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwdtoken_;
+    uint32_t eid_;
+    int32_t deviceid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackA3 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA3) */ {
+class PackA3 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA3) */ {
  public:
-  PackA3();
-  virtual ~PackA3();
+  inline PackA3() : PackA3(nullptr) {}
+  ~PackA3() override;
+  explicit PROTOBUF_CONSTEXPR PackA3(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackA3(const PackA3& from);
+  PackA3(PackA3&& from) noexcept
+    : PackA3() {
+    *this = ::std::move(from);
+  }
 
   inline PackA3& operator=(const PackA3& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackA3& operator=(PackA3&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackA3& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackA3& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackA3* internal_default_instance() {
     return reinterpret_cast<const PackA3*>(
                &_PackA3_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(PackA3* other);
+  friend void swap(PackA3& a, PackA3& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackA3* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackA3* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackA3* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackA3* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackA3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackA3>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackA3& from);
-  void MergeFrom(const PackA3& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackA3& from) {
+    PackA3::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackA3* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackA3";
   }
+  protected:
+  explicit PackA3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kPwdFieldNumber = 2,
+    kDeviceIDFieldNumber = 3,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // string pwd = 2;
   void clear_pwd();
-  static const int kPwdFieldNumber = 2;
-  const ::std::string& pwd() const;
-  void set_pwd(const ::std::string& value);
-  void set_pwd(const char* value);
-  void set_pwd(const char* value, size_t size);
-  ::std::string* mutable_pwd();
-  ::std::string* release_pwd();
-  void set_allocated_pwd(::std::string* pwd);
+  const std::string& pwd() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwd(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pwd();
+  PROTOBUF_NODISCARD std::string* release_pwd();
+  void set_allocated_pwd(std::string* pwd);
+  private:
+  const std::string& _internal_pwd() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwd(const std::string& value);
+  std::string* _internal_mutable_pwd();
+  public:
 
   // uint32 deviceID = 3;
   void clear_deviceid();
-  static const int kDeviceIDFieldNumber = 3;
-  ::google::protobuf::uint32 deviceid() const;
-  void set_deviceid(::google::protobuf::uint32 value);
+  uint32_t deviceid() const;
+  void set_deviceid(uint32_t value);
+  private:
+  uint32_t _internal_deviceid() const;
+  void _internal_set_deviceid(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackA3)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::internal::ArenaStringPtr pwd_;
-  ::google::protobuf::uint32 deviceid_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+    uint32_t deviceid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackA4 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA4) */ {
+class PackA4 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA4) */ {
  public:
-  PackA4();
-  virtual ~PackA4();
+  inline PackA4() : PackA4(nullptr) {}
+  ~PackA4() override;
+  explicit PROTOBUF_CONSTEXPR PackA4(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackA4(const PackA4& from);
+  PackA4(PackA4&& from) noexcept
+    : PackA4() {
+    *this = ::std::move(from);
+  }
 
   inline PackA4& operator=(const PackA4& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackA4& operator=(PackA4&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackA4& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackA4& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackA4* internal_default_instance() {
     return reinterpret_cast<const PackA4*>(
                &_PackA4_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(PackA4* other);
+  friend void swap(PackA4& a, PackA4& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackA4* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackA4* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackA4* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackA4* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackA4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackA4>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackA4& from);
-  void MergeFrom(const PackA4& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackA4& from) {
+    PackA4::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackA4* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackA4";
   }
+  protected:
+  explicit PackA4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kEmailFieldNumber = 1,
+  };
   // string email = 1;
   void clear_email();
-  static const int kEmailFieldNumber = 1;
-  const ::std::string& email() const;
-  void set_email(const ::std::string& value);
-  void set_email(const char* value);
-  void set_email(const char* value, size_t size);
-  ::std::string* mutable_email();
-  ::std::string* release_email();
-  void set_allocated_email(::std::string* email);
+  const std::string& email() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_email(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_email();
+  PROTOBUF_NODISCARD std::string* release_email();
+  void set_allocated_email(std::string* email);
+  private:
+  const std::string& _internal_email() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_email(const std::string& value);
+  std::string* _internal_mutable_email();
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackA4)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr email_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackA5 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA5) */ {
+class PackA5 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA5) */ {
  public:
-  PackA5();
-  virtual ~PackA5();
+  inline PackA5() : PackA5(nullptr) {}
+  ~PackA5() override;
+  explicit PROTOBUF_CONSTEXPR PackA5(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackA5(const PackA5& from);
+  PackA5(PackA5&& from) noexcept
+    : PackA5() {
+    *this = ::std::move(from);
+  }
 
   inline PackA5& operator=(const PackA5& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackA5& operator=(PackA5&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackA5& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackA5& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackA5* internal_default_instance() {
     return reinterpret_cast<const PackA5*>(
                &_PackA5_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(PackA5* other);
+  friend void swap(PackA5& a, PackA5& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackA5* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackA5* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackA5* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackA5* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackA5* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackA5>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackA5& from);
-  void MergeFrom(const PackA5& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackA5& from) {
+    PackA5::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackA5* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackA5";
   }
+  protected:
+  explicit PackA5(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMsgFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string msg = 2;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
-
-  // string msg = 2;
-  void clear_msg();
-  static const int kMsgFieldNumber = 2;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackA5)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  bool success_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackA6 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA6) */ {
+class PackA6 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA6) */ {
  public:
-  PackA6();
-  virtual ~PackA6();
+  inline PackA6() : PackA6(nullptr) {}
+  ~PackA6() override;
+  explicit PROTOBUF_CONSTEXPR PackA6(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackA6(const PackA6& from);
+  PackA6(PackA6&& from) noexcept
+    : PackA6() {
+    *this = ::std::move(from);
+  }
 
   inline PackA6& operator=(const PackA6& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackA6& operator=(PackA6&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackA6& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackA6& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackA6* internal_default_instance() {
     return reinterpret_cast<const PackA6*>(
                &_PackA6_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(PackA6* other);
+  friend void swap(PackA6& a, PackA6& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackA6* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackA6* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackA6* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackA6* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackA6* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackA6>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackA6& from);
-  void MergeFrom(const PackA6& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackA6& from) {
+    PackA6::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackA6* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackA6";
   }
+  protected:
+  explicit PackA6(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPwdResetTokenFieldNumber = 1,
+  };
   // string pwdResetToken = 1;
   void clear_pwdresettoken();
-  static const int kPwdResetTokenFieldNumber = 1;
-  const ::std::string& pwdresettoken() const;
-  void set_pwdresettoken(const ::std::string& value);
-  void set_pwdresettoken(const char* value);
-  void set_pwdresettoken(const char* value, size_t size);
-  ::std::string* mutable_pwdresettoken();
-  ::std::string* release_pwdresettoken();
-  void set_allocated_pwdresettoken(::std::string* pwdresettoken);
+  const std::string& pwdresettoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwdresettoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pwdresettoken();
+  PROTOBUF_NODISCARD std::string* release_pwdresettoken();
+  void set_allocated_pwdresettoken(std::string* pwdresettoken);
+  private:
+  const std::string& _internal_pwdresettoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwdresettoken(const std::string& value);
+  std::string* _internal_mutable_pwdresettoken();
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackA6)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr pwdresettoken_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwdresettoken_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackA7 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA7) */ {
+class PackA7 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA7) */ {
  public:
-  PackA7();
-  virtual ~PackA7();
+  inline PackA7() : PackA7(nullptr) {}
+  ~PackA7() override;
+  explicit PROTOBUF_CONSTEXPR PackA7(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackA7(const PackA7& from);
+  PackA7(PackA7&& from) noexcept
+    : PackA7() {
+    *this = ::std::move(from);
+  }
 
   inline PackA7& operator=(const PackA7& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackA7& operator=(PackA7&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackA7& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackA7& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackA7* internal_default_instance() {
     return reinterpret_cast<const PackA7*>(
                &_PackA7_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  void Swap(PackA7* other);
+  friend void swap(PackA7& a, PackA7& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackA7* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackA7* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackA7* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackA7* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackA7* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackA7>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackA7& from);
-  void MergeFrom(const PackA7& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackA7& from) {
+    PackA7::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackA7* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackA7";
   }
+  protected:
+  explicit PackA7(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMsgFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string msg = 2;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
-
-  // string msg = 2;
-  void clear_msg();
-  static const int kMsgFieldNumber = 2;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackA7)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  bool success_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackA8 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA8) */ {
+class PackA8 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA8) */ {
  public:
-  PackA8();
-  virtual ~PackA8();
+  inline PackA8() : PackA8(nullptr) {}
+  ~PackA8() override;
+  explicit PROTOBUF_CONSTEXPR PackA8(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackA8(const PackA8& from);
+  PackA8(PackA8&& from) noexcept
+    : PackA8() {
+    *this = ::std::move(from);
+  }
 
   inline PackA8& operator=(const PackA8& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackA8& operator=(PackA8&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackA8& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackA8& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackA8* internal_default_instance() {
     return reinterpret_cast<const PackA8*>(
                &_PackA8_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    10;
 
-  void Swap(PackA8* other);
+  friend void swap(PackA8& a, PackA8& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackA8* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackA8* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackA8* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackA8* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackA8* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackA8>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackA8& from);
-  void MergeFrom(const PackA8& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackA8& from) {
+    PackA8::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackA8* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackA8";
   }
+  protected:
+  explicit PackA8(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPwdResetTokenFieldNumber = 1,
+    kPwdFieldNumber = 2,
+  };
   // string pwdResetToken = 1;
   void clear_pwdresettoken();
-  static const int kPwdResetTokenFieldNumber = 1;
-  const ::std::string& pwdresettoken() const;
-  void set_pwdresettoken(const ::std::string& value);
-  void set_pwdresettoken(const char* value);
-  void set_pwdresettoken(const char* value, size_t size);
-  ::std::string* mutable_pwdresettoken();
-  ::std::string* release_pwdresettoken();
-  void set_allocated_pwdresettoken(::std::string* pwdresettoken);
+  const std::string& pwdresettoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwdresettoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pwdresettoken();
+  PROTOBUF_NODISCARD std::string* release_pwdresettoken();
+  void set_allocated_pwdresettoken(std::string* pwdresettoken);
+  private:
+  const std::string& _internal_pwdresettoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwdresettoken(const std::string& value);
+  std::string* _internal_mutable_pwdresettoken();
+  public:
 
   // string pwd = 2;
   void clear_pwd();
-  static const int kPwdFieldNumber = 2;
-  const ::std::string& pwd() const;
-  void set_pwd(const ::std::string& value);
-  void set_pwd(const char* value);
-  void set_pwd(const char* value, size_t size);
-  ::std::string* mutable_pwd();
-  ::std::string* release_pwd();
-  void set_allocated_pwd(::std::string* pwd);
+  const std::string& pwd() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwd(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pwd();
+  PROTOBUF_NODISCARD std::string* release_pwd();
+  void set_allocated_pwd(std::string* pwd);
+  private:
+  const std::string& _internal_pwd() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwd(const std::string& value);
+  std::string* _internal_mutable_pwd();
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackA8)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr pwdresettoken_;
-  ::google::protobuf::internal::ArenaStringPtr pwd_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwdresettoken_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackA9 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA9) */ {
+class PackA9 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackA9) */ {
  public:
-  PackA9();
-  virtual ~PackA9();
+  inline PackA9() : PackA9(nullptr) {}
+  ~PackA9() override;
+  explicit PROTOBUF_CONSTEXPR PackA9(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackA9(const PackA9& from);
+  PackA9(PackA9&& from) noexcept
+    : PackA9() {
+    *this = ::std::move(from);
+  }
 
   inline PackA9& operator=(const PackA9& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackA9& operator=(PackA9&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackA9& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackA9& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackA9* internal_default_instance() {
     return reinterpret_cast<const PackA9*>(
                &_PackA9_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    11;
 
-  void Swap(PackA9* other);
+  friend void swap(PackA9& a, PackA9& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackA9* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackA9* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackA9* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackA9* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackA9* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackA9>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackA9& from);
-  void MergeFrom(const PackA9& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackA9& from) {
+    PackA9::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackA9* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackA9";
   }
+  protected:
+  explicit PackA9(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPwdTokenFieldNumber = 1,
+    kMsgFieldNumber = 4,
+    kEIDFieldNumber = 2,
+    kDeviceIDFieldNumber = 3,
+  };
   // string pwdToken = 1;
   void clear_pwdtoken();
-  static const int kPwdTokenFieldNumber = 1;
-  const ::std::string& pwdtoken() const;
-  void set_pwdtoken(const ::std::string& value);
-  void set_pwdtoken(const char* value);
-  void set_pwdtoken(const char* value, size_t size);
-  ::std::string* mutable_pwdtoken();
-  ::std::string* release_pwdtoken();
-  void set_allocated_pwdtoken(::std::string* pwdtoken);
+  const std::string& pwdtoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwdtoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pwdtoken();
+  PROTOBUF_NODISCARD std::string* release_pwdtoken();
+  void set_allocated_pwdtoken(std::string* pwdtoken);
+  private:
+  const std::string& _internal_pwdtoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwdtoken(const std::string& value);
+  std::string* _internal_mutable_pwdtoken();
+  public:
+
+  // string msg = 4;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
 
   // uint32 eID = 2;
   void clear_eid();
-  static const int kEIDFieldNumber = 2;
-  ::google::protobuf::uint32 eid() const;
-  void set_eid(::google::protobuf::uint32 value);
+  uint32_t eid() const;
+  void set_eid(uint32_t value);
+  private:
+  uint32_t _internal_eid() const;
+  void _internal_set_eid(uint32_t value);
+  public:
 
   // uint32 deviceID = 3;
   void clear_deviceid();
-  static const int kDeviceIDFieldNumber = 3;
-  ::google::protobuf::uint32 deviceid() const;
-  void set_deviceid(::google::protobuf::uint32 value);
-
-  // string msg = 4;
-  void clear_msg();
-  static const int kMsgFieldNumber = 4;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  uint32_t deviceid() const;
+  void set_deviceid(uint32_t value);
+  private:
+  uint32_t _internal_deviceid() const;
+  void _internal_set_deviceid(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackA9)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr pwdtoken_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  ::google::protobuf::uint32 eid_;
-  ::google::protobuf::uint32 deviceid_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwdtoken_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    uint32_t eid_;
+    uint32_t deviceid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackB0 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB0) */ {
+class PackB0 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB0) */ {
  public:
-  PackB0();
-  virtual ~PackB0();
+  inline PackB0() : PackB0(nullptr) {}
+  ~PackB0() override;
+  explicit PROTOBUF_CONSTEXPR PackB0(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackB0(const PackB0& from);
+  PackB0(PackB0&& from) noexcept
+    : PackB0() {
+    *this = ::std::move(from);
+  }
 
   inline PackB0& operator=(const PackB0& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackB0& operator=(PackB0&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackB0& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackB0& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackB0* internal_default_instance() {
     return reinterpret_cast<const PackB0*>(
                &_PackB0_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    12;
 
-  void Swap(PackB0* other);
+  friend void swap(PackB0& a, PackB0& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackB0* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackB0* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackB0* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackB0* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackB0* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackB0>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackB0& from);
-  void MergeFrom(const PackB0& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackB0& from) {
+    PackB0::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackB0* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackB0";
   }
+  protected:
+  explicit PackB0(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kEmailFieldNumber = 1,
+  };
   // string email = 1;
   void clear_email();
-  static const int kEmailFieldNumber = 1;
-  const ::std::string& email() const;
-  void set_email(const ::std::string& value);
-  void set_email(const char* value);
-  void set_email(const char* value, size_t size);
-  ::std::string* mutable_email();
-  ::std::string* release_email();
-  void set_allocated_email(::std::string* email);
+  const std::string& email() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_email(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_email();
+  PROTOBUF_NODISCARD std::string* release_email();
+  void set_allocated_email(std::string* email);
+  private:
+  const std::string& _internal_email() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_email(const std::string& value);
+  std::string* _internal_mutable_email();
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackB0)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr email_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackB1 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB1) */ {
+class PackB1 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB1) */ {
  public:
-  PackB1();
-  virtual ~PackB1();
+  inline PackB1() : PackB1(nullptr) {}
+  ~PackB1() override;
+  explicit PROTOBUF_CONSTEXPR PackB1(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackB1(const PackB1& from);
+  PackB1(PackB1&& from) noexcept
+    : PackB1() {
+    *this = ::std::move(from);
+  }
 
   inline PackB1& operator=(const PackB1& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackB1& operator=(PackB1&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackB1& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackB1& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackB1* internal_default_instance() {
     return reinterpret_cast<const PackB1*>(
                &_PackB1_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    13;
 
-  void Swap(PackB1* other);
+  friend void swap(PackB1& a, PackB1& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackB1* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackB1* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackB1* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackB1* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackB1* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackB1>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackB1& from);
-  void MergeFrom(const PackB1& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackB1& from) {
+    PackB1::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackB1* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackB1";
   }
+  protected:
+  explicit PackB1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMsgFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string msg = 2;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
-
-  // string msg = 2;
-  void clear_msg();
-  static const int kMsgFieldNumber = 2;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackB1)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  bool success_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackB2 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB2) */ {
+class PackB2 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB2) */ {
  public:
-  PackB2();
-  virtual ~PackB2();
+  inline PackB2() : PackB2(nullptr) {}
+  ~PackB2() override;
+  explicit PROTOBUF_CONSTEXPR PackB2(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackB2(const PackB2& from);
+  PackB2(PackB2&& from) noexcept
+    : PackB2() {
+    *this = ::std::move(from);
+  }
 
   inline PackB2& operator=(const PackB2& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackB2& operator=(PackB2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackB2& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackB2& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackB2* internal_default_instance() {
     return reinterpret_cast<const PackB2*>(
                &_PackB2_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    14;
 
-  void Swap(PackB2* other);
+  friend void swap(PackB2& a, PackB2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackB2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackB2* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackB2* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackB2* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackB2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackB2>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackB2& from);
-  void MergeFrom(const PackB2& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackB2& from) {
+    PackB2::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackB2* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackB2";
   }
+  protected:
+  explicit PackB2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kEmailTokenFieldNumber = 1,
+  };
   // string emailToken = 1;
   void clear_emailtoken();
-  static const int kEmailTokenFieldNumber = 1;
-  const ::std::string& emailtoken() const;
-  void set_emailtoken(const ::std::string& value);
-  void set_emailtoken(const char* value);
-  void set_emailtoken(const char* value, size_t size);
-  ::std::string* mutable_emailtoken();
-  ::std::string* release_emailtoken();
-  void set_allocated_emailtoken(::std::string* emailtoken);
+  const std::string& emailtoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_emailtoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_emailtoken();
+  PROTOBUF_NODISCARD std::string* release_emailtoken();
+  void set_allocated_emailtoken(std::string* emailtoken);
+  private:
+  const std::string& _internal_emailtoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_emailtoken(const std::string& value);
+  std::string* _internal_mutable_emailtoken();
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackB2)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr emailtoken_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr emailtoken_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackB3 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB3) */ {
+class PackB3 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB3) */ {
  public:
-  PackB3();
-  virtual ~PackB3();
+  inline PackB3() : PackB3(nullptr) {}
+  ~PackB3() override;
+  explicit PROTOBUF_CONSTEXPR PackB3(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackB3(const PackB3& from);
+  PackB3(PackB3&& from) noexcept
+    : PackB3() {
+    *this = ::std::move(from);
+  }
 
   inline PackB3& operator=(const PackB3& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackB3& operator=(PackB3&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackB3& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackB3& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackB3* internal_default_instance() {
     return reinterpret_cast<const PackB3*>(
                &_PackB3_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    15;
 
-  void Swap(PackB3* other);
+  friend void swap(PackB3& a, PackB3& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackB3* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackB3* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackB3* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackB3* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackB3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackB3>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackB3& from);
-  void MergeFrom(const PackB3& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackB3& from) {
+    PackB3::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackB3* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackB3";
   }
+  protected:
+  explicit PackB3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMsgFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string msg = 2;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
-
-  // string msg = 2;
-  void clear_msg();
-  static const int kMsgFieldNumber = 2;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackB3)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  bool success_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackB4 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB4) */ {
+class PackB4 final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB4) */ {
  public:
-  PackB4();
-  virtual ~PackB4();
+  inline PackB4() : PackB4(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR PackB4(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackB4(const PackB4& from);
+  PackB4(PackB4&& from) noexcept
+    : PackB4() {
+    *this = ::std::move(from);
+  }
 
   inline PackB4& operator=(const PackB4& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackB4& operator=(PackB4&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackB4& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackB4& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackB4* internal_default_instance() {
     return reinterpret_cast<const PackB4*>(
                &_PackB4_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    16;
 
-  void Swap(PackB4* other);
+  friend void swap(PackB4& a, PackB4& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackB4* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackB4* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackB4* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackB4* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const PackB4& from);
-  void MergeFrom(const PackB4& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(PackB4* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+  PackB4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackB4>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const PackB4& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const PackB4& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackB4";
+  }
+  protected:
+  explicit PackB4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1629,358 +3034,587 @@ class PackB4 : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackB4)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackB5 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB5) */ {
+class PackB5 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackB5) */ {
  public:
-  PackB5();
-  virtual ~PackB5();
+  inline PackB5() : PackB5(nullptr) {}
+  ~PackB5() override;
+  explicit PROTOBUF_CONSTEXPR PackB5(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackB5(const PackB5& from);
+  PackB5(PackB5&& from) noexcept
+    : PackB5() {
+    *this = ::std::move(from);
+  }
 
   inline PackB5& operator=(const PackB5& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackB5& operator=(PackB5&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackB5& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackB5& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackB5* internal_default_instance() {
     return reinterpret_cast<const PackB5*>(
                &_PackB5_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    17;
 
-  void Swap(PackB5* other);
+  friend void swap(PackB5& a, PackB5& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackB5* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackB5* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackB5* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackB5* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackB5* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackB5>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackB5& from);
-  void MergeFrom(const PackB5& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackB5& from) {
+    PackB5::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackB5* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackB5";
   }
+  protected:
+  explicit PackB5(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kVerifiedEmailFieldNumber = 1,
+    kUnverifiedEmailFieldNumber = 2,
+  };
   // string verifiedEmail = 1;
   void clear_verifiedemail();
-  static const int kVerifiedEmailFieldNumber = 1;
-  const ::std::string& verifiedemail() const;
-  void set_verifiedemail(const ::std::string& value);
-  void set_verifiedemail(const char* value);
-  void set_verifiedemail(const char* value, size_t size);
-  ::std::string* mutable_verifiedemail();
-  ::std::string* release_verifiedemail();
-  void set_allocated_verifiedemail(::std::string* verifiedemail);
+  const std::string& verifiedemail() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_verifiedemail(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_verifiedemail();
+  PROTOBUF_NODISCARD std::string* release_verifiedemail();
+  void set_allocated_verifiedemail(std::string* verifiedemail);
+  private:
+  const std::string& _internal_verifiedemail() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_verifiedemail(const std::string& value);
+  std::string* _internal_mutable_verifiedemail();
+  public:
 
   // string unverifiedEmail = 2;
   void clear_unverifiedemail();
-  static const int kUnverifiedEmailFieldNumber = 2;
-  const ::std::string& unverifiedemail() const;
-  void set_unverifiedemail(const ::std::string& value);
-  void set_unverifiedemail(const char* value);
-  void set_unverifiedemail(const char* value, size_t size);
-  ::std::string* mutable_unverifiedemail();
-  ::std::string* release_unverifiedemail();
-  void set_allocated_unverifiedemail(::std::string* unverifiedemail);
+  const std::string& unverifiedemail() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_unverifiedemail(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_unverifiedemail();
+  PROTOBUF_NODISCARD std::string* release_unverifiedemail();
+  void set_allocated_unverifiedemail(std::string* unverifiedemail);
+  private:
+  const std::string& _internal_unverifiedemail() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_unverifiedemail(const std::string& value);
+  std::string* _internal_mutable_unverifiedemail();
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackB5)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr verifiedemail_;
-  ::google::protobuf::internal::ArenaStringPtr unverifiedemail_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr verifiedemail_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr unverifiedemail_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackC0 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackC0) */ {
+class PackC0 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackC0) */ {
  public:
-  PackC0();
-  virtual ~PackC0();
+  inline PackC0() : PackC0(nullptr) {}
+  ~PackC0() override;
+  explicit PROTOBUF_CONSTEXPR PackC0(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackC0(const PackC0& from);
+  PackC0(PackC0&& from) noexcept
+    : PackC0() {
+    *this = ::std::move(from);
+  }
 
   inline PackC0& operator=(const PackC0& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackC0& operator=(PackC0&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackC0& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackC0& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackC0* internal_default_instance() {
     return reinterpret_cast<const PackC0*>(
                &_PackC0_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    18;
 
-  void Swap(PackC0* other);
+  friend void swap(PackC0& a, PackC0& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackC0* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackC0* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackC0* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackC0* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackC0* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackC0>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackC0& from);
-  void MergeFrom(const PackC0& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackC0& from) {
+    PackC0::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackC0* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackC0";
   }
+  protected:
+  explicit PackC0(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kEIDFieldNumber = 1,
+  };
   // uint32 eID = 1;
   void clear_eid();
-  static const int kEIDFieldNumber = 1;
-  ::google::protobuf::uint32 eid() const;
-  void set_eid(::google::protobuf::uint32 value);
+  uint32_t eid() const;
+  void set_eid(uint32_t value);
+  private:
+  uint32_t _internal_eid() const;
+  void _internal_set_eid(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackC0)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 eid_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t eid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackC1 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackC1) */ {
+class PackC1 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackC1) */ {
  public:
-  PackC1();
-  virtual ~PackC1();
+  inline PackC1() : PackC1(nullptr) {}
+  ~PackC1() override;
+  explicit PROTOBUF_CONSTEXPR PackC1(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackC1(const PackC1& from);
+  PackC1(PackC1&& from) noexcept
+    : PackC1() {
+    *this = ::std::move(from);
+  }
 
   inline PackC1& operator=(const PackC1& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackC1& operator=(PackC1&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackC1& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackC1& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackC1* internal_default_instance() {
     return reinterpret_cast<const PackC1*>(
                &_PackC1_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    19;
 
-  void Swap(PackC1* other);
+  friend void swap(PackC1& a, PackC1& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackC1* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackC1* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackC1* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackC1* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackC1* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackC1>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackC1& from);
-  void MergeFrom(const PackC1& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackC1& from) {
+    PackC1::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackC1* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackC1";
   }
+  protected:
+  explicit PackC1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackC1)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackC2 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackC2) */ {
+class PackC2 final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackC2) */ {
  public:
-  PackC2();
-  virtual ~PackC2();
+  inline PackC2() : PackC2(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR PackC2(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackC2(const PackC2& from);
+  PackC2(PackC2&& from) noexcept
+    : PackC2() {
+    *this = ::std::move(from);
+  }
 
   inline PackC2& operator=(const PackC2& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackC2& operator=(PackC2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackC2& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackC2& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackC2* internal_default_instance() {
     return reinterpret_cast<const PackC2*>(
                &_PackC2_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    20;
 
-  void Swap(PackC2* other);
+  friend void swap(PackC2& a, PackC2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackC2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackC2* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackC2* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackC2* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const PackC2& from);
-  void MergeFrom(const PackC2& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(PackC2* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+  PackC2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackC2>(arena);
   }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const PackC2& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const PackC2& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackC2";
   }
+  protected:
+  explicit PackC2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1988,169 +3622,270 @@ class PackC2 : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackC2)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackC3 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackC3) */ {
+class PackC3 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackC3) */ {
  public:
-  PackC3();
-  virtual ~PackC3();
+  inline PackC3() : PackC3(nullptr) {}
+  ~PackC3() override;
+  explicit PROTOBUF_CONSTEXPR PackC3(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackC3(const PackC3& from);
+  PackC3(PackC3&& from) noexcept
+    : PackC3() {
+    *this = ::std::move(from);
+  }
 
   inline PackC3& operator=(const PackC3& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackC3& operator=(PackC3&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackC3& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackC3& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackC3* internal_default_instance() {
     return reinterpret_cast<const PackC3*>(
                &_PackC3_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    21;
 
-  void Swap(PackC3* other);
+  friend void swap(PackC3& a, PackC3& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackC3* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackC3* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackC3* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackC3* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackC3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackC3>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackC3& from);
-  void MergeFrom(const PackC3& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackC3& from) {
+    PackC3::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackC3* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackC3";
   }
+  protected:
+  explicit PackC3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackC3)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackD0 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackD0) */ {
+class PackD0 final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackD0) */ {
  public:
-  PackD0();
-  virtual ~PackD0();
+  inline PackD0() : PackD0(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR PackD0(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackD0(const PackD0& from);
+  PackD0(PackD0&& from) noexcept
+    : PackD0() {
+    *this = ::std::move(from);
+  }
 
   inline PackD0& operator=(const PackD0& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackD0& operator=(PackD0&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackD0& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackD0& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackD0* internal_default_instance() {
     return reinterpret_cast<const PackD0*>(
                &_PackD0_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    22;
 
-  void Swap(PackD0* other);
+  friend void swap(PackD0& a, PackD0& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackD0* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackD0* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackD0* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackD0* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const PackD0& from);
-  void MergeFrom(const PackD0& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(PackD0* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+  PackD0* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackD0>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const PackD0& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const PackD0& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackD0";
   }
+  protected:
+  explicit PackD0(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2158,217 +3893,334 @@ class PackD0 : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackD0)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackD1 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackD1) */ {
+class PackD1 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackD1) */ {
  public:
-  PackD1();
-  virtual ~PackD1();
+  inline PackD1() : PackD1(nullptr) {}
+  ~PackD1() override;
+  explicit PROTOBUF_CONSTEXPR PackD1(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackD1(const PackD1& from);
+  PackD1(PackD1&& from) noexcept
+    : PackD1() {
+    *this = ::std::move(from);
+  }
 
   inline PackD1& operator=(const PackD1& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackD1& operator=(PackD1&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackD1& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackD1& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackD1* internal_default_instance() {
     return reinterpret_cast<const PackD1*>(
                &_PackD1_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    23;
 
-  void Swap(PackD1* other);
+  friend void swap(PackD1& a, PackD1& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackD1* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackD1* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackD1* New() const PROTOBUF_FINAL { return New(NULL); }
+  PackD1* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackD1>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PackD1& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackD1& from) {
+    PackD1::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  PackD1* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const PackD1& from);
-  void MergeFrom(const PackD1& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackD1* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackD1";
   }
+  protected:
+  explicit PackD1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kFolderObjKeyFieldNumber = 1,
+    kAccessKeyIDFieldNumber = 2,
+    kAccessKeyFieldNumber = 3,
+    kSessionKeyFieldNumber = 4,
+    kMsgFieldNumber = 5,
+  };
   // string folderObjKey = 1;
   void clear_folderobjkey();
-  static const int kFolderObjKeyFieldNumber = 1;
-  const ::std::string& folderobjkey() const;
-  void set_folderobjkey(const ::std::string& value);
-  void set_folderobjkey(const char* value);
-  void set_folderobjkey(const char* value, size_t size);
-  ::std::string* mutable_folderobjkey();
-  ::std::string* release_folderobjkey();
-  void set_allocated_folderobjkey(::std::string* folderobjkey);
+  const std::string& folderobjkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_folderobjkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_folderobjkey();
+  PROTOBUF_NODISCARD std::string* release_folderobjkey();
+  void set_allocated_folderobjkey(std::string* folderobjkey);
+  private:
+  const std::string& _internal_folderobjkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_folderobjkey(const std::string& value);
+  std::string* _internal_mutable_folderobjkey();
+  public:
 
   // string accessKeyID = 2;
   void clear_accesskeyid();
-  static const int kAccessKeyIDFieldNumber = 2;
-  const ::std::string& accesskeyid() const;
-  void set_accesskeyid(const ::std::string& value);
-  void set_accesskeyid(const char* value);
-  void set_accesskeyid(const char* value, size_t size);
-  ::std::string* mutable_accesskeyid();
-  ::std::string* release_accesskeyid();
-  void set_allocated_accesskeyid(::std::string* accesskeyid);
+  const std::string& accesskeyid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_accesskeyid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_accesskeyid();
+  PROTOBUF_NODISCARD std::string* release_accesskeyid();
+  void set_allocated_accesskeyid(std::string* accesskeyid);
+  private:
+  const std::string& _internal_accesskeyid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_accesskeyid(const std::string& value);
+  std::string* _internal_mutable_accesskeyid();
+  public:
 
   // string accessKey = 3;
   void clear_accesskey();
-  static const int kAccessKeyFieldNumber = 3;
-  const ::std::string& accesskey() const;
-  void set_accesskey(const ::std::string& value);
-  void set_accesskey(const char* value);
-  void set_accesskey(const char* value, size_t size);
-  ::std::string* mutable_accesskey();
-  ::std::string* release_accesskey();
-  void set_allocated_accesskey(::std::string* accesskey);
+  const std::string& accesskey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_accesskey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_accesskey();
+  PROTOBUF_NODISCARD std::string* release_accesskey();
+  void set_allocated_accesskey(std::string* accesskey);
+  private:
+  const std::string& _internal_accesskey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_accesskey(const std::string& value);
+  std::string* _internal_mutable_accesskey();
+  public:
 
   // string sessionKey = 4;
   void clear_sessionkey();
-  static const int kSessionKeyFieldNumber = 4;
-  const ::std::string& sessionkey() const;
-  void set_sessionkey(const ::std::string& value);
-  void set_sessionkey(const char* value);
-  void set_sessionkey(const char* value, size_t size);
-  ::std::string* mutable_sessionkey();
-  ::std::string* release_sessionkey();
-  void set_allocated_sessionkey(::std::string* sessionkey);
+  const std::string& sessionkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sessionkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sessionkey();
+  PROTOBUF_NODISCARD std::string* release_sessionkey();
+  void set_allocated_sessionkey(std::string* sessionkey);
+  private:
+  const std::string& _internal_sessionkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sessionkey(const std::string& value);
+  std::string* _internal_mutable_sessionkey();
+  public:
 
   // string msg = 5;
   void clear_msg();
-  static const int kMsgFieldNumber = 5;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackD1)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr folderobjkey_;
-  ::google::protobuf::internal::ArenaStringPtr accesskeyid_;
-  ::google::protobuf::internal::ArenaStringPtr accesskey_;
-  ::google::protobuf::internal::ArenaStringPtr sessionkey_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr folderobjkey_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr accesskeyid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr accesskey_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sessionkey_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackD2 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackD2) */ {
+class PackD2 final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackD2) */ {
  public:
-  PackD2();
-  virtual ~PackD2();
+  inline PackD2() : PackD2(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR PackD2(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackD2(const PackD2& from);
+  PackD2(PackD2&& from) noexcept
+    : PackD2() {
+    *this = ::std::move(from);
+  }
 
   inline PackD2& operator=(const PackD2& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackD2& operator=(PackD2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackD2& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackD2& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackD2* internal_default_instance() {
     return reinterpret_cast<const PackD2*>(
                &_PackD2_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    24;
 
-  void Swap(PackD2* other);
+  friend void swap(PackD2& a, PackD2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackD2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackD2* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackD2* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackD2* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const PackD2& from);
-  void MergeFrom(const PackD2& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(PackD2* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+  PackD2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackD2>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const PackD2& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const PackD2& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackD2";
   }
+  protected:
+  explicit PackD2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2376,78 +4228,117 @@ class PackD2 : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackD2)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackD3 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackD3) */ {
+class PackD3 final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackD3) */ {
  public:
-  PackD3();
-  virtual ~PackD3();
+  inline PackD3() : PackD3(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR PackD3(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackD3(const PackD3& from);
+  PackD3(PackD3&& from) noexcept
+    : PackD3() {
+    *this = ::std::move(from);
+  }
 
   inline PackD3& operator=(const PackD3& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackD3& operator=(PackD3&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackD3& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackD3& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackD3* internal_default_instance() {
     return reinterpret_cast<const PackD3*>(
                &_PackD3_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    25;
 
-  void Swap(PackD3* other);
+  friend void swap(PackD3& a, PackD3& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackD3* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackD3* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackD3* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackD3* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const PackD3& from);
-  void MergeFrom(const PackD3& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(PackD3* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+  PackD3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackD3>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const PackD3& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const PackD3& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackD3";
+  }
+  protected:
+  explicit PackD3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2455,581 +4346,1019 @@ class PackD3 : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackD3)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackD4 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackD4) */ {
+class PackD4 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackD4) */ {
  public:
-  PackD4();
-  virtual ~PackD4();
+  inline PackD4() : PackD4(nullptr) {}
+  ~PackD4() override;
+  explicit PROTOBUF_CONSTEXPR PackD4(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackD4(const PackD4& from);
+  PackD4(PackD4&& from) noexcept
+    : PackD4() {
+    *this = ::std::move(from);
+  }
 
   inline PackD4& operator=(const PackD4& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackD4& operator=(PackD4&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackD4& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackD4& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackD4* internal_default_instance() {
     return reinterpret_cast<const PackD4*>(
                &_PackD4_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    26;
 
-  void Swap(PackD4* other);
+  friend void swap(PackD4& a, PackD4& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackD4* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackD4* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackD4* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackD4* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackD4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackD4>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackD4& from);
-  void MergeFrom(const PackD4& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackD4& from) {
+    PackD4::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackD4* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackD4";
   }
+  protected:
+  explicit PackD4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kHasResumeFieldNumber = 1,
+  };
   // bool hasResume = 1;
   void clear_hasresume();
-  static const int kHasResumeFieldNumber = 1;
   bool hasresume() const;
   void set_hasresume(bool value);
+  private:
+  bool _internal_hasresume() const;
+  void _internal_set_hasresume(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackD4)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool hasresume_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool hasresume_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackE0 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE0) */ {
+class PackE0 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE0) */ {
  public:
-  PackE0();
-  virtual ~PackE0();
+  inline PackE0() : PackE0(nullptr) {}
+  ~PackE0() override;
+  explicit PROTOBUF_CONSTEXPR PackE0(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackE0(const PackE0& from);
+  PackE0(PackE0&& from) noexcept
+    : PackE0() {
+    *this = ::std::move(from);
+  }
 
   inline PackE0& operator=(const PackE0& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackE0& operator=(PackE0&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackE0& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackE0& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackE0* internal_default_instance() {
     return reinterpret_cast<const PackE0*>(
                &_PackE0_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    27;
 
-  void Swap(PackE0* other);
+  friend void swap(PackE0& a, PackE0& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackE0* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackE0* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackE0* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackE0* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackE0* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackE0>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackE0& from);
-  void MergeFrom(const PackE0& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackE0& from) {
+    PackE0::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackE0* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackE0";
   }
+  protected:
+  explicit PackE0(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:ProtobufPackets.PackE0)
- private:
+  enum : int {
+    kPageSizeFieldNumber = 1,
+    kCursorFieldNumber = 2,
+  };
+  // uint32 pageSize = 1;
+  void clear_pagesize();
+  uint32_t pagesize() const;
+  void set_pagesize(uint32_t value);
+  private:
+  uint32_t _internal_pagesize() const;
+  void _internal_set_pagesize(uint32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
+  // uint32 cursor = 2;
+  void clear_cursor();
+  uint32_t cursor() const;
+  void set_cursor(uint32_t value);
+  private:
+  uint32_t _internal_cursor() const;
+  void _internal_set_cursor(uint32_t value);
+  public:
 
+  // @@protoc_insertion_point(class_scope:ProtobufPackets.PackE0)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t pagesize_;
+    uint32_t cursor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackE1 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE1) */ {
+class PackE1 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE1) */ {
  public:
-  PackE1();
-  virtual ~PackE1();
+  inline PackE1() : PackE1(nullptr) {}
+  ~PackE1() override;
+  explicit PROTOBUF_CONSTEXPR PackE1(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackE1(const PackE1& from);
+  PackE1(PackE1&& from) noexcept
+    : PackE1() {
+    *this = ::std::move(from);
+  }
 
   inline PackE1& operator=(const PackE1& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackE1& operator=(PackE1&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackE1& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackE1& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackE1* internal_default_instance() {
     return reinterpret_cast<const PackE1*>(
                &_PackE1_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    28;
 
-  void Swap(PackE1* other);
+  friend void swap(PackE1& a, PackE1& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackE1* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackE1* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackE1* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackE1* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackE1* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackE1>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackE1& from);
-  void MergeFrom(const PackE1& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackE1& from) {
+    PackE1::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackE1* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackE1";
   }
+  protected:
+  explicit PackE1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kEmployeeEIDsFieldNumber = 1,
+    kUnacceptedEIDsFieldNumber = 2,
+    kAcceptedEIDsFieldNumber = 3,
+    kMsgFieldNumber = 5,
+    kSuccessFieldNumber = 4,
+    kMorePagesFieldNumber = 7,
+    kNextCursorFieldNumber = 6,
+  };
   // repeated uint32 employeeEIDs = 1;
   int employeeeids_size() const;
+  private:
+  int _internal_employeeeids_size() const;
+  public:
   void clear_employeeeids();
-  static const int kEmployeeEIDsFieldNumber = 1;
-  ::google::protobuf::uint32 employeeeids(int index) const;
-  void set_employeeeids(int index, ::google::protobuf::uint32 value);
-  void add_employeeeids(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_employeeeids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_employeeeids() const;
+  void _internal_add_employeeeids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_employeeeids();
+  public:
+  uint32_t employeeeids(int index) const;
+  void set_employeeeids(int index, uint32_t value);
+  void add_employeeeids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       employeeeids() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_employeeeids();
 
   // repeated uint32 unacceptedEIDs = 2;
   int unacceptedeids_size() const;
+  private:
+  int _internal_unacceptedeids_size() const;
+  public:
   void clear_unacceptedeids();
-  static const int kUnacceptedEIDsFieldNumber = 2;
-  ::google::protobuf::uint32 unacceptedeids(int index) const;
-  void set_unacceptedeids(int index, ::google::protobuf::uint32 value);
-  void add_unacceptedeids(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_unacceptedeids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_unacceptedeids() const;
+  void _internal_add_unacceptedeids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_unacceptedeids();
+  public:
+  uint32_t unacceptedeids(int index) const;
+  void set_unacceptedeids(int index, uint32_t value);
+  void add_unacceptedeids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       unacceptedeids() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_unacceptedeids();
 
   // repeated uint32 acceptedEIDs = 3;
   int acceptedeids_size() const;
+  private:
+  int _internal_acceptedeids_size() const;
+  public:
   void clear_acceptedeids();
-  static const int kAcceptedEIDsFieldNumber = 3;
-  ::google::protobuf::uint32 acceptedeids(int index) const;
-  void set_acceptedeids(int index, ::google::protobuf::uint32 value);
-  void add_acceptedeids(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_acceptedeids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_acceptedeids() const;
+  void _internal_add_acceptedeids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_acceptedeids();
+  public:
+  uint32_t acceptedeids(int index) const;
+  void set_acceptedeids(int index, uint32_t value);
+  void add_acceptedeids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       acceptedeids() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_acceptedeids();
 
+  // string msg = 5;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
   // bool success = 4;
   void clear_success();
-  static const int kSuccessFieldNumber = 4;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  // string msg = 5;
-  void clear_msg();
-  static const int kMsgFieldNumber = 5;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  // bool morePages = 7;
+  void clear_morepages();
+  bool morepages() const;
+  void set_morepages(bool value);
+  private:
+  bool _internal_morepages() const;
+  void _internal_set_morepages(bool value);
+  public:
+
+  // uint32 nextCursor = 6;
+  void clear_nextcursor();
+  uint32_t nextcursor() const;
+  void set_nextcursor(uint32_t value);
+  private:
+  uint32_t _internal_nextcursor() const;
+  void _internal_set_nextcursor(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackE1)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > employeeeids_;
-  mutable int _employeeeids_cached_byte_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > unacceptedeids_;
-  mutable int _unacceptedeids_cached_byte_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > acceptedeids_;
-  mutable int _acceptedeids_cached_byte_size_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  bool success_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > employeeeids_;
+    mutable std::atomic<int> _employeeeids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > unacceptedeids_;
+    mutable std::atomic<int> _unacceptedeids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > acceptedeids_;
+    mutable std::atomic<int> _acceptedeids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    bool success_;
+    bool morepages_;
+    uint32_t nextcursor_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackE2 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE2) */ {
+class PackE2 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE2) */ {
  public:
-  PackE2();
-  virtual ~PackE2();
+  inline PackE2() : PackE2(nullptr) {}
+  ~PackE2() override;
+  explicit PROTOBUF_CONSTEXPR PackE2(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackE2(const PackE2& from);
+  PackE2(PackE2&& from) noexcept
+    : PackE2() {
+    *this = ::std::move(from);
+  }
 
   inline PackE2& operator=(const PackE2& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackE2& operator=(PackE2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackE2& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackE2& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackE2* internal_default_instance() {
     return reinterpret_cast<const PackE2*>(
                &_PackE2_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    29;
 
-  void Swap(PackE2* other);
+  friend void swap(PackE2& a, PackE2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackE2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackE2* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackE2* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackE2* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackE2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackE2>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackE2& from);
-  void MergeFrom(const PackE2& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackE2& from) {
+    PackE2::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackE2* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackE2";
   }
+  protected:
+  explicit PackE2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kEIDFieldNumber = 1,
+    kAStateFieldNumber = 2,
+  };
   // uint32 eID = 1;
   void clear_eid();
-  static const int kEIDFieldNumber = 1;
-  ::google::protobuf::uint32 eid() const;
-  void set_eid(::google::protobuf::uint32 value);
+  uint32_t eid() const;
+  void set_eid(uint32_t value);
+  private:
+  uint32_t _internal_eid() const;
+  void _internal_set_eid(uint32_t value);
+  public:
 
   // int32 aState = 2;
   void clear_astate();
-  static const int kAStateFieldNumber = 2;
-  ::google::protobuf::int32 astate() const;
-  void set_astate(::google::protobuf::int32 value);
+  int32_t astate() const;
+  void set_astate(int32_t value);
+  private:
+  int32_t _internal_astate() const;
+  void _internal_set_astate(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackE2)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 eid_;
-  ::google::protobuf::int32 astate_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t eid_;
+    int32_t astate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackE3 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE3) */ {
+class PackE3 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE3) */ {
  public:
-  PackE3();
-  virtual ~PackE3();
+  inline PackE3() : PackE3(nullptr) {}
+  ~PackE3() override;
+  explicit PROTOBUF_CONSTEXPR PackE3(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackE3(const PackE3& from);
+  PackE3(PackE3&& from) noexcept
+    : PackE3() {
+    *this = ::std::move(from);
+  }
 
   inline PackE3& operator=(const PackE3& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackE3& operator=(PackE3&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackE3& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackE3& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackE3* internal_default_instance() {
     return reinterpret_cast<const PackE3*>(
                &_PackE3_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    30;
 
-  void Swap(PackE3* other);
+  friend void swap(PackE3& a, PackE3& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackE3* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackE3* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackE3* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackE3* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackE3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackE3>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackE3& from);
-  void MergeFrom(const PackE3& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackE3& from) {
+    PackE3::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackE3* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackE3";
   }
+  protected:
+  explicit PackE3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMsgFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+    kEIDFieldNumber = 3,
+  };
+  // string msg = 2;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
-
-  // string msg = 2;
-  void clear_msg();
-  static const int kMsgFieldNumber = 2;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // uint32 eID = 3;
   void clear_eid();
-  static const int kEIDFieldNumber = 3;
-  ::google::protobuf::uint32 eid() const;
-  void set_eid(::google::protobuf::uint32 value);
+  uint32_t eid() const;
+  void set_eid(uint32_t value);
+  private:
+  uint32_t _internal_eid() const;
+  void _internal_set_eid(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackE3)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  bool success_;
-  ::google::protobuf::uint32 eid_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    bool success_;
+    uint32_t eid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackE4 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE4) */ {
+class PackE4 final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE4) */ {
  public:
-  PackE4();
-  virtual ~PackE4();
+  inline PackE4() : PackE4(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR PackE4(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackE4(const PackE4& from);
+  PackE4(PackE4&& from) noexcept
+    : PackE4() {
+    *this = ::std::move(from);
+  }
 
   inline PackE4& operator=(const PackE4& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackE4& operator=(PackE4&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackE4& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackE4& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackE4* internal_default_instance() {
     return reinterpret_cast<const PackE4*>(
                &_PackE4_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    31;
 
-  void Swap(PackE4* other);
+  friend void swap(PackE4& a, PackE4& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackE4* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackE4* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackE4* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackE4* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const PackE4& from);
-  void MergeFrom(const PackE4& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(PackE4* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+  PackE4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackE4>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const PackE4& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const PackE4& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackE4";
   }
+  protected:
+  explicit PackE4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3037,434 +5366,884 @@ class PackE4 : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackE4)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackE5 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE5) */ {
+class PackE5 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE5) */ {
  public:
-  PackE5();
-  virtual ~PackE5();
+  inline PackE5() : PackE5(nullptr) {}
+  ~PackE5() override;
+  explicit PROTOBUF_CONSTEXPR PackE5(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackE5(const PackE5& from);
+  PackE5(PackE5&& from) noexcept
+    : PackE5() {
+    *this = ::std::move(from);
+  }
 
   inline PackE5& operator=(const PackE5& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackE5& operator=(PackE5&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackE5& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackE5& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackE5* internal_default_instance() {
     return reinterpret_cast<const PackE5*>(
                &_PackE5_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    32;
 
-  void Swap(PackE5* other);
+  friend void swap(PackE5& a, PackE5& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackE5* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackE5* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackE5* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackE5* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackE5* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackE5>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackE5& from);
-  void MergeFrom(const PackE5& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackE5& from) {
+    PackE5::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackE5* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackE5";
   }
+  protected:
+  explicit PackE5(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // int32 aState = 1;
-  void clear_astate();
-  static const int kAStateFieldNumber = 1;
-  ::google::protobuf::int32 astate() const;
-  void set_astate(::google::protobuf::int32 value);
-
+  enum : int {
+    kMsgFieldNumber = 2,
+    kAStateFieldNumber = 1,
+  };
   // string msg = 2;
   void clear_msg();
-  static const int kMsgFieldNumber = 2;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
+  // int32 aState = 1;
+  void clear_astate();
+  int32_t astate() const;
+  void set_astate(int32_t value);
+  private:
+  int32_t _internal_astate() const;
+  void _internal_set_astate(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackE5)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  ::google::protobuf::int32 astate_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    int32_t astate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackE6 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE6) */ {
+class PackE6 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE6) */ {
  public:
-  PackE6();
-  virtual ~PackE6();
+  inline PackE6() : PackE6(nullptr) {}
+  ~PackE6() override;
+  explicit PROTOBUF_CONSTEXPR PackE6(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackE6(const PackE6& from);
+  PackE6(PackE6&& from) noexcept
+    : PackE6() {
+    *this = ::std::move(from);
+  }
 
   inline PackE6& operator=(const PackE6& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackE6& operator=(PackE6&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackE6& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackE6& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackE6* internal_default_instance() {
     return reinterpret_cast<const PackE6*>(
                &_PackE6_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    33;
 
-  void Swap(PackE6* other);
+  friend void swap(PackE6& a, PackE6& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackE6* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackE6* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackE6* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackE6* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackE6* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackE6>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackE6& from);
-  void MergeFrom(const PackE6& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackE6& from) {
+    PackE6::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackE6* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackE6";
   }
+  protected:
+  explicit PackE6(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kAcceptFieldNumber = 1,
+  };
   // bool accept = 1;
   void clear_accept();
-  static const int kAcceptFieldNumber = 1;
   bool accept() const;
   void set_accept(bool value);
+  private:
+  bool _internal_accept() const;
+  void _internal_set_accept(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackE6)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool accept_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool accept_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PackE7 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE7) */ {
+class PackE7 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtobufPackets.PackE7) */ {
  public:
-  PackE7();
-  virtual ~PackE7();
+  inline PackE7() : PackE7(nullptr) {}
+  ~PackE7() override;
+  explicit PROTOBUF_CONSTEXPR PackE7(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PackE7(const PackE7& from);
+  PackE7(PackE7&& from) noexcept
+    : PackE7() {
+    *this = ::std::move(from);
+  }
 
   inline PackE7& operator=(const PackE7& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PackE7& operator=(PackE7&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PackE7& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackE7& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PackE7* internal_default_instance() {
     return reinterpret_cast<const PackE7*>(
                &_PackE7_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    34;
 
-  void Swap(PackE7* other);
+  friend void swap(PackE7& a, PackE7& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackE7* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackE7* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PackE7* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  PackE7* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  PackE7* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackE7>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PackE7& from);
-  void MergeFrom(const PackE7& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
-      const PROTOBUF_FINAL {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackE7& from) {
+    PackE7::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(PackE7* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtobufPackets.PackE7";
   }
+  protected:
+  explicit PackE7(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMsgFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string msg = 2;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
-
-  // string msg = 2;
-  void clear_msg();
-  static const int kMsgFieldNumber = 2;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtobufPackets.PackE7)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  bool success_;
-  mutable int _cached_size_;
-  friend void  protobuf_InitDefaults_BBPacks_2eproto_impl();
-  friend void  protobuf_AddDesc_BBPacks_2eproto_impl();
-  friend const ::google::protobuf::uint32* protobuf_Offsets_BBPacks_2eproto();
-  friend void protobuf_ShutdownFile_BBPacks_2eproto();
-
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_BBPacks_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PackHeaderIn
+
+// bool serverRead = 1;
+inline void PackHeaderIn::clear_serverread() {
+  _impl_.serverread_ = false;
+}
+inline bool PackHeaderIn::_internal_serverread() const {
+  return _impl_.serverread_;
+}
+inline bool PackHeaderIn::serverread() const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackHeaderIn.serverRead)
+  return _internal_serverread();
+}
+inline void PackHeaderIn::_internal_set_serverread(bool value) {
+  
+  _impl_.serverread_ = value;
+}
+inline void PackHeaderIn::set_serverread(bool value) {
+  _internal_set_serverread(value);
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackHeaderIn.serverRead)
+}
+
+// string locKey = 2;
+inline void PackHeaderIn::clear_lockey() {
+  _impl_.lockey_.ClearToEmpty();
+}
+inline const std::string& PackHeaderIn::lockey() const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackHeaderIn.locKey)
+  return _internal_lockey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackHeaderIn::set_lockey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.lockey_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackHeaderIn.locKey)
+}
+inline std::string* PackHeaderIn::mutable_lockey() {
+  std::string* _s = _internal_mutable_lockey();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackHeaderIn.locKey)
+  return _s;
+}
+inline const std::string& PackHeaderIn::_internal_lockey() const {
+  return _impl_.lockey_.Get();
+}
+inline void PackHeaderIn::_internal_set_lockey(const std::string& value) {
+  
+  _impl_.lockey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PackHeaderIn::_internal_mutable_lockey() {
+  
+  return _impl_.lockey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PackHeaderIn::release_lockey() {
+  // @@protoc_insertion_point(field_release:ProtobufPackets.PackHeaderIn.locKey)
+  return _impl_.lockey_.Release();
+}
+inline void PackHeaderIn::set_allocated_lockey(std::string* lockey) {
+  if (lockey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.lockey_.SetAllocated(lockey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lockey_.IsDefault()) {
+    _impl_.lockey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackHeaderIn.locKey)
+}
+
+// repeated uint32 sendToIDs = 3;
+inline int PackHeaderIn::_internal_sendtoids_size() const {
+  return _impl_.sendtoids_.size();
+}
+inline int PackHeaderIn::sendtoids_size() const {
+  return _internal_sendtoids_size();
+}
+inline void PackHeaderIn::clear_sendtoids() {
+  _impl_.sendtoids_.Clear();
+}
+inline uint32_t PackHeaderIn::_internal_sendtoids(int index) const {
+  return _impl_.sendtoids_.Get(index);
+}
+inline uint32_t PackHeaderIn::sendtoids(int index) const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackHeaderIn.sendToIDs)
+  return _internal_sendtoids(index);
+}
+inline void PackHeaderIn::set_sendtoids(int index, uint32_t value) {
+  _impl_.sendtoids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackHeaderIn.sendToIDs)
+}
+inline void PackHeaderIn::_internal_add_sendtoids(uint32_t value) {
+  _impl_.sendtoids_.Add(value);
+}
+inline void PackHeaderIn::add_sendtoids(uint32_t value) {
+  _internal_add_sendtoids(value);
+  // @@protoc_insertion_point(field_add:ProtobufPackets.PackHeaderIn.sendToIDs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PackHeaderIn::_internal_sendtoids() const {
+  return _impl_.sendtoids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PackHeaderIn::sendtoids() const {
+  // @@protoc_insertion_point(field_list:ProtobufPackets.PackHeaderIn.sendToIDs)
+  return _internal_sendtoids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PackHeaderIn::_internal_mutable_sendtoids() {
+  return &_impl_.sendtoids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PackHeaderIn::mutable_sendtoids() {
+  // @@protoc_insertion_point(field_mutable_list:ProtobufPackets.PackHeaderIn.sendToIDs)
+  return _internal_mutable_sendtoids();
+}
+
+// uint32 dataSize = 4;
+inline void PackHeaderIn::clear_datasize() {
+  _impl_.datasize_ = 0u;
+}
+inline uint32_t PackHeaderIn::_internal_datasize() const {
+  return _impl_.datasize_;
+}
+inline uint32_t PackHeaderIn::datasize() const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackHeaderIn.dataSize)
+  return _internal_datasize();
+}
+inline void PackHeaderIn::_internal_set_datasize(uint32_t value) {
+  
+  _impl_.datasize_ = value;
+}
+inline void PackHeaderIn::set_datasize(uint32_t value) {
+  _internal_set_datasize(value);
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackHeaderIn.dataSize)
+}
+
+// -------------------------------------------------------------------
+
+// PackHeaderOut
+
+// string locKey = 1;
+inline void PackHeaderOut::clear_lockey() {
+  _impl_.lockey_.ClearToEmpty();
+}
+inline const std::string& PackHeaderOut::lockey() const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackHeaderOut.locKey)
+  return _internal_lockey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackHeaderOut::set_lockey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.lockey_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackHeaderOut.locKey)
+}
+inline std::string* PackHeaderOut::mutable_lockey() {
+  std::string* _s = _internal_mutable_lockey();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackHeaderOut.locKey)
+  return _s;
+}
+inline const std::string& PackHeaderOut::_internal_lockey() const {
+  return _impl_.lockey_.Get();
+}
+inline void PackHeaderOut::_internal_set_lockey(const std::string& value) {
+  
+  _impl_.lockey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PackHeaderOut::_internal_mutable_lockey() {
+  
+  return _impl_.lockey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PackHeaderOut::release_lockey() {
+  // @@protoc_insertion_point(field_release:ProtobufPackets.PackHeaderOut.locKey)
+  return _impl_.lockey_.Release();
+}
+inline void PackHeaderOut::set_allocated_lockey(std::string* lockey) {
+  if (lockey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.lockey_.SetAllocated(lockey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lockey_.IsDefault()) {
+    _impl_.lockey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackHeaderOut.locKey)
+}
+
+// uint32 sentFromID = 2;
+inline void PackHeaderOut::clear_sentfromid() {
+  _impl_.sentfromid_ = 0u;
+}
+inline uint32_t PackHeaderOut::_internal_sentfromid() const {
+  return _impl_.sentfromid_;
+}
+inline uint32_t PackHeaderOut::sentfromid() const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackHeaderOut.sentFromID)
+  return _internal_sentfromid();
+}
+inline void PackHeaderOut::_internal_set_sentfromid(uint32_t value) {
+  
+  _impl_.sentfromid_ = value;
+}
+inline void PackHeaderOut::set_sentfromid(uint32_t value) {
+  _internal_set_sentfromid(value);
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackHeaderOut.sentFromID)
+}
+
+// uint32 dataSize = 3;
+inline void PackHeaderOut::clear_datasize() {
+  _impl_.datasize_ = 0u;
+}
+inline uint32_t PackHeaderOut::_internal_datasize() const {
+  return _impl_.datasize_;
+}
+inline uint32_t PackHeaderOut::datasize() const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackHeaderOut.dataSize)
+  return _internal_datasize();
+}
+inline void PackHeaderOut::_internal_set_datasize(uint32_t value) {
+  
+  _impl_.datasize_ = value;
+}
+inline void PackHeaderOut::set_datasize(uint32_t value) {
+  _internal_set_datasize(value);
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackHeaderOut.dataSize)
+}
+
+// -------------------------------------------------------------------
+
 // PackA0
 
 // string name = 1;
 inline void PackA0::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& PackA0::name() const {
+inline const std::string& PackA0::name() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA0.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void PackA0::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA0::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA0.name)
 }
-inline void PackA0::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA0.name)
+inline std::string* PackA0::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA0.name)
+  return _s;
 }
-inline void PackA0::set_name(const char* value, size_t size) {
+inline const std::string& PackA0::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PackA0::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA0.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA0::mutable_name() {
+inline std::string* PackA0::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA0.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA0::release_name() {
+inline std::string* PackA0::release_name() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA0.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void PackA0::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void PackA0::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA0.name)
 }
 
 // string pwd = 2;
 inline void PackA0::clear_pwd() {
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pwd_.ClearToEmpty();
 }
-inline const ::std::string& PackA0::pwd() const {
+inline const std::string& PackA0::pwd() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA0.pwd)
-  return pwd_.GetNoArena();
+  return _internal_pwd();
 }
-inline void PackA0::set_pwd(const ::std::string& value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA0::set_pwd(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwd_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA0.pwd)
 }
-inline void PackA0::set_pwd(const char* value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA0.pwd)
+inline std::string* PackA0::mutable_pwd() {
+  std::string* _s = _internal_mutable_pwd();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA0.pwd)
+  return _s;
+}
+inline const std::string& PackA0::_internal_pwd() const {
+  return _impl_.pwd_.Get();
 }
-inline void PackA0::set_pwd(const char* value, size_t size) {
+inline void PackA0::_internal_set_pwd(const std::string& value) {
   
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA0.pwd)
+  _impl_.pwd_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA0::mutable_pwd() {
+inline std::string* PackA0::_internal_mutable_pwd() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA0.pwd)
-  return pwd_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwd_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA0::release_pwd() {
+inline std::string* PackA0::release_pwd() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA0.pwd)
-  
-  return pwd_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwd_.Release();
 }
-inline void PackA0::set_allocated_pwd(::std::string* pwd) {
-  if (pwd != NULL) {
+inline void PackA0::set_allocated_pwd(std::string* pwd) {
+  if (pwd != nullptr) {
     
   } else {
     
   }
-  pwd_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwd);
+  _impl_.pwd_.SetAllocated(pwd, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwd_.IsDefault()) {
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA0.pwd)
 }
 
 // string email = 3;
 inline void PackA0::clear_email() {
-  email_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.email_.ClearToEmpty();
 }
-inline const ::std::string& PackA0::email() const {
+inline const std::string& PackA0::email() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA0.email)
-  return email_.GetNoArena();
+  return _internal_email();
 }
-inline void PackA0::set_email(const ::std::string& value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA0::set_email(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.email_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA0.email)
 }
-inline void PackA0::set_email(const char* value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA0.email)
+inline std::string* PackA0::mutable_email() {
+  std::string* _s = _internal_mutable_email();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA0.email)
+  return _s;
 }
-inline void PackA0::set_email(const char* value, size_t size) {
+inline const std::string& PackA0::_internal_email() const {
+  return _impl_.email_.Get();
+}
+inline void PackA0::_internal_set_email(const std::string& value) {
   
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA0.email)
+  _impl_.email_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA0::mutable_email() {
+inline std::string* PackA0::_internal_mutable_email() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA0.email)
-  return email_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.email_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA0::release_email() {
+inline std::string* PackA0::release_email() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA0.email)
-  
-  return email_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.email_.Release();
 }
-inline void PackA0::set_allocated_email(::std::string* email) {
-  if (email != NULL) {
+inline void PackA0::set_allocated_email(std::string* email) {
+  if (email != nullptr) {
     
   } else {
     
   }
-  email_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), email);
+  _impl_.email_.SetAllocated(email, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.email_.IsDefault()) {
+    _impl_.email_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA0.email)
 }
 
@@ -3474,117 +6253,141 @@ inline void PackA0::set_allocated_email(::std::string* email) {
 
 // string pwdToken = 1;
 inline void PackA1::clear_pwdtoken() {
-  pwdtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pwdtoken_.ClearToEmpty();
 }
-inline const ::std::string& PackA1::pwdtoken() const {
+inline const std::string& PackA1::pwdtoken() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA1.pwdToken)
-  return pwdtoken_.GetNoArena();
+  return _internal_pwdtoken();
 }
-inline void PackA1::set_pwdtoken(const ::std::string& value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA1::set_pwdtoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwdtoken_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA1.pwdToken)
 }
-inline void PackA1::set_pwdtoken(const char* value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA1.pwdToken)
+inline std::string* PackA1::mutable_pwdtoken() {
+  std::string* _s = _internal_mutable_pwdtoken();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA1.pwdToken)
+  return _s;
+}
+inline const std::string& PackA1::_internal_pwdtoken() const {
+  return _impl_.pwdtoken_.Get();
 }
-inline void PackA1::set_pwdtoken(const char* value, size_t size) {
+inline void PackA1::_internal_set_pwdtoken(const std::string& value) {
   
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA1.pwdToken)
+  _impl_.pwdtoken_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA1::mutable_pwdtoken() {
+inline std::string* PackA1::_internal_mutable_pwdtoken() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA1.pwdToken)
-  return pwdtoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwdtoken_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA1::release_pwdtoken() {
+inline std::string* PackA1::release_pwdtoken() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA1.pwdToken)
-  
-  return pwdtoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwdtoken_.Release();
 }
-inline void PackA1::set_allocated_pwdtoken(::std::string* pwdtoken) {
-  if (pwdtoken != NULL) {
+inline void PackA1::set_allocated_pwdtoken(std::string* pwdtoken) {
+  if (pwdtoken != nullptr) {
     
   } else {
     
   }
-  pwdtoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwdtoken);
+  _impl_.pwdtoken_.SetAllocated(pwdtoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwdtoken_.IsDefault()) {
+    _impl_.pwdtoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA1.pwdToken)
 }
 
 // uint32 eID = 2;
 inline void PackA1::clear_eid() {
-  eid_ = 0u;
+  _impl_.eid_ = 0u;
+}
+inline uint32_t PackA1::_internal_eid() const {
+  return _impl_.eid_;
 }
-inline ::google::protobuf::uint32 PackA1::eid() const {
+inline uint32_t PackA1::eid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA1.eID)
-  return eid_;
+  return _internal_eid();
 }
-inline void PackA1::set_eid(::google::protobuf::uint32 value) {
+inline void PackA1::_internal_set_eid(uint32_t value) {
   
-  eid_ = value;
+  _impl_.eid_ = value;
+}
+inline void PackA1::set_eid(uint32_t value) {
+  _internal_set_eid(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA1.eID)
 }
 
 // uint32 deviceID = 3;
 inline void PackA1::clear_deviceid() {
-  deviceid_ = 0u;
+  _impl_.deviceid_ = 0u;
+}
+inline uint32_t PackA1::_internal_deviceid() const {
+  return _impl_.deviceid_;
 }
-inline ::google::protobuf::uint32 PackA1::deviceid() const {
+inline uint32_t PackA1::deviceid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA1.deviceID)
-  return deviceid_;
+  return _internal_deviceid();
 }
-inline void PackA1::set_deviceid(::google::protobuf::uint32 value) {
+inline void PackA1::_internal_set_deviceid(uint32_t value) {
   
-  deviceid_ = value;
+  _impl_.deviceid_ = value;
+}
+inline void PackA1::set_deviceid(uint32_t value) {
+  _internal_set_deviceid(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA1.deviceID)
 }
 
 // string msg = 4;
 inline void PackA1::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackA1::msg() const {
+inline const std::string& PackA1::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA1.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackA1::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA1::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA1.msg)
 }
-inline void PackA1::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA1.msg)
+inline std::string* PackA1::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA1.msg)
+  return _s;
 }
-inline void PackA1::set_msg(const char* value, size_t size) {
+inline const std::string& PackA1::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void PackA1::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA1.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA1::mutable_msg() {
+inline std::string* PackA1::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA1.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA1::release_msg() {
+inline std::string* PackA1::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA1.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackA1::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackA1::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA1.msg)
 }
 
@@ -3594,73 +6397,91 @@ inline void PackA1::set_allocated_msg(::std::string* msg) {
 
 // uint32 eID = 1;
 inline void PackA2::clear_eid() {
-  eid_ = 0u;
+  _impl_.eid_ = 0u;
 }
-inline ::google::protobuf::uint32 PackA2::eid() const {
+inline uint32_t PackA2::_internal_eid() const {
+  return _impl_.eid_;
+}
+inline uint32_t PackA2::eid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA2.eID)
-  return eid_;
+  return _internal_eid();
 }
-inline void PackA2::set_eid(::google::protobuf::uint32 value) {
+inline void PackA2::_internal_set_eid(uint32_t value) {
   
-  eid_ = value;
+  _impl_.eid_ = value;
+}
+inline void PackA2::set_eid(uint32_t value) {
+  _internal_set_eid(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA2.eID)
 }
 
 // string pwdToken = 2;
 inline void PackA2::clear_pwdtoken() {
-  pwdtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pwdtoken_.ClearToEmpty();
 }
-inline const ::std::string& PackA2::pwdtoken() const {
+inline const std::string& PackA2::pwdtoken() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA2.pwdToken)
-  return pwdtoken_.GetNoArena();
+  return _internal_pwdtoken();
 }
-inline void PackA2::set_pwdtoken(const ::std::string& value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA2::set_pwdtoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwdtoken_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA2.pwdToken)
 }
-inline void PackA2::set_pwdtoken(const char* value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA2.pwdToken)
+inline std::string* PackA2::mutable_pwdtoken() {
+  std::string* _s = _internal_mutable_pwdtoken();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA2.pwdToken)
+  return _s;
+}
+inline const std::string& PackA2::_internal_pwdtoken() const {
+  return _impl_.pwdtoken_.Get();
 }
-inline void PackA2::set_pwdtoken(const char* value, size_t size) {
+inline void PackA2::_internal_set_pwdtoken(const std::string& value) {
   
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA2.pwdToken)
+  _impl_.pwdtoken_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA2::mutable_pwdtoken() {
+inline std::string* PackA2::_internal_mutable_pwdtoken() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA2.pwdToken)
-  return pwdtoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwdtoken_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA2::release_pwdtoken() {
+inline std::string* PackA2::release_pwdtoken() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA2.pwdToken)
-  
-  return pwdtoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwdtoken_.Release();
 }
-inline void PackA2::set_allocated_pwdtoken(::std::string* pwdtoken) {
-  if (pwdtoken != NULL) {
+inline void PackA2::set_allocated_pwdtoken(std::string* pwdtoken) {
+  if (pwdtoken != nullptr) {
     
   } else {
     
   }
-  pwdtoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwdtoken);
+  _impl_.pwdtoken_.SetAllocated(pwdtoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwdtoken_.IsDefault()) {
+    _impl_.pwdtoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA2.pwdToken)
 }
 
 // int32 deviceID = 3;
 inline void PackA2::clear_deviceid() {
-  deviceid_ = 0;
+  _impl_.deviceid_ = 0;
+}
+inline int32_t PackA2::_internal_deviceid() const {
+  return _impl_.deviceid_;
 }
-inline ::google::protobuf::int32 PackA2::deviceid() const {
+inline int32_t PackA2::deviceid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA2.deviceID)
-  return deviceid_;
+  return _internal_deviceid();
 }
-inline void PackA2::set_deviceid(::google::protobuf::int32 value) {
+inline void PackA2::_internal_set_deviceid(int32_t value) {
   
-  deviceid_ = value;
+  _impl_.deviceid_ = value;
+}
+inline void PackA2::set_deviceid(int32_t value) {
+  _internal_set_deviceid(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA2.deviceID)
 }
 
@@ -3670,103 +6491,121 @@ inline void PackA2::set_deviceid(::google::protobuf::int32 value) {
 
 // string name = 1;
 inline void PackA3::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& PackA3::name() const {
+inline const std::string& PackA3::name() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA3.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void PackA3::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA3::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA3.name)
 }
-inline void PackA3::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA3.name)
+inline std::string* PackA3::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA3.name)
+  return _s;
 }
-inline void PackA3::set_name(const char* value, size_t size) {
+inline const std::string& PackA3::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PackA3::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA3.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA3::mutable_name() {
+inline std::string* PackA3::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA3.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA3::release_name() {
+inline std::string* PackA3::release_name() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA3.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void PackA3::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void PackA3::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA3.name)
 }
 
 // string pwd = 2;
 inline void PackA3::clear_pwd() {
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pwd_.ClearToEmpty();
 }
-inline const ::std::string& PackA3::pwd() const {
+inline const std::string& PackA3::pwd() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA3.pwd)
-  return pwd_.GetNoArena();
+  return _internal_pwd();
 }
-inline void PackA3::set_pwd(const ::std::string& value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA3::set_pwd(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwd_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA3.pwd)
 }
-inline void PackA3::set_pwd(const char* value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA3.pwd)
+inline std::string* PackA3::mutable_pwd() {
+  std::string* _s = _internal_mutable_pwd();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA3.pwd)
+  return _s;
+}
+inline const std::string& PackA3::_internal_pwd() const {
+  return _impl_.pwd_.Get();
 }
-inline void PackA3::set_pwd(const char* value, size_t size) {
+inline void PackA3::_internal_set_pwd(const std::string& value) {
   
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA3.pwd)
+  _impl_.pwd_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA3::mutable_pwd() {
+inline std::string* PackA3::_internal_mutable_pwd() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA3.pwd)
-  return pwd_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwd_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA3::release_pwd() {
+inline std::string* PackA3::release_pwd() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA3.pwd)
-  
-  return pwd_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwd_.Release();
 }
-inline void PackA3::set_allocated_pwd(::std::string* pwd) {
-  if (pwd != NULL) {
+inline void PackA3::set_allocated_pwd(std::string* pwd) {
+  if (pwd != nullptr) {
     
   } else {
     
   }
-  pwd_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwd);
+  _impl_.pwd_.SetAllocated(pwd, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwd_.IsDefault()) {
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA3.pwd)
 }
 
 // uint32 deviceID = 3;
 inline void PackA3::clear_deviceid() {
-  deviceid_ = 0u;
+  _impl_.deviceid_ = 0u;
+}
+inline uint32_t PackA3::_internal_deviceid() const {
+  return _impl_.deviceid_;
 }
-inline ::google::protobuf::uint32 PackA3::deviceid() const {
+inline uint32_t PackA3::deviceid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA3.deviceID)
-  return deviceid_;
+  return _internal_deviceid();
 }
-inline void PackA3::set_deviceid(::google::protobuf::uint32 value) {
+inline void PackA3::_internal_set_deviceid(uint32_t value) {
   
-  deviceid_ = value;
+  _impl_.deviceid_ = value;
+}
+inline void PackA3::set_deviceid(uint32_t value) {
+  _internal_set_deviceid(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA3.deviceID)
 }
 
@@ -3776,45 +6615,51 @@ inline void PackA3::set_deviceid(::google::protobuf::uint32 value) {
 
 // string email = 1;
 inline void PackA4::clear_email() {
-  email_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.email_.ClearToEmpty();
 }
-inline const ::std::string& PackA4::email() const {
+inline const std::string& PackA4::email() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA4.email)
-  return email_.GetNoArena();
+  return _internal_email();
 }
-inline void PackA4::set_email(const ::std::string& value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA4::set_email(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.email_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA4.email)
 }
-inline void PackA4::set_email(const char* value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA4.email)
+inline std::string* PackA4::mutable_email() {
+  std::string* _s = _internal_mutable_email();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA4.email)
+  return _s;
 }
-inline void PackA4::set_email(const char* value, size_t size) {
+inline const std::string& PackA4::_internal_email() const {
+  return _impl_.email_.Get();
+}
+inline void PackA4::_internal_set_email(const std::string& value) {
   
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA4.email)
+  _impl_.email_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA4::mutable_email() {
+inline std::string* PackA4::_internal_mutable_email() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA4.email)
-  return email_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.email_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA4::release_email() {
+inline std::string* PackA4::release_email() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA4.email)
-  
-  return email_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.email_.Release();
 }
-inline void PackA4::set_allocated_email(::std::string* email) {
-  if (email != NULL) {
+inline void PackA4::set_allocated_email(std::string* email) {
+  if (email != nullptr) {
     
   } else {
     
   }
-  email_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), email);
+  _impl_.email_.SetAllocated(email, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.email_.IsDefault()) {
+    _impl_.email_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA4.email)
 }
 
@@ -3824,59 +6669,71 @@ inline void PackA4::set_allocated_email(::std::string* email) {
 
 // bool success = 1;
 inline void PackA5::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool PackA5::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool PackA5::success() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA5.success)
-  return success_;
+  return _internal_success();
 }
-inline void PackA5::set_success(bool value) {
+inline void PackA5::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void PackA5::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA5.success)
 }
 
 // string msg = 2;
 inline void PackA5::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackA5::msg() const {
+inline const std::string& PackA5::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA5.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackA5::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA5::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA5.msg)
 }
-inline void PackA5::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA5.msg)
+inline std::string* PackA5::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA5.msg)
+  return _s;
+}
+inline const std::string& PackA5::_internal_msg() const {
+  return _impl_.msg_.Get();
 }
-inline void PackA5::set_msg(const char* value, size_t size) {
+inline void PackA5::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA5.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA5::mutable_msg() {
+inline std::string* PackA5::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA5.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA5::release_msg() {
+inline std::string* PackA5::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA5.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackA5::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackA5::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA5.msg)
 }
 
@@ -3886,45 +6743,51 @@ inline void PackA5::set_allocated_msg(::std::string* msg) {
 
 // string pwdResetToken = 1;
 inline void PackA6::clear_pwdresettoken() {
-  pwdresettoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pwdresettoken_.ClearToEmpty();
 }
-inline const ::std::string& PackA6::pwdresettoken() const {
+inline const std::string& PackA6::pwdresettoken() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA6.pwdResetToken)
-  return pwdresettoken_.GetNoArena();
+  return _internal_pwdresettoken();
 }
-inline void PackA6::set_pwdresettoken(const ::std::string& value) {
-  
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA6::set_pwdresettoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwdresettoken_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA6.pwdResetToken)
 }
-inline void PackA6::set_pwdresettoken(const char* value) {
-  
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA6.pwdResetToken)
+inline std::string* PackA6::mutable_pwdresettoken() {
+  std::string* _s = _internal_mutable_pwdresettoken();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA6.pwdResetToken)
+  return _s;
 }
-inline void PackA6::set_pwdresettoken(const char* value, size_t size) {
+inline const std::string& PackA6::_internal_pwdresettoken() const {
+  return _impl_.pwdresettoken_.Get();
+}
+inline void PackA6::_internal_set_pwdresettoken(const std::string& value) {
   
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA6.pwdResetToken)
+  _impl_.pwdresettoken_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA6::mutable_pwdresettoken() {
+inline std::string* PackA6::_internal_mutable_pwdresettoken() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA6.pwdResetToken)
-  return pwdresettoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwdresettoken_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA6::release_pwdresettoken() {
+inline std::string* PackA6::release_pwdresettoken() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA6.pwdResetToken)
-  
-  return pwdresettoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwdresettoken_.Release();
 }
-inline void PackA6::set_allocated_pwdresettoken(::std::string* pwdresettoken) {
-  if (pwdresettoken != NULL) {
+inline void PackA6::set_allocated_pwdresettoken(std::string* pwdresettoken) {
+  if (pwdresettoken != nullptr) {
     
   } else {
     
   }
-  pwdresettoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwdresettoken);
+  _impl_.pwdresettoken_.SetAllocated(pwdresettoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwdresettoken_.IsDefault()) {
+    _impl_.pwdresettoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA6.pwdResetToken)
 }
 
@@ -3934,59 +6797,71 @@ inline void PackA6::set_allocated_pwdresettoken(::std::string* pwdresettoken) {
 
 // bool success = 1;
 inline void PackA7::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool PackA7::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool PackA7::success() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA7.success)
-  return success_;
+  return _internal_success();
 }
-inline void PackA7::set_success(bool value) {
+inline void PackA7::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void PackA7::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA7.success)
 }
 
 // string msg = 2;
 inline void PackA7::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackA7::msg() const {
+inline const std::string& PackA7::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA7.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackA7::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA7::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA7.msg)
 }
-inline void PackA7::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA7.msg)
+inline std::string* PackA7::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA7.msg)
+  return _s;
+}
+inline const std::string& PackA7::_internal_msg() const {
+  return _impl_.msg_.Get();
 }
-inline void PackA7::set_msg(const char* value, size_t size) {
+inline void PackA7::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA7.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA7::mutable_msg() {
+inline std::string* PackA7::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA7.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA7::release_msg() {
+inline std::string* PackA7::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA7.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackA7::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackA7::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA7.msg)
 }
 
@@ -3996,89 +6871,101 @@ inline void PackA7::set_allocated_msg(::std::string* msg) {
 
 // string pwdResetToken = 1;
 inline void PackA8::clear_pwdresettoken() {
-  pwdresettoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pwdresettoken_.ClearToEmpty();
 }
-inline const ::std::string& PackA8::pwdresettoken() const {
+inline const std::string& PackA8::pwdresettoken() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA8.pwdResetToken)
-  return pwdresettoken_.GetNoArena();
+  return _internal_pwdresettoken();
 }
-inline void PackA8::set_pwdresettoken(const ::std::string& value) {
-  
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA8::set_pwdresettoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwdresettoken_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA8.pwdResetToken)
 }
-inline void PackA8::set_pwdresettoken(const char* value) {
-  
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA8.pwdResetToken)
+inline std::string* PackA8::mutable_pwdresettoken() {
+  std::string* _s = _internal_mutable_pwdresettoken();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA8.pwdResetToken)
+  return _s;
 }
-inline void PackA8::set_pwdresettoken(const char* value, size_t size) {
+inline const std::string& PackA8::_internal_pwdresettoken() const {
+  return _impl_.pwdresettoken_.Get();
+}
+inline void PackA8::_internal_set_pwdresettoken(const std::string& value) {
   
-  pwdresettoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA8.pwdResetToken)
+  _impl_.pwdresettoken_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA8::mutable_pwdresettoken() {
+inline std::string* PackA8::_internal_mutable_pwdresettoken() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA8.pwdResetToken)
-  return pwdresettoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwdresettoken_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA8::release_pwdresettoken() {
+inline std::string* PackA8::release_pwdresettoken() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA8.pwdResetToken)
-  
-  return pwdresettoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwdresettoken_.Release();
 }
-inline void PackA8::set_allocated_pwdresettoken(::std::string* pwdresettoken) {
-  if (pwdresettoken != NULL) {
+inline void PackA8::set_allocated_pwdresettoken(std::string* pwdresettoken) {
+  if (pwdresettoken != nullptr) {
     
   } else {
     
   }
-  pwdresettoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwdresettoken);
+  _impl_.pwdresettoken_.SetAllocated(pwdresettoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwdresettoken_.IsDefault()) {
+    _impl_.pwdresettoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA8.pwdResetToken)
 }
 
 // string pwd = 2;
 inline void PackA8::clear_pwd() {
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pwd_.ClearToEmpty();
 }
-inline const ::std::string& PackA8::pwd() const {
+inline const std::string& PackA8::pwd() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA8.pwd)
-  return pwd_.GetNoArena();
+  return _internal_pwd();
 }
-inline void PackA8::set_pwd(const ::std::string& value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA8::set_pwd(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwd_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA8.pwd)
 }
-inline void PackA8::set_pwd(const char* value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA8.pwd)
+inline std::string* PackA8::mutable_pwd() {
+  std::string* _s = _internal_mutable_pwd();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA8.pwd)
+  return _s;
+}
+inline const std::string& PackA8::_internal_pwd() const {
+  return _impl_.pwd_.Get();
 }
-inline void PackA8::set_pwd(const char* value, size_t size) {
+inline void PackA8::_internal_set_pwd(const std::string& value) {
   
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA8.pwd)
+  _impl_.pwd_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA8::mutable_pwd() {
+inline std::string* PackA8::_internal_mutable_pwd() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA8.pwd)
-  return pwd_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwd_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA8::release_pwd() {
+inline std::string* PackA8::release_pwd() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA8.pwd)
-  
-  return pwd_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwd_.Release();
 }
-inline void PackA8::set_allocated_pwd(::std::string* pwd) {
-  if (pwd != NULL) {
+inline void PackA8::set_allocated_pwd(std::string* pwd) {
+  if (pwd != nullptr) {
     
   } else {
     
   }
-  pwd_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwd);
+  _impl_.pwd_.SetAllocated(pwd, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwd_.IsDefault()) {
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA8.pwd)
 }
 
@@ -4088,117 +6975,141 @@ inline void PackA8::set_allocated_pwd(::std::string* pwd) {
 
 // string pwdToken = 1;
 inline void PackA9::clear_pwdtoken() {
-  pwdtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pwdtoken_.ClearToEmpty();
 }
-inline const ::std::string& PackA9::pwdtoken() const {
+inline const std::string& PackA9::pwdtoken() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA9.pwdToken)
-  return pwdtoken_.GetNoArena();
+  return _internal_pwdtoken();
 }
-inline void PackA9::set_pwdtoken(const ::std::string& value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA9::set_pwdtoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwdtoken_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA9.pwdToken)
 }
-inline void PackA9::set_pwdtoken(const char* value) {
-  
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA9.pwdToken)
+inline std::string* PackA9::mutable_pwdtoken() {
+  std::string* _s = _internal_mutable_pwdtoken();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA9.pwdToken)
+  return _s;
 }
-inline void PackA9::set_pwdtoken(const char* value, size_t size) {
+inline const std::string& PackA9::_internal_pwdtoken() const {
+  return _impl_.pwdtoken_.Get();
+}
+inline void PackA9::_internal_set_pwdtoken(const std::string& value) {
   
-  pwdtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA9.pwdToken)
+  _impl_.pwdtoken_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA9::mutable_pwdtoken() {
+inline std::string* PackA9::_internal_mutable_pwdtoken() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA9.pwdToken)
-  return pwdtoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwdtoken_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA9::release_pwdtoken() {
+inline std::string* PackA9::release_pwdtoken() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA9.pwdToken)
-  
-  return pwdtoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwdtoken_.Release();
 }
-inline void PackA9::set_allocated_pwdtoken(::std::string* pwdtoken) {
-  if (pwdtoken != NULL) {
+inline void PackA9::set_allocated_pwdtoken(std::string* pwdtoken) {
+  if (pwdtoken != nullptr) {
     
   } else {
     
   }
-  pwdtoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwdtoken);
+  _impl_.pwdtoken_.SetAllocated(pwdtoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwdtoken_.IsDefault()) {
+    _impl_.pwdtoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA9.pwdToken)
 }
 
 // uint32 eID = 2;
 inline void PackA9::clear_eid() {
-  eid_ = 0u;
+  _impl_.eid_ = 0u;
 }
-inline ::google::protobuf::uint32 PackA9::eid() const {
+inline uint32_t PackA9::_internal_eid() const {
+  return _impl_.eid_;
+}
+inline uint32_t PackA9::eid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA9.eID)
-  return eid_;
+  return _internal_eid();
 }
-inline void PackA9::set_eid(::google::protobuf::uint32 value) {
+inline void PackA9::_internal_set_eid(uint32_t value) {
   
-  eid_ = value;
+  _impl_.eid_ = value;
+}
+inline void PackA9::set_eid(uint32_t value) {
+  _internal_set_eid(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA9.eID)
 }
 
 // uint32 deviceID = 3;
 inline void PackA9::clear_deviceid() {
-  deviceid_ = 0u;
+  _impl_.deviceid_ = 0u;
 }
-inline ::google::protobuf::uint32 PackA9::deviceid() const {
+inline uint32_t PackA9::_internal_deviceid() const {
+  return _impl_.deviceid_;
+}
+inline uint32_t PackA9::deviceid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA9.deviceID)
-  return deviceid_;
+  return _internal_deviceid();
 }
-inline void PackA9::set_deviceid(::google::protobuf::uint32 value) {
+inline void PackA9::_internal_set_deviceid(uint32_t value) {
   
-  deviceid_ = value;
+  _impl_.deviceid_ = value;
+}
+inline void PackA9::set_deviceid(uint32_t value) {
+  _internal_set_deviceid(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA9.deviceID)
 }
 
 // string msg = 4;
 inline void PackA9::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackA9::msg() const {
+inline const std::string& PackA9::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackA9.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackA9::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackA9::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackA9.msg)
 }
-inline void PackA9::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackA9.msg)
+inline std::string* PackA9::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA9.msg)
+  return _s;
+}
+inline const std::string& PackA9::_internal_msg() const {
+  return _impl_.msg_.Get();
 }
-inline void PackA9::set_msg(const char* value, size_t size) {
+inline void PackA9::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackA9.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackA9::mutable_msg() {
+inline std::string* PackA9::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackA9.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackA9::release_msg() {
+inline std::string* PackA9::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackA9.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackA9::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackA9::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackA9.msg)
 }
 
@@ -4208,45 +7119,51 @@ inline void PackA9::set_allocated_msg(::std::string* msg) {
 
 // string email = 1;
 inline void PackB0::clear_email() {
-  email_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.email_.ClearToEmpty();
 }
-inline const ::std::string& PackB0::email() const {
+inline const std::string& PackB0::email() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackB0.email)
-  return email_.GetNoArena();
+  return _internal_email();
 }
-inline void PackB0::set_email(const ::std::string& value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackB0::set_email(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.email_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackB0.email)
 }
-inline void PackB0::set_email(const char* value) {
-  
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB0.email)
+inline std::string* PackB0::mutable_email() {
+  std::string* _s = _internal_mutable_email();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB0.email)
+  return _s;
 }
-inline void PackB0::set_email(const char* value, size_t size) {
+inline const std::string& PackB0::_internal_email() const {
+  return _impl_.email_.Get();
+}
+inline void PackB0::_internal_set_email(const std::string& value) {
   
-  email_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB0.email)
+  _impl_.email_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackB0::mutable_email() {
+inline std::string* PackB0::_internal_mutable_email() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB0.email)
-  return email_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.email_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackB0::release_email() {
+inline std::string* PackB0::release_email() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackB0.email)
-  
-  return email_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.email_.Release();
 }
-inline void PackB0::set_allocated_email(::std::string* email) {
-  if (email != NULL) {
+inline void PackB0::set_allocated_email(std::string* email) {
+  if (email != nullptr) {
     
   } else {
     
   }
-  email_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), email);
+  _impl_.email_.SetAllocated(email, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.email_.IsDefault()) {
+    _impl_.email_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB0.email)
 }
 
@@ -4256,59 +7173,71 @@ inline void PackB0::set_allocated_email(::std::string* email) {
 
 // bool success = 1;
 inline void PackB1::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool PackB1::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool PackB1::success() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackB1.success)
-  return success_;
+  return _internal_success();
 }
-inline void PackB1::set_success(bool value) {
+inline void PackB1::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void PackB1::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackB1.success)
 }
 
 // string msg = 2;
 inline void PackB1::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackB1::msg() const {
+inline const std::string& PackB1::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackB1.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackB1::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackB1::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackB1.msg)
 }
-inline void PackB1::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB1.msg)
+inline std::string* PackB1::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB1.msg)
+  return _s;
+}
+inline const std::string& PackB1::_internal_msg() const {
+  return _impl_.msg_.Get();
 }
-inline void PackB1::set_msg(const char* value, size_t size) {
+inline void PackB1::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB1.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackB1::mutable_msg() {
+inline std::string* PackB1::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB1.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackB1::release_msg() {
+inline std::string* PackB1::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackB1.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackB1::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackB1::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB1.msg)
 }
 
@@ -4318,45 +7247,51 @@ inline void PackB1::set_allocated_msg(::std::string* msg) {
 
 // string emailToken = 1;
 inline void PackB2::clear_emailtoken() {
-  emailtoken_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.emailtoken_.ClearToEmpty();
 }
-inline const ::std::string& PackB2::emailtoken() const {
+inline const std::string& PackB2::emailtoken() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackB2.emailToken)
-  return emailtoken_.GetNoArena();
+  return _internal_emailtoken();
 }
-inline void PackB2::set_emailtoken(const ::std::string& value) {
-  
-  emailtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackB2::set_emailtoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.emailtoken_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackB2.emailToken)
 }
-inline void PackB2::set_emailtoken(const char* value) {
-  
-  emailtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB2.emailToken)
+inline std::string* PackB2::mutable_emailtoken() {
+  std::string* _s = _internal_mutable_emailtoken();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB2.emailToken)
+  return _s;
 }
-inline void PackB2::set_emailtoken(const char* value, size_t size) {
+inline const std::string& PackB2::_internal_emailtoken() const {
+  return _impl_.emailtoken_.Get();
+}
+inline void PackB2::_internal_set_emailtoken(const std::string& value) {
   
-  emailtoken_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB2.emailToken)
+  _impl_.emailtoken_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackB2::mutable_emailtoken() {
+inline std::string* PackB2::_internal_mutable_emailtoken() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB2.emailToken)
-  return emailtoken_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.emailtoken_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackB2::release_emailtoken() {
+inline std::string* PackB2::release_emailtoken() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackB2.emailToken)
-  
-  return emailtoken_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.emailtoken_.Release();
 }
-inline void PackB2::set_allocated_emailtoken(::std::string* emailtoken) {
-  if (emailtoken != NULL) {
+inline void PackB2::set_allocated_emailtoken(std::string* emailtoken) {
+  if (emailtoken != nullptr) {
     
   } else {
     
   }
-  emailtoken_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), emailtoken);
+  _impl_.emailtoken_.SetAllocated(emailtoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.emailtoken_.IsDefault()) {
+    _impl_.emailtoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB2.emailToken)
 }
 
@@ -4366,59 +7301,71 @@ inline void PackB2::set_allocated_emailtoken(::std::string* emailtoken) {
 
 // bool success = 1;
 inline void PackB3::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool PackB3::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool PackB3::success() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackB3.success)
-  return success_;
+  return _internal_success();
 }
-inline void PackB3::set_success(bool value) {
+inline void PackB3::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void PackB3::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackB3.success)
 }
 
 // string msg = 2;
 inline void PackB3::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackB3::msg() const {
+inline const std::string& PackB3::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackB3.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackB3::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackB3::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackB3.msg)
 }
-inline void PackB3::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB3.msg)
+inline std::string* PackB3::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB3.msg)
+  return _s;
+}
+inline const std::string& PackB3::_internal_msg() const {
+  return _impl_.msg_.Get();
 }
-inline void PackB3::set_msg(const char* value, size_t size) {
+inline void PackB3::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB3.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackB3::mutable_msg() {
+inline std::string* PackB3::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB3.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackB3::release_msg() {
+inline std::string* PackB3::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackB3.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackB3::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackB3::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB3.msg)
 }
 
@@ -4432,89 +7379,101 @@ inline void PackB3::set_allocated_msg(::std::string* msg) {
 
 // string verifiedEmail = 1;
 inline void PackB5::clear_verifiedemail() {
-  verifiedemail_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.verifiedemail_.ClearToEmpty();
 }
-inline const ::std::string& PackB5::verifiedemail() const {
+inline const std::string& PackB5::verifiedemail() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackB5.verifiedEmail)
-  return verifiedemail_.GetNoArena();
+  return _internal_verifiedemail();
 }
-inline void PackB5::set_verifiedemail(const ::std::string& value) {
-  
-  verifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackB5::set_verifiedemail(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.verifiedemail_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackB5.verifiedEmail)
 }
-inline void PackB5::set_verifiedemail(const char* value) {
-  
-  verifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB5.verifiedEmail)
+inline std::string* PackB5::mutable_verifiedemail() {
+  std::string* _s = _internal_mutable_verifiedemail();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB5.verifiedEmail)
+  return _s;
 }
-inline void PackB5::set_verifiedemail(const char* value, size_t size) {
+inline const std::string& PackB5::_internal_verifiedemail() const {
+  return _impl_.verifiedemail_.Get();
+}
+inline void PackB5::_internal_set_verifiedemail(const std::string& value) {
   
-  verifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB5.verifiedEmail)
+  _impl_.verifiedemail_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackB5::mutable_verifiedemail() {
+inline std::string* PackB5::_internal_mutable_verifiedemail() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB5.verifiedEmail)
-  return verifiedemail_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.verifiedemail_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackB5::release_verifiedemail() {
+inline std::string* PackB5::release_verifiedemail() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackB5.verifiedEmail)
-  
-  return verifiedemail_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.verifiedemail_.Release();
 }
-inline void PackB5::set_allocated_verifiedemail(::std::string* verifiedemail) {
-  if (verifiedemail != NULL) {
+inline void PackB5::set_allocated_verifiedemail(std::string* verifiedemail) {
+  if (verifiedemail != nullptr) {
     
   } else {
     
   }
-  verifiedemail_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), verifiedemail);
+  _impl_.verifiedemail_.SetAllocated(verifiedemail, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.verifiedemail_.IsDefault()) {
+    _impl_.verifiedemail_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB5.verifiedEmail)
 }
 
 // string unverifiedEmail = 2;
 inline void PackB5::clear_unverifiedemail() {
-  unverifiedemail_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.unverifiedemail_.ClearToEmpty();
 }
-inline const ::std::string& PackB5::unverifiedemail() const {
+inline const std::string& PackB5::unverifiedemail() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackB5.unverifiedEmail)
-  return unverifiedemail_.GetNoArena();
+  return _internal_unverifiedemail();
 }
-inline void PackB5::set_unverifiedemail(const ::std::string& value) {
-  
-  unverifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackB5::set_unverifiedemail(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.unverifiedemail_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackB5.unverifiedEmail)
 }
-inline void PackB5::set_unverifiedemail(const char* value) {
-  
-  unverifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackB5.unverifiedEmail)
+inline std::string* PackB5::mutable_unverifiedemail() {
+  std::string* _s = _internal_mutable_unverifiedemail();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB5.unverifiedEmail)
+  return _s;
+}
+inline const std::string& PackB5::_internal_unverifiedemail() const {
+  return _impl_.unverifiedemail_.Get();
 }
-inline void PackB5::set_unverifiedemail(const char* value, size_t size) {
+inline void PackB5::_internal_set_unverifiedemail(const std::string& value) {
   
-  unverifiedemail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackB5.unverifiedEmail)
+  _impl_.unverifiedemail_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackB5::mutable_unverifiedemail() {
+inline std::string* PackB5::_internal_mutable_unverifiedemail() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackB5.unverifiedEmail)
-  return unverifiedemail_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.unverifiedemail_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackB5::release_unverifiedemail() {
+inline std::string* PackB5::release_unverifiedemail() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackB5.unverifiedEmail)
-  
-  return unverifiedemail_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.unverifiedemail_.Release();
 }
-inline void PackB5::set_allocated_unverifiedemail(::std::string* unverifiedemail) {
-  if (unverifiedemail != NULL) {
+inline void PackB5::set_allocated_unverifiedemail(std::string* unverifiedemail) {
+  if (unverifiedemail != nullptr) {
     
   } else {
     
   }
-  unverifiedemail_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), unverifiedemail);
+  _impl_.unverifiedemail_.SetAllocated(unverifiedemail, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.unverifiedemail_.IsDefault()) {
+    _impl_.unverifiedemail_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackB5.unverifiedEmail)
 }
 
@@ -4524,15 +7483,21 @@ inline void PackB5::set_allocated_unverifiedemail(::std::string* unverifiedemail
 
 // uint32 eID = 1;
 inline void PackC0::clear_eid() {
-  eid_ = 0u;
+  _impl_.eid_ = 0u;
+}
+inline uint32_t PackC0::_internal_eid() const {
+  return _impl_.eid_;
 }
-inline ::google::protobuf::uint32 PackC0::eid() const {
+inline uint32_t PackC0::eid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackC0.eID)
-  return eid_;
+  return _internal_eid();
 }
-inline void PackC0::set_eid(::google::protobuf::uint32 value) {
+inline void PackC0::_internal_set_eid(uint32_t value) {
   
-  eid_ = value;
+  _impl_.eid_ = value;
+}
+inline void PackC0::set_eid(uint32_t value) {
+  _internal_set_eid(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackC0.eID)
 }
 
@@ -4542,45 +7507,51 @@ inline void PackC0::set_eid(::google::protobuf::uint32 value) {
 
 // string name = 1;
 inline void PackC1::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& PackC1::name() const {
+inline const std::string& PackC1::name() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackC1.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void PackC1::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackC1::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackC1.name)
 }
-inline void PackC1::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackC1.name)
+inline std::string* PackC1::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackC1.name)
+  return _s;
 }
-inline void PackC1::set_name(const char* value, size_t size) {
+inline const std::string& PackC1::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PackC1::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackC1.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackC1::mutable_name() {
+inline std::string* PackC1::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackC1.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackC1::release_name() {
+inline std::string* PackC1::release_name() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackC1.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void PackC1::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void PackC1::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackC1.name)
 }
 
@@ -4594,45 +7565,51 @@ inline void PackC1::set_allocated_name(::std::string* name) {
 
 // string name = 1;
 inline void PackC3::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& PackC3::name() const {
+inline const std::string& PackC3::name() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackC3.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void PackC3::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackC3::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackC3.name)
 }
-inline void PackC3::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackC3.name)
+inline std::string* PackC3::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackC3.name)
+  return _s;
+}
+inline const std::string& PackC3::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void PackC3::set_name(const char* value, size_t size) {
+inline void PackC3::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackC3.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackC3::mutable_name() {
+inline std::string* PackC3::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackC3.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackC3::release_name() {
+inline std::string* PackC3::release_name() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackC3.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void PackC3::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void PackC3::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackC3.name)
 }
 
@@ -4646,221 +7623,251 @@ inline void PackC3::set_allocated_name(::std::string* name) {
 
 // string folderObjKey = 1;
 inline void PackD1::clear_folderobjkey() {
-  folderobjkey_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.folderobjkey_.ClearToEmpty();
 }
-inline const ::std::string& PackD1::folderobjkey() const {
+inline const std::string& PackD1::folderobjkey() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackD1.folderObjKey)
-  return folderobjkey_.GetNoArena();
+  return _internal_folderobjkey();
 }
-inline void PackD1::set_folderobjkey(const ::std::string& value) {
-  
-  folderobjkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackD1::set_folderobjkey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.folderobjkey_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackD1.folderObjKey)
 }
-inline void PackD1::set_folderobjkey(const char* value) {
-  
-  folderobjkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackD1.folderObjKey)
+inline std::string* PackD1::mutable_folderobjkey() {
+  std::string* _s = _internal_mutable_folderobjkey();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.folderObjKey)
+  return _s;
 }
-inline void PackD1::set_folderobjkey(const char* value, size_t size) {
+inline const std::string& PackD1::_internal_folderobjkey() const {
+  return _impl_.folderobjkey_.Get();
+}
+inline void PackD1::_internal_set_folderobjkey(const std::string& value) {
   
-  folderobjkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackD1.folderObjKey)
+  _impl_.folderobjkey_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackD1::mutable_folderobjkey() {
+inline std::string* PackD1::_internal_mutable_folderobjkey() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.folderObjKey)
-  return folderobjkey_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.folderobjkey_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackD1::release_folderobjkey() {
+inline std::string* PackD1::release_folderobjkey() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackD1.folderObjKey)
-  
-  return folderobjkey_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.folderobjkey_.Release();
 }
-inline void PackD1::set_allocated_folderobjkey(::std::string* folderobjkey) {
-  if (folderobjkey != NULL) {
+inline void PackD1::set_allocated_folderobjkey(std::string* folderobjkey) {
+  if (folderobjkey != nullptr) {
     
   } else {
     
   }
-  folderobjkey_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), folderobjkey);
+  _impl_.folderobjkey_.SetAllocated(folderobjkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.folderobjkey_.IsDefault()) {
+    _impl_.folderobjkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackD1.folderObjKey)
 }
 
 // string accessKeyID = 2;
 inline void PackD1::clear_accesskeyid() {
-  accesskeyid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.accesskeyid_.ClearToEmpty();
 }
-inline const ::std::string& PackD1::accesskeyid() const {
+inline const std::string& PackD1::accesskeyid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackD1.accessKeyID)
-  return accesskeyid_.GetNoArena();
+  return _internal_accesskeyid();
 }
-inline void PackD1::set_accesskeyid(const ::std::string& value) {
-  
-  accesskeyid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackD1::set_accesskeyid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.accesskeyid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackD1.accessKeyID)
 }
-inline void PackD1::set_accesskeyid(const char* value) {
-  
-  accesskeyid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackD1.accessKeyID)
+inline std::string* PackD1::mutable_accesskeyid() {
+  std::string* _s = _internal_mutable_accesskeyid();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.accessKeyID)
+  return _s;
+}
+inline const std::string& PackD1::_internal_accesskeyid() const {
+  return _impl_.accesskeyid_.Get();
 }
-inline void PackD1::set_accesskeyid(const char* value, size_t size) {
+inline void PackD1::_internal_set_accesskeyid(const std::string& value) {
   
-  accesskeyid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackD1.accessKeyID)
+  _impl_.accesskeyid_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackD1::mutable_accesskeyid() {
+inline std::string* PackD1::_internal_mutable_accesskeyid() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.accessKeyID)
-  return accesskeyid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.accesskeyid_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackD1::release_accesskeyid() {
+inline std::string* PackD1::release_accesskeyid() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackD1.accessKeyID)
-  
-  return accesskeyid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.accesskeyid_.Release();
 }
-inline void PackD1::set_allocated_accesskeyid(::std::string* accesskeyid) {
-  if (accesskeyid != NULL) {
+inline void PackD1::set_allocated_accesskeyid(std::string* accesskeyid) {
+  if (accesskeyid != nullptr) {
     
   } else {
     
   }
-  accesskeyid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), accesskeyid);
+  _impl_.accesskeyid_.SetAllocated(accesskeyid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.accesskeyid_.IsDefault()) {
+    _impl_.accesskeyid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackD1.accessKeyID)
 }
 
 // string accessKey = 3;
 inline void PackD1::clear_accesskey() {
-  accesskey_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.accesskey_.ClearToEmpty();
 }
-inline const ::std::string& PackD1::accesskey() const {
+inline const std::string& PackD1::accesskey() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackD1.accessKey)
-  return accesskey_.GetNoArena();
+  return _internal_accesskey();
 }
-inline void PackD1::set_accesskey(const ::std::string& value) {
-  
-  accesskey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackD1::set_accesskey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.accesskey_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackD1.accessKey)
 }
-inline void PackD1::set_accesskey(const char* value) {
-  
-  accesskey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackD1.accessKey)
+inline std::string* PackD1::mutable_accesskey() {
+  std::string* _s = _internal_mutable_accesskey();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.accessKey)
+  return _s;
 }
-inline void PackD1::set_accesskey(const char* value, size_t size) {
+inline const std::string& PackD1::_internal_accesskey() const {
+  return _impl_.accesskey_.Get();
+}
+inline void PackD1::_internal_set_accesskey(const std::string& value) {
   
-  accesskey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackD1.accessKey)
+  _impl_.accesskey_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackD1::mutable_accesskey() {
+inline std::string* PackD1::_internal_mutable_accesskey() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.accessKey)
-  return accesskey_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.accesskey_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackD1::release_accesskey() {
+inline std::string* PackD1::release_accesskey() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackD1.accessKey)
-  
-  return accesskey_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.accesskey_.Release();
 }
-inline void PackD1::set_allocated_accesskey(::std::string* accesskey) {
-  if (accesskey != NULL) {
+inline void PackD1::set_allocated_accesskey(std::string* accesskey) {
+  if (accesskey != nullptr) {
     
   } else {
     
   }
-  accesskey_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), accesskey);
+  _impl_.accesskey_.SetAllocated(accesskey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.accesskey_.IsDefault()) {
+    _impl_.accesskey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackD1.accessKey)
 }
 
 // string sessionKey = 4;
 inline void PackD1::clear_sessionkey() {
-  sessionkey_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.sessionkey_.ClearToEmpty();
 }
-inline const ::std::string& PackD1::sessionkey() const {
+inline const std::string& PackD1::sessionkey() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackD1.sessionKey)
-  return sessionkey_.GetNoArena();
+  return _internal_sessionkey();
 }
-inline void PackD1::set_sessionkey(const ::std::string& value) {
-  
-  sessionkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackD1::set_sessionkey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sessionkey_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackD1.sessionKey)
 }
-inline void PackD1::set_sessionkey(const char* value) {
-  
-  sessionkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackD1.sessionKey)
+inline std::string* PackD1::mutable_sessionkey() {
+  std::string* _s = _internal_mutable_sessionkey();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.sessionKey)
+  return _s;
+}
+inline const std::string& PackD1::_internal_sessionkey() const {
+  return _impl_.sessionkey_.Get();
 }
-inline void PackD1::set_sessionkey(const char* value, size_t size) {
+inline void PackD1::_internal_set_sessionkey(const std::string& value) {
   
-  sessionkey_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackD1.sessionKey)
+  _impl_.sessionkey_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackD1::mutable_sessionkey() {
+inline std::string* PackD1::_internal_mutable_sessionkey() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.sessionKey)
-  return sessionkey_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.sessionkey_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackD1::release_sessionkey() {
+inline std::string* PackD1::release_sessionkey() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackD1.sessionKey)
-  
-  return sessionkey_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.sessionkey_.Release();
 }
-inline void PackD1::set_allocated_sessionkey(::std::string* sessionkey) {
-  if (sessionkey != NULL) {
+inline void PackD1::set_allocated_sessionkey(std::string* sessionkey) {
+  if (sessionkey != nullptr) {
     
   } else {
     
   }
-  sessionkey_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), sessionkey);
+  _impl_.sessionkey_.SetAllocated(sessionkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sessionkey_.IsDefault()) {
+    _impl_.sessionkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackD1.sessionKey)
 }
 
 // string msg = 5;
 inline void PackD1::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackD1::msg() const {
+inline const std::string& PackD1::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackD1.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackD1::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackD1::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackD1.msg)
 }
-inline void PackD1::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackD1.msg)
+inline std::string* PackD1::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.msg)
+  return _s;
 }
-inline void PackD1::set_msg(const char* value, size_t size) {
+inline const std::string& PackD1::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void PackD1::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackD1.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackD1::mutable_msg() {
+inline std::string* PackD1::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackD1.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackD1::release_msg() {
+inline std::string* PackD1::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackD1.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackD1::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackD1::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackD1.msg)
 }
 
@@ -4878,15 +7885,21 @@ inline void PackD1::set_allocated_msg(::std::string* msg) {
 
 // bool hasResume = 1;
 inline void PackD4::clear_hasresume() {
-  hasresume_ = false;
+  _impl_.hasresume_ = false;
+}
+inline bool PackD4::_internal_hasresume() const {
+  return _impl_.hasresume_;
 }
 inline bool PackD4::hasresume() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackD4.hasResume)
-  return hasresume_;
+  return _internal_hasresume();
 }
-inline void PackD4::set_hasresume(bool value) {
+inline void PackD4::_internal_set_hasresume(bool value) {
   
-  hasresume_ = value;
+  _impl_.hasresume_ = value;
+}
+inline void PackD4::set_hasresume(bool value) {
+  _internal_set_hasresume(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackD4.hasResume)
 }
 
@@ -4894,187 +7907,342 @@ inline void PackD4::set_hasresume(bool value) {
 
 // PackE0
 
+// uint32 pageSize = 1;
+inline void PackE0::clear_pagesize() {
+  _impl_.pagesize_ = 0u;
+}
+inline uint32_t PackE0::_internal_pagesize() const {
+  return _impl_.pagesize_;
+}
+inline uint32_t PackE0::pagesize() const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE0.pageSize)
+  return _internal_pagesize();
+}
+inline void PackE0::_internal_set_pagesize(uint32_t value) {
+  
+  _impl_.pagesize_ = value;
+}
+inline void PackE0::set_pagesize(uint32_t value) {
+  _internal_set_pagesize(value);
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE0.pageSize)
+}
+
+// uint32 cursor = 2;
+inline void PackE0::clear_cursor() {
+  _impl_.cursor_ = 0u;
+}
+inline uint32_t PackE0::_internal_cursor() const {
+  return _impl_.cursor_;
+}
+inline uint32_t PackE0::cursor() const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE0.cursor)
+  return _internal_cursor();
+}
+inline void PackE0::_internal_set_cursor(uint32_t value) {
+  
+  _impl_.cursor_ = value;
+}
+inline void PackE0::set_cursor(uint32_t value) {
+  _internal_set_cursor(value);
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE0.cursor)
+}
+
 // -------------------------------------------------------------------
 
 // PackE1
 
 // repeated uint32 employeeEIDs = 1;
+inline int PackE1::_internal_employeeeids_size() const {
+  return _impl_.employeeeids_.size();
+}
 inline int PackE1::employeeeids_size() const {
-  return employeeeids_.size();
+  return _internal_employeeeids_size();
 }
 inline void PackE1::clear_employeeeids() {
-  employeeeids_.Clear();
+  _impl_.employeeeids_.Clear();
+}
+inline uint32_t PackE1::_internal_employeeeids(int index) const {
+  return _impl_.employeeeids_.Get(index);
 }
-inline ::google::protobuf::uint32 PackE1::employeeeids(int index) const {
+inline uint32_t PackE1::employeeeids(int index) const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.employeeEIDs)
-  return employeeeids_.Get(index);
+  return _internal_employeeeids(index);
 }
-inline void PackE1::set_employeeeids(int index, ::google::protobuf::uint32 value) {
-  employeeeids_.Set(index, value);
+inline void PackE1::set_employeeeids(int index, uint32_t value) {
+  _impl_.employeeeids_.Set(index, value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.employeeEIDs)
 }
-inline void PackE1::add_employeeeids(::google::protobuf::uint32 value) {
-  employeeeids_.Add(value);
+inline void PackE1::_internal_add_employeeeids(uint32_t value) {
+  _impl_.employeeeids_.Add(value);
+}
+inline void PackE1::add_employeeeids(uint32_t value) {
+  _internal_add_employeeeids(value);
   // @@protoc_insertion_point(field_add:ProtobufPackets.PackE1.employeeEIDs)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PackE1::_internal_employeeeids() const {
+  return _impl_.employeeeids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 PackE1::employeeeids() const {
   // @@protoc_insertion_point(field_list:ProtobufPackets.PackE1.employeeEIDs)
-  return employeeeids_;
+  return _internal_employeeeids();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PackE1::_internal_mutable_employeeeids() {
+  return &_impl_.employeeeids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 PackE1::mutable_employeeeids() {
   // @@protoc_insertion_point(field_mutable_list:ProtobufPackets.PackE1.employeeEIDs)
-  return &employeeeids_;
+  return _internal_mutable_employeeeids();
 }
 
 // repeated uint32 unacceptedEIDs = 2;
+inline int PackE1::_internal_unacceptedeids_size() const {
+  return _impl_.unacceptedeids_.size();
+}
 inline int PackE1::unacceptedeids_size() const {
-  return unacceptedeids_.size();
+  return _internal_unacceptedeids_size();
 }
 inline void PackE1::clear_unacceptedeids() {
-  unacceptedeids_.Clear();
+  _impl_.unacceptedeids_.Clear();
 }
-inline ::google::protobuf::uint32 PackE1::unacceptedeids(int index) const {
+inline uint32_t PackE1::_internal_unacceptedeids(int index) const {
+  return _impl_.unacceptedeids_.Get(index);
+}
+inline uint32_t PackE1::unacceptedeids(int index) const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.unacceptedEIDs)
-  return unacceptedeids_.Get(index);
+  return _internal_unacceptedeids(index);
 }
-inline void PackE1::set_unacceptedeids(int index, ::google::protobuf::uint32 value) {
-  unacceptedeids_.Set(index, value);
+inline void PackE1::set_unacceptedeids(int index, uint32_t value) {
+  _impl_.unacceptedeids_.Set(index, value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.unacceptedEIDs)
 }
-inline void PackE1::add_unacceptedeids(::google::protobuf::uint32 value) {
-  unacceptedeids_.Add(value);
+inline void PackE1::_internal_add_unacceptedeids(uint32_t value) {
+  _impl_.unacceptedeids_.Add(value);
+}
+inline void PackE1::add_unacceptedeids(uint32_t value) {
+  _internal_add_unacceptedeids(value);
   // @@protoc_insertion_point(field_add:ProtobufPackets.PackE1.unacceptedEIDs)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PackE1::_internal_unacceptedeids() const {
+  return _impl_.unacceptedeids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 PackE1::unacceptedeids() const {
   // @@protoc_insertion_point(field_list:ProtobufPackets.PackE1.unacceptedEIDs)
-  return unacceptedeids_;
+  return _internal_unacceptedeids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PackE1::_internal_mutable_unacceptedeids() {
+  return &_impl_.unacceptedeids_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 PackE1::mutable_unacceptedeids() {
   // @@protoc_insertion_point(field_mutable_list:ProtobufPackets.PackE1.unacceptedEIDs)
-  return &unacceptedeids_;
+  return _internal_mutable_unacceptedeids();
 }
 
 // repeated uint32 acceptedEIDs = 3;
+inline int PackE1::_internal_acceptedeids_size() const {
+  return _impl_.acceptedeids_.size();
+}
 inline int PackE1::acceptedeids_size() const {
-  return acceptedeids_.size();
+  return _internal_acceptedeids_size();
 }
 inline void PackE1::clear_acceptedeids() {
-  acceptedeids_.Clear();
+  _impl_.acceptedeids_.Clear();
+}
+inline uint32_t PackE1::_internal_acceptedeids(int index) const {
+  return _impl_.acceptedeids_.Get(index);
 }
-inline ::google::protobuf::uint32 PackE1::acceptedeids(int index) const {
+inline uint32_t PackE1::acceptedeids(int index) const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.acceptedEIDs)
-  return acceptedeids_.Get(index);
+  return _internal_acceptedeids(index);
 }
-inline void PackE1::set_acceptedeids(int index, ::google::protobuf::uint32 value) {
-  acceptedeids_.Set(index, value);
+inline void PackE1::set_acceptedeids(int index, uint32_t value) {
+  _impl_.acceptedeids_.Set(index, value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.acceptedEIDs)
 }
-inline void PackE1::add_acceptedeids(::google::protobuf::uint32 value) {
-  acceptedeids_.Add(value);
+inline void PackE1::_internal_add_acceptedeids(uint32_t value) {
+  _impl_.acceptedeids_.Add(value);
+}
+inline void PackE1::add_acceptedeids(uint32_t value) {
+  _internal_add_acceptedeids(value);
   // @@protoc_insertion_point(field_add:ProtobufPackets.PackE1.acceptedEIDs)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PackE1::_internal_acceptedeids() const {
+  return _impl_.acceptedeids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 PackE1::acceptedeids() const {
   // @@protoc_insertion_point(field_list:ProtobufPackets.PackE1.acceptedEIDs)
-  return acceptedeids_;
+  return _internal_acceptedeids();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PackE1::_internal_mutable_acceptedeids() {
+  return &_impl_.acceptedeids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 PackE1::mutable_acceptedeids() {
   // @@protoc_insertion_point(field_mutable_list:ProtobufPackets.PackE1.acceptedEIDs)
-  return &acceptedeids_;
+  return _internal_mutable_acceptedeids();
 }
 
 // bool success = 4;
 inline void PackE1::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool PackE1::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool PackE1::success() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.success)
-  return success_;
+  return _internal_success();
 }
-inline void PackE1::set_success(bool value) {
+inline void PackE1::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void PackE1::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.success)
 }
 
 // string msg = 5;
 inline void PackE1::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackE1::msg() const {
+inline const std::string& PackE1::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackE1::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackE1::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.msg)
 }
-inline void PackE1::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackE1.msg)
+inline std::string* PackE1::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE1.msg)
+  return _s;
 }
-inline void PackE1::set_msg(const char* value, size_t size) {
+inline const std::string& PackE1::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void PackE1::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackE1.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackE1::mutable_msg() {
+inline std::string* PackE1::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE1.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackE1::release_msg() {
+inline std::string* PackE1::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackE1.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackE1::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackE1::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackE1.msg)
 }
 
+// uint32 nextCursor = 6;
+inline void PackE1::clear_nextcursor() {
+  _impl_.nextcursor_ = 0u;
+}
+inline uint32_t PackE1::_internal_nextcursor() const {
+  return _impl_.nextcursor_;
+}
+inline uint32_t PackE1::nextcursor() const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.nextCursor)
+  return _internal_nextcursor();
+}
+inline void PackE1::_internal_set_nextcursor(uint32_t value) {
+  
+  _impl_.nextcursor_ = value;
+}
+inline void PackE1::set_nextcursor(uint32_t value) {
+  _internal_set_nextcursor(value);
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.nextCursor)
+}
+
+// bool morePages = 7;
+inline void PackE1::clear_morepages() {
+  _impl_.morepages_ = false;
+}
+inline bool PackE1::_internal_morepages() const {
+  return _impl_.morepages_;
+}
+inline bool PackE1::morepages() const {
+  // @@protoc_insertion_point(field_get:ProtobufPackets.PackE1.morePages)
+  return _internal_morepages();
+}
+inline void PackE1::_internal_set_morepages(bool value) {
+  
+  _impl_.morepages_ = value;
+}
+inline void PackE1::set_morepages(bool value) {
+  _internal_set_morepages(value);
+  // @@protoc_insertion_point(field_set:ProtobufPackets.PackE1.morePages)
+}
+
 // -------------------------------------------------------------------
 
 // PackE2
 
 // uint32 eID = 1;
 inline void PackE2::clear_eid() {
-  eid_ = 0u;
+  _impl_.eid_ = 0u;
 }
-inline ::google::protobuf::uint32 PackE2::eid() const {
+inline uint32_t PackE2::_internal_eid() const {
+  return _impl_.eid_;
+}
+inline uint32_t PackE2::eid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE2.eID)
-  return eid_;
+  return _internal_eid();
 }
-inline void PackE2::set_eid(::google::protobuf::uint32 value) {
+inline void PackE2::_internal_set_eid(uint32_t value) {
   
-  eid_ = value;
+  _impl_.eid_ = value;
+}
+inline void PackE2::set_eid(uint32_t value) {
+  _internal_set_eid(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE2.eID)
 }
 
 // int32 aState = 2;
 inline void PackE2::clear_astate() {
-  astate_ = 0;
+  _impl_.astate_ = 0;
 }
-inline ::google::protobuf::int32 PackE2::astate() const {
+inline int32_t PackE2::_internal_astate() const {
+  return _impl_.astate_;
+}
+inline int32_t PackE2::astate() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE2.aState)
-  return astate_;
+  return _internal_astate();
 }
-inline void PackE2::set_astate(::google::protobuf::int32 value) {
+inline void PackE2::_internal_set_astate(int32_t value) {
   
-  astate_ = value;
+  _impl_.astate_ = value;
+}
+inline void PackE2::set_astate(int32_t value) {
+  _internal_set_astate(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE2.aState)
 }
 
@@ -5084,73 +8252,91 @@ inline void PackE2::set_astate(::google::protobuf::int32 value) {
 
 // bool success = 1;
 inline void PackE3::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool PackE3::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool PackE3::success() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE3.success)
-  return success_;
+  return _internal_success();
 }
-inline void PackE3::set_success(bool value) {
+inline void PackE3::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void PackE3::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE3.success)
 }
 
 // string msg = 2;
 inline void PackE3::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackE3::msg() const {
+inline const std::string& PackE3::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE3.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackE3::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackE3::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE3.msg)
 }
-inline void PackE3::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackE3.msg)
+inline std::string* PackE3::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE3.msg)
+  return _s;
+}
+inline const std::string& PackE3::_internal_msg() const {
+  return _impl_.msg_.Get();
 }
-inline void PackE3::set_msg(const char* value, size_t size) {
+inline void PackE3::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackE3.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackE3::mutable_msg() {
+inline std::string* PackE3::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE3.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackE3::release_msg() {
+inline std::string* PackE3::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackE3.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackE3::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackE3::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackE3.msg)
 }
 
 // uint32 eID = 3;
 inline void PackE3::clear_eid() {
-  eid_ = 0u;
+  _impl_.eid_ = 0u;
+}
+inline uint32_t PackE3::_internal_eid() const {
+  return _impl_.eid_;
 }
-inline ::google::protobuf::uint32 PackE3::eid() const {
+inline uint32_t PackE3::eid() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE3.eID)
-  return eid_;
+  return _internal_eid();
 }
-inline void PackE3::set_eid(::google::protobuf::uint32 value) {
+inline void PackE3::_internal_set_eid(uint32_t value) {
   
-  eid_ = value;
+  _impl_.eid_ = value;
+}
+inline void PackE3::set_eid(uint32_t value) {
+  _internal_set_eid(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE3.eID)
 }
 
@@ -5164,59 +8350,71 @@ inline void PackE3::set_eid(::google::protobuf::uint32 value) {
 
 // int32 aState = 1;
 inline void PackE5::clear_astate() {
-  astate_ = 0;
+  _impl_.astate_ = 0;
+}
+inline int32_t PackE5::_internal_astate() const {
+  return _impl_.astate_;
 }
-inline ::google::protobuf::int32 PackE5::astate() const {
+inline int32_t PackE5::astate() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE5.aState)
-  return astate_;
+  return _internal_astate();
 }
-inline void PackE5::set_astate(::google::protobuf::int32 value) {
+inline void PackE5::_internal_set_astate(int32_t value) {
   
-  astate_ = value;
+  _impl_.astate_ = value;
+}
+inline void PackE5::set_astate(int32_t value) {
+  _internal_set_astate(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE5.aState)
 }
 
 // string msg = 2;
 inline void PackE5::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackE5::msg() const {
+inline const std::string& PackE5::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE5.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackE5::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackE5::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE5.msg)
 }
-inline void PackE5::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackE5.msg)
+inline std::string* PackE5::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE5.msg)
+  return _s;
 }
-inline void PackE5::set_msg(const char* value, size_t size) {
+inline const std::string& PackE5::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void PackE5::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackE5.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackE5::mutable_msg() {
+inline std::string* PackE5::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE5.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackE5::release_msg() {
+inline std::string* PackE5::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackE5.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackE5::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackE5::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackE5.msg)
 }
 
@@ -5226,15 +8424,21 @@ inline void PackE5::set_allocated_msg(::std::string* msg) {
 
 // bool accept = 1;
 inline void PackE6::clear_accept() {
-  accept_ = false;
+  _impl_.accept_ = false;
+}
+inline bool PackE6::_internal_accept() const {
+  return _impl_.accept_;
 }
 inline bool PackE6::accept() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE6.accept)
-  return accept_;
+  return _internal_accept();
 }
-inline void PackE6::set_accept(bool value) {
+inline void PackE6::_internal_set_accept(bool value) {
   
-  accept_ = value;
+  _impl_.accept_ = value;
+}
+inline void PackE6::set_accept(bool value) {
+  _internal_set_accept(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE6.accept)
 }
 
@@ -5244,63 +8448,81 @@ inline void PackE6::set_accept(bool value) {
 
 // bool success = 1;
 inline void PackE7::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool PackE7::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool PackE7::success() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE7.success)
-  return success_;
+  return _internal_success();
 }
-inline void PackE7::set_success(bool value) {
+inline void PackE7::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void PackE7::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE7.success)
 }
 
 // string msg = 2;
 inline void PackE7::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& PackE7::msg() const {
+inline const std::string& PackE7::msg() const {
   // @@protoc_insertion_point(field_get:ProtobufPackets.PackE7.msg)
-  return msg_.GetNoArena();
+  return _internal_msg();
 }
-inline void PackE7::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackE7::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ProtobufPackets.PackE7.msg)
 }
-inline void PackE7::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:ProtobufPackets.PackE7.msg)
+inline std::string* PackE7::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE7.msg)
+  return _s;
+}
+inline const std::string& PackE7::_internal_msg() const {
+  return _impl_.msg_.Get();
 }
-inline void PackE7::set_msg(const char* value, size_t size) {
+inline void PackE7::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:ProtobufPackets.PackE7.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PackE7::mutable_msg() {
+inline std::string* PackE7::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:ProtobufPackets.PackE7.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PackE7::release_msg() {
+inline std::string* PackE7::release_msg() {
   // @@protoc_insertion_point(field_release:ProtobufPackets.PackE7.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void PackE7::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void PackE7::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ProtobufPackets.PackE7.msg)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -5368,9 +8590,9 @@ inline void PackE7::set_allocated_msg(::std::string* msg) {
 
 // @@protoc_insertion_point(namespace_scope)
 
-
 }  // namespace ProtobufPackets
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_BBPacks_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_BBPacks_2eproto
@@ -0,0 +1,204 @@
+#include "PwdTokenWriter.h"
+#include "DBPool.h"
+#include <cstring>
+
+PwdTokenWriter::PwdTokenWriter(DBPool * dbPool)
+	:dbPool(dbPool), stopping(false)
+{
+	stats = PwdTokenWriterStats();
+	flushThread = std::thread(&PwdTokenWriter::flushLoop, this);
+}
+
+uint64_t PwdTokenWriter::getGeneration(IDType eID)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+	auto generationIter = generations.find(eID);
+	return generationIter != generations.end() ? generationIter->second : 0;
+}
+
+bool PwdTokenWriter::queue(IDType eID, DeviceID devID, const BYTE * tokenHash, OTL_BIGINT tokenTime, uint64_t generation)
+{
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		auto generationIter = generations.find(eID);
+		if (generationIter != generations.end() && generationIter->second != generation) {
+			stats.discarded++;
+			return false;
+		}
+		uint64_t key = MakeKey(eID, devID);
+		if (pending.find(key) != pending.end()) {
+			stats.coalesced++;
+		}
+		else if (pending.empty())
+		{
+			oldestQueued = std::chrono::steady_clock::now();
+		}
+		PendingToken& pendingToken = pending[key];
+		pendingToken.eID = eID;
+		pendingToken.devID = devID;
+		std::memcpy(pendingToken.tokenHash, tokenHash, TOKEN_SIZE);
+		pendingToken.tokenTime = tokenTime;
+		stats.queued++;
+		//The first token starts the delay timer, a full batch ends it early
+		if (pending.size() != 1 && pending.size() < MAX_BATCH_SIZE) {
+			return true;
+		}
+	}
+	queueCondition.notify_one();
+	return true;
+}
+
+bool PwdTokenWriter::find(IDType eID, DeviceID devID, BYTE * tokenHash, OTL_BIGINT & tokenTime)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+	uint64_t key = MakeKey(eID, devID);
+	auto pendingIter = pending.find(key);
+	if (pendingIter == pending.end()) {
+		pendingIter = flushing.find(key);
+		if (pendingIter == flushing.end()) {
+			return false;
+		}
+	}
+	std::memcpy(tokenHash, pendingIter->second.tokenHash, TOKEN_SIZE);
+	tokenTime = pendingIter->second.tokenTime;
+	return true;
+}
+
+void PwdTokenWriter::discard(IDType eID)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+	generations[eID]++;
+	for (auto pendingIter = pending.begin(); pendingIter != pending.end();) {
+		if (pendingIter->second.eID == eID) {
+			pendingIter = pending.erase(pendingIter);
+			stats.discarded++;
+		}
+		else
+		{
+			++pendingIter;
+		}
+	}
+	for (auto flushIter = flushing.begin(); flushIter != flushing.end(); ++flushIter) {
+		if (flushIter->second.eID == eID) {
+			discardedFlushing.insert(eID);
+			break;
+		}
+	}
+}
+
+PwdTokenWriterStats PwdTokenWriter::getStats()
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+	PwdTokenWriterStats writerStats = stats;
+	writerStats.pending = pending.size() + flushing.size();
+	return writerStats;
+}
+
+void PwdTokenWriter::flushLoop()
+{
+	std::unique_lock<std::mutex> lock(queueMutex);
+	while (!stopping) {
+		if (pending.empty()) {
+			queueCondition.wait(lock, [this]() { return stopping || !pending.empty(); });
+		}
+		else
+		{
+			queueCondition.wait_until(lock, oldestQueued + std::chrono::milliseconds(MAX_DELAY_MILLIS),
+				[this]() { return stopping || pending.size() >= MAX_BATCH_SIZE; });
+		}
+		if (stopping) {
+			return;
+		}
+		if (pending.empty()) {
+			continue;
+		}
+		lock.unlock();
+		flush();
+		lock.lock();
+	}
+}
+
+bool PwdTokenWriter::flush()
+{
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		if (pending.empty()) {
+			return true;
+		}
+	}
+	//Leased before the batch is taken so nothing is held while waiting for a connection
+	DBLease dbLease(dbPool);
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		flushing.swap(pending);
+	}
+	bool success = dbLease.get()->execute<STMT_SET_PWD_TOKENS>([this](StatementStream<STMT_SET_PWD_TOKENS>& stmt) {
+		for (auto flushIter = flushing.begin(); flushIter != flushing.end(); ++flushIter) {
+			PendingToken& pendingToken = flushIter->second;
+			stmt.bind(pendingToken.eID, pendingToken.devID, pendingToken.tokenHash, pendingToken.tokenTime);
+		}
+	});
+	std::vector <PendingToken> undo;
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		if (success) {
+			stats.flushes++;
+			stats.rowsWritten += flushing.size();
+		}
+		else
+		{
+			stats.failedFlushes++;
+			if (pending.empty()) {
+				oldestQueued = std::chrono::steady_clock::now();
+			}
+		}
+		for (auto flushIter = flushing.begin(); flushIter != flushing.end(); ++flushIter) {
+			if (discardedFlushing.find(flushIter->second.eID) != discardedFlushing.end()) {
+				if (success) {
+					undo.push_back(flushIter->second);
+				}
+				stats.discarded++;
+			}
+			else if (!success)
+			{
+				//emplace keeps any rotation queued while the batch was out, it is newer
+				pending.emplace(flushIter->first, flushIter->second);
+			}
+		}
+		discardedFlushing.clear();
+		flushing.clear();
+	}
+	//Only the rows this batch wrote, anything written for the device since is left alone
+	for (int i = 0; i < undo.size(); i++) {
+		dbLease.get()->execute<STMT_REMOVE_PWD_TOKEN>([&](StatementStream<STMT_REMOVE_PWD_TOKEN>& stmt) {
+			stmt.bind(undo.at(i).eID, undo.at(i).devID, undo.at(i).tokenHash);
+		});
+	}
+	return success;
+}
+
+void PwdTokenWriter::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		stopping = true;
+	}
+	queueCondition.notify_all();
+	if (flushThread.joinable()) {
+		flushThread.join();
+	}
+	for (int attempt = 0; attempt < SHUTDOWN_ATTEMPTS; attempt++) {
+		if (flush()) {
+			break;
+		}
+	}
+	std::lock_guard<std::mutex> lock(queueMutex);
+	if (!pending.empty()) {
+		std::cerr << "Could not write " << pending.size() << " queued pwdTokens, those devices will have to log in with a password" << std::endl;
+	}
+}
+
+PwdTokenWriter::~PwdTokenWriter()
+{
+	stop();
+}
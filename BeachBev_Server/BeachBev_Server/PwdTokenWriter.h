@@ -0,0 +1,107 @@
+#pragma once
+#include "stdafx.h"
+#include "EmployeeManager.h"
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+class DBPool;
+
+struct PwdTokenWriterStats {
+	size_t pending;
+	uint64_t queued;
+	//Rotations that replaced one still waiting to be written for the same device
+	uint64_t coalesced;
+	uint64_t flushes;
+	uint64_t rowsWritten;
+	uint64_t failedFlushes;
+	uint64_t discarded;
+};
+
+/// <summary>
+/// Write-behind queue for the pwdToken rotated on every token login. Rotations are coalesced per
+/// (eID, deviceID) and written as one array-bound REPLACE once MAX_BATCH_SIZE devices are waiting or the
+/// oldest has waited MAX_DELAY_MILLIS. Queued tokens are served by find until they are written.
+/// </summary>
+class PwdTokenWriter
+{
+public:
+	static const int MAX_BATCH_SIZE = 256;
+	static const int MAX_DELAY_MILLIS = 100;
+	//Attempts stop makes to write what is left before giving up on it
+	static const int SHUTDOWN_ATTEMPTS = 3;
+
+	PwdTokenWriter(DBPool* dbPool);
+
+	/// <summary>
+	/// Stamp a token login takes before it reads the stored token, handed back to queue
+	/// </summary>
+	uint64_t getGeneration(IDType eID);
+
+	/// <summary>
+	/// Queues a rotated token unless eID was discarded since generation was taken, in which case the
+	/// token that was checked has been revoked
+	/// </summary>
+	bool queue(IDType eID, DeviceID devID, const BYTE* tokenHash, OTL_BIGINT tokenTime, uint64_t generation);
+
+	/// <summary>
+	/// Copies a token that is queued or being written for the device
+	/// </summary>
+	/// <returns>False if nothing is waiting and the database holds the current token</returns>
+	bool find(IDType eID, DeviceID devID, BYTE* tokenHash, OTL_BIGINT& tokenTime);
+
+	/// <summary>
+	/// Drops every queued token for eID. Rows of eID in a batch already being written are deleted again
+	/// once that write returns, so a DELETE run afterwards cannot be overtaken by a queued write.
+	/// Never waits on the flush, callers may be holding a lease the flush needs.
+	/// </summary>
+	void discard(IDType eID);
+
+	PwdTokenWriterStats getStats();
+
+	/// <summary>
+	/// Writes everything still queued and joins the flush thread
+	/// </summary>
+	void stop();
+
+	~PwdTokenWriter();
+
+private:
+	struct PendingToken {
+		IDType eID;
+		DeviceID devID;
+		BYTE tokenHash[TOKEN_SIZE];
+		OTL_BIGINT tokenTime;
+	};
+
+	static uint64_t MakeKey(IDType eID, DeviceID devID) {
+		return ((uint64_t)eID << 16) | devID;
+	}
+
+	void flushLoop();
+
+	/// <summary>
+	/// Moves pending into flushing and writes it, failed rows go back to pending unless a newer rotation replaced
+	/// them or their eID was discarded. Only the flush thread, or stop once it has joined, calls this.
+	/// </summary>
+	bool flush();
+
+	DBPool* dbPool;
+	std::unordered_map <uint64_t, PendingToken> pending;
+	//The batch being written, still visible to find until the write returns
+	std::unordered_map <uint64_t, PendingToken> flushing;
+	//eIDs discarded while they had rows in flushing, those rows are deleted after the write
+	std::unordered_set <IDType> discardedFlushing;
+	//Times each eID was discarded, one entry per employee whose tokens were ever cleared
+	std::unordered_map <IDType, uint64_t> generations;
+	std::chrono::steady_clock::time_point oldestQueued;
+	std::mutex queueMutex;
+	std::condition_variable queueCondition;
+	std::thread flushThread;
+	PwdTokenWriterStats stats;
+	bool stopping;
+};
@@ -0,0 +1,188 @@
+#include "RateLimiter.h"
+#include "BB_Server.h"
+#include "BB_Client.h"
+#include <WSOPacket.h>
+#include <ClientManager.h>
+#include <boost/make_shared.hpp>
+#include <algorithm>
+#include <cctype>
+
+const char* RateLimiter::THROTTLED_MSG = "Too many requests, try again later";
+
+const char* RateLimiter::GetScopeName(RateLimitScope scope)
+{
+	switch (scope) {
+	case RateLimitScope::Client:
+		return "client";
+	default:
+		return "account";
+	}
+}
+
+RateLimiter::RateLimiter(BB_Server* bbServer)
+	:bbServer(bbServer)
+{
+	stats = RateLimiterStats();
+	//A tab can log in and open its pages at once, then settles to a packet every few seconds
+	limits[(int)RateLimitScope::Client] = { 1, 40 };
+	//About 5 password attempts at once, then one every 20 seconds
+	limits[(int)RateLimitScope::Account] = { 0.2, 20 };
+	for (int i = 0; i < NUM_RATE_LIMIT_SCOPES; i++) {
+		pruneAt[i] = MAX_BUCKETS;
+	}
+	//PBKDF2
+	costs["A3"] = 4;
+	costs["A8"] = 4;
+	//PBKDF2 and an SES send
+	costs["A0"] = 10;
+	//SES send
+	costs["A4"] = 10;
+	costs["B0"] = 10;
+	//STS federation token
+	costs["D0"] = 5;
+	costs["D2"] = 5;
+	//SHA-512 and at worst a DB read
+	costs["A2"] = 1;
+	costs["B2"] = 1;
+}
+
+void RateLimiter::setLimit(RateLimitScope scope, double rate, double burst)
+{
+	std::lock_guard<std::mutex> lock(limiterMutex);
+	limits[(int)scope].rate = std::max(rate, 0.0);
+	limits[(int)scope].burst = std::max(burst, 0.0);
+	//Buckets refill to the new burst from here
+	for (auto bucketIter = buckets[(int)scope].begin(); bucketIter != buckets[(int)scope].end(); bucketIter++) {
+		bucketIter->second.tokens = std::min(bucketIter->second.tokens, limits[(int)scope].burst);
+	}
+}
+
+RateLimit RateLimiter::getLimit(RateLimitScope scope)
+{
+	std::lock_guard<std::mutex> lock(limiterMutex);
+	return limits[(int)scope];
+}
+
+void RateLimiter::setCost(const std::string & pKey, double cost)
+{
+	std::lock_guard<std::mutex> lock(limiterMutex);
+	costs[pKey] = std::max(cost, 0.0);
+}
+
+double RateLimiter::getCost(const std::string & pKey)
+{
+	std::lock_guard<std::mutex> lock(limiterMutex);
+	auto costIter = costs.find(pKey);
+	return costIter != costs.end() ? costIter->second : (double)DEFAULT_COST;
+}
+
+bool RateLimiter::allow(BB_ClientPtr client, const std::string & pKey)
+{
+	return allow(client, std::string(), pKey);
+}
+
+bool RateLimiter::allow(BB_ClientPtr client, const std::string & account, const std::string & pKey)
+{
+	RateLimitScope scopes[] = { RateLimitScope::Client, RateLimitScope::Account, RateLimitScope::Account };
+	std::string keys[MAX_KEYS];
+	keys[0] = std::to_string(client->getID());
+	if (client->getEmpID() > 0) {
+		//Never matches a named account, those are names and emails
+		keys[1] = "#" + std::to_string(client->getEmpID());
+	}
+	keys[2] = account;
+	std::transform(keys[2].begin(), keys[2].end(), keys[2].begin(), [](char c) { return (char)std::tolower((unsigned char)c); });
+	//One take so a packet the account turns away is not charged to the client either
+	return take(scopes, keys, MAX_KEYS, pKey);
+}
+
+RateLimiterStats RateLimiter::getStats()
+{
+	std::lock_guard<std::mutex> lock(limiterMutex);
+	RateLimiterStats limiterStats = stats;
+	for (int i = 0; i < NUM_RATE_LIMIT_SCOPES; i++) {
+		limiterStats.buckets[i] = buckets[i].size();
+	}
+	return limiterStats;
+}
+
+RateLimiter::~RateLimiter()
+{
+}
+
+bool RateLimiter::take(const RateLimitScope * scopes, const std::string * keys, int numKeys, const std::string & pKey)
+{
+	auto now = std::chrono::steady_clock::now();
+	std::lock_guard<std::mutex> lock(limiterMutex);
+	auto costIter = costs.find(pKey);
+	double cost = costIter != costs.end() ? costIter->second : (double)DEFAULT_COST;
+	//Pruned up front, a prune between two keys of one scope could erase a bucket already picked to charge
+	for (int i = 0; i < numKeys; i++) {
+		if (buckets[(int)scopes[i]].size() >= pruneAt[(int)scopes[i]]) {
+			prune(scopes[i], now);
+		}
+	}
+	Bucket* charged[MAX_KEYS];
+	int numCharged = 0;
+	for (int i = 0; i < numKeys; i++) {
+		int scope = (int)scopes[i];
+		if (keys[i].empty() || limits[scope].rate <= 0) {
+			continue;
+		}
+		auto bucketIter = buckets[scope].find(keys[i]);
+		if (bucketIter == buckets[scope].end()) {
+			Bucket bucket;
+			bucket.tokens = limits[scope].burst;
+			bucket.updated = now;
+			bucketIter = buckets[scope].insert(std::make_pair(keys[i], bucket)).first;
+		}
+		else
+		{
+			refill(scopes[i], bucketIter->second, now);
+		}
+		if (bucketIter->second.tokens < cost) {
+			stats.throttled[scope]++;
+			stats.throttledByKey[pKey]++;
+			return false;
+		}
+		charged[numCharged++] = &bucketIter->second;
+	}
+	for (int i = 0; i < numCharged; i++) {
+		charged[i]->tokens -= cost;
+	}
+	stats.allowed++;
+	return true;
+}
+
+void RateLimiter::refill(RateLimitScope scope, Bucket & bucket, std::chrono::steady_clock::time_point now)
+{
+	double seconds = std::chrono::duration<double>(now - bucket.updated).count();
+	bucket.tokens = std::min(bucket.tokens + seconds * limits[(int)scope].rate, limits[(int)scope].burst);
+	bucket.updated = now;
+}
+
+void RateLimiter::prune(RateLimitScope scope, std::chrono::steady_clock::time_point now)
+{
+	BucketMap& scopeBuckets = buckets[(int)scope];
+	auto bucketIter = scopeBuckets.begin();
+	while (bucketIter != scopeBuckets.end()) {
+		refill(scope, bucketIter->second, now);
+		if (bucketIter->second.tokens >= limits[(int)scope].burst) {
+			bucketIter = scopeBuckets.erase(bucketIter);
+		}
+		else
+		{
+			bucketIter++;
+		}
+	}
+	//Under a flood most buckets stay partly drained, wait for twice as many before sweeping again
+	pruneAt[(int)scope] = std::max((size_t)MAX_BUCKETS, scopeBuckets.size() * 2);
+}
+
+void RateLimiter::sendThrottled(BB_ClientPtr client, const std::string & replyKey, const std::string & data)
+{
+	boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>(replyKey.c_str());
+	oPack->setSenderID(0);
+	oPack->setData(boost::make_shared<std::string>(data));
+	bbServer->getClientManager()->send(oPack, client);
+}
@@ -0,0 +1,136 @@
+#pragma once
+#include "stdafx.h"
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <string>
+
+class BB_Server;
+
+enum class RateLimitScope {
+	//One websocket connection
+	Client,
+	//One employee, by eID once logged in or by the name or email a login or reset names
+	Account
+};
+
+static const int NUM_RATE_LIMIT_SCOPES = 2;
+
+struct RateLimit {
+	//Cost refilled per second, 0 turns the scope off
+	double rate;
+	//Most cost a bucket holds, a new or idle bucket starts full
+	double burst;
+};
+
+struct RateLimiterStats {
+	uint64_t allowed;
+	//Packets turned away by each scope, a packet counts against the first scope it failed
+	uint64_t throttled[NUM_RATE_LIMIT_SCOPES];
+	size_t buckets[NUM_RATE_LIMIT_SCOPES];
+	std::map <std::string, uint64_t> throttledByKey;
+};
+
+/// <summary>
+/// Token buckets in front of the handlers whose work costs far more than the packet. Each PKey has
+/// a cost charged against the sender's client and account buckets together, a packet is
+/// only let through if every bucket it touches can pay. Checked before the handler parses anything,
+/// except for logins and resets which also charge the account the packet names.
+/// </summary>
+class RateLimiter
+{
+public:
+	static const char* THROTTLED_MSG;
+	//Charged for a PKey without a cost of its own
+	static const int DEFAULT_COST = 1;
+	//Buckets a scope keeps before the ones that have refilled are dropped, a full bucket is the same as none
+	static const int MAX_BUCKETS = 1 << 16;
+
+	RateLimiter(BB_Server* bbServer);
+
+	void setLimit(RateLimitScope scope, double rate, double burst);
+
+	RateLimit getLimit(RateLimitScope scope);
+
+	/// <summary>
+	/// A cost above a scope's burst can never be paid, the PKey is then always throttled
+	/// </summary>
+	void setCost(const std::string& pKey, double cost);
+
+	double getCost(const std::string& pKey);
+
+	/// <summary>
+	/// Charges pKey's cost to client's buckets, and to its account's if logged in
+	/// </summary>
+	/// <returns>False, with nothing charged, if any of the buckets is short</returns>
+	bool allow(BB_ClientPtr client, const std::string& pKey);
+
+	/// <summary>
+	/// allow, also charging the account a login or reset names, case insensitive
+	/// </summary>
+	bool allow(BB_ClientPtr client, const std::string& account, const std::string& pKey);
+
+	/// <summary>
+	/// allow, answering a throttled packet with a ReplyPacket under replyKey so the page is not left waiting
+	/// </summary>
+	template <typename ReplyPacket>
+	bool admit(BB_ClientPtr client, const std::string& pKey, const std::string& replyKey) {
+		if (allow(client, pKey)) {
+			return true;
+		}
+		ReplyPacket replyPacket;
+		replyPacket.set_msg(THROTTLED_MSG);
+		sendThrottled(client, replyKey, replyPacket.SerializeAsString());
+		return false;
+	}
+
+	template <typename ReplyPacket>
+	bool admit(BB_ClientPtr client, const std::string& account, const std::string& pKey, const std::string& replyKey) {
+		if (allow(client, account, pKey)) {
+			return true;
+		}
+		ReplyPacket replyPacket;
+		replyPacket.set_msg(THROTTLED_MSG);
+		sendThrottled(client, replyKey, replyPacket.SerializeAsString());
+		return false;
+	}
+
+	RateLimiterStats getStats();
+
+	static const char* GetScopeName(RateLimitScope scope);
+
+	~RateLimiter();
+
+private:
+	//The client, its logged in account and an account named in the packet
+	static const int MAX_KEYS = NUM_RATE_LIMIT_SCOPES + 1;
+
+	struct Bucket {
+		double tokens;
+		std::chrono::steady_clock::time_point updated;
+	};
+
+	typedef std::map <std::string, Bucket> BucketMap;
+
+	/// <summary>
+	/// Charges cost to every (scope, key) with a non empty key and the scope turned on, or to none of them
+	/// </summary>
+	bool take(const RateLimitScope* scopes, const std::string* keys, int numKeys, const std::string& pKey);
+
+	//Fills bucket for the time since it was last touched
+	void refill(RateLimitScope scope, Bucket& bucket, std::chrono::steady_clock::time_point now);
+
+	//Drops the buckets of scope that are full again
+	void prune(RateLimitScope scope, std::chrono::steady_clock::time_point now);
+
+	void sendThrottled(BB_ClientPtr client, const std::string& replyKey, const std::string& data);
+
+	BB_Server* bbServer;
+	std::mutex limiterMutex;
+	RateLimit limits[NUM_RATE_LIMIT_SCOPES];
+	BucketMap buckets[NUM_RATE_LIMIT_SCOPES];
+	//Size a scope's buckets may reach before the next prune
+	size_t pruneAt[NUM_RATE_LIMIT_SCOPES];
+	std::map <std::string, double> costs;
+	RateLimiterStats stats;
+};
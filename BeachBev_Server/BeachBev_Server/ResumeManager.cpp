@@ -2,8 +2,11 @@
 #include "Packets/BBPacks.pb.h"
 #include "BB_Server.h"
 #include "BB_Client.h"
+#include "RateLimiter.h"
 #include "EmailManager.h"
 #include "MasterManager.h"
+#include "DBPool.h"
+#include "DBExecutor.h"
 #include <ClientManager.h>
 #include <WSOPacket.h>
 #include <WSIPacket.h>
@@ -113,23 +116,35 @@ void ResumeManager::handleD0(boost::shared_ptr<IPacket> iPack)
 	if (sender == nullptr) {
 		return;
 	}
-	std::string email;
-	if (sender->getEmpID() > 0) {
-		if (emailManager->getVerifiedEmail(sender->getEmpID(), email, sender->getDBManager())) {
-			std::string policy;
-			createUserResumePolicy(sender->getEmpID(), policy);
-			requestResumePermissions(sender, policy);
-		}
-		else
-		{
-			ProtobufPackets::PackD1 replyPacket;
-			replyPacket.set_msg("Email is not verified");
-			boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("D1");
-			oPack->setSenderID(0);
-			oPack->addSendToID(sender->getID());
-			oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
-			bbServer->getClientManager()->send(oPack, sender);
-		}
+	if (!bbServer->getRateLimiter()->admit<ProtobufPackets::PackD1>(sender, "D0", "D1")) {
+		return;
+	}
+	IDType senderEID = sender->getEmpID();
+	if (senderEID > 0) {
+		auto verified = boost::make_shared<bool>(false);
+		bbServer->getDBExecutor()->submit(sender, [this, senderEID, verified](DBManager* dbManager) {
+			std::string email;
+			*verified = emailManager->getVerifiedEmail(senderEID, email, dbManager);
+		}, [this, sender, senderEID, verified](DBJobStatus status) {
+			if (*verified) {
+				std::string policy;
+				createUserResumePolicy(senderEID, policy);
+				requestResumePermissions(sender, policy);
+			}
+			else
+			{
+				ProtobufPackets::PackD1 replyPacket;
+				replyPacket.set_msg("Email is not verified");
+				if (status != DBJobStatus::Completed) {
+					replyPacket.set_msg(DBExecutor::GetStatusMsg(status));
+				}
+				boost::shared_ptr<OPacket> oPack = boost::make_shared<WSOPacket>("D1");
+				oPack->setSenderID(0);
+				oPack->addSendToID(sender->getID());
+				oPack->setData(boost::make_shared<std::string>(replyPacket.SerializeAsString()));
+				bbServer->getClientManager()->send(oPack, sender);
+			}
+		});
 	}
 }
 
@@ -139,8 +154,10 @@ void ResumeManager::handleD2(boost::shared_ptr<IPacket> iPack)
 	if (sender == nullptr) {
 		return;
 	}
-	DBManager* dbManager = sender->getDBManager();
-	if (masterManager->isMaster(sender->getEmpID(), dbManager)) {
+	if (!bbServer->getRateLimiter()->admit<ProtobufPackets::PackD1>(sender, "D2", "D1")) {
+		return;
+	}
+	if (masterManager->isMaster(sender)) {
 		std::string policy;
 		createMasterResumePolicy(policy);
 		requestResumePermissions(sender, policy);
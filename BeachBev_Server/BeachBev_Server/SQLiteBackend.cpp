@@ -0,0 +1,71 @@
+#include "SQLiteBackend.h"
+#include "DBManager.h"
+#include "EmployeeManager.h"
+#include "AcceptManager.h"
+
+const std::string SQLiteBackend::DEFAULT_DRIVER = "SQLite3";
+
+std::string SQLiteBackend::makeConnectStr(const ConnectionInformation & connectionInfo) const
+{
+	std::string connectStr = "Driver={";
+	if (connectionInfo.driver != ConnectionInformation::UNUSED_INFO) {
+		connectStr += connectionInfo.driver;
+	}
+	else
+	{
+		connectStr += DEFAULT_DRIVER;
+	}
+	connectStr += "}; Database=";
+	connectStr += connectionInfo.database;
+	connectStr += "; Timeout=";
+	connectStr += std::to_string(BUSY_TIMEOUT_MILLIS);
+	//WAL lets the pool's readers run while one connection writes
+	connectStr += "; JournalMode=WAL; SyncPragma=NORMAL; ";
+	connectStr += '\0';
+	return connectStr;
+}
+
+bool SQLiteBackend::createSchema(otl_connect & connection) const
+{
+	const std::string nameType = "VARCHAR(" + std::to_string(NAME_SIZE) + ")";
+	const std::string emailType = "VARCHAR(" + std::to_string(EMAIL_SIZE) + ")";
+	//Mirrors the MySQL tables, column order matters since the REPLACE statements do not name their columns
+	const std::string tableStatements[] = {
+		"CREATE TABLE IF NOT EXISTS Employees (eID INTEGER PRIMARY KEY, name " + nameType + " NOT NULL UNIQUE, "
+			"email " + emailType + " UNIQUE, pwdHash BLOB, pwdSalt BLOB, "
+			"aState INTEGER NOT NULL DEFAULT " + std::to_string(AcceptManager::UNVERIFIED_ASTATE) + ")",
+		"CREATE TABLE IF NOT EXISTS PwdTokens (eID INTEGER NOT NULL, deviceID INTEGER NOT NULL, tokenHash BLOB NOT NULL, "
+			"tokenTime BIGINT NOT NULL, PRIMARY KEY (eID, deviceID))",
+		"CREATE TABLE IF NOT EXISTS PwdResetTokens (eID INTEGER PRIMARY KEY, tokenHash BLOB NOT NULL, tokenTime BIGINT NOT NULL)",
+		"CREATE TABLE IF NOT EXISTS UnverifiedEmails (eID INTEGER PRIMARY KEY, email " + emailType + " NOT NULL, "
+			"tokenHash BLOB NOT NULL, tokenTime BIGINT NOT NULL)",
+		"CREATE TABLE IF NOT EXISTS Masters (eID INTEGER PRIMARY KEY)"
+	};
+	try {
+		for (const std::string& tableStatement : tableStatements) {
+			connection.direct_exec(tableStatement.c_str());
+		}
+	}
+	catch (otl_exception ex)
+	{
+		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+		return false;
+	}
+	return createIndex(connection, "resetTokenHash", "PwdResetTokens", "tokenHash")
+		&& createIndex(connection, "unverifiedEmail", "UnverifiedEmails", "email")
+		&& createIndex(connection, "employeeAState", "Employees", "aState");
+}
+
+bool SQLiteBackend::createIndex(otl_connect & connection, const std::string & indexName, const std::string & table, const std::string & columns) const
+{
+	try {
+		//SQLite index names are per database, not per table
+		connection.direct_exec(("CREATE INDEX IF NOT EXISTS " + table + "_" + indexName + " ON " + table + " (" + columns + ")").c_str());
+	}
+	catch (otl_exception ex)
+	{
+		std::cerr << "Code: " << ex.code << std::endl << "MSG: " << ex.msg << std::endl;
+		return false;
+	}
+	return true;
+}
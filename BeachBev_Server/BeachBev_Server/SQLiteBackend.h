@@ -0,0 +1,47 @@
+#pragma once
+#include "stdafx.h"
+#include "DBBackend.h"
+
+/// <summary>
+/// A SQLite file reached through the SQLite3 ODBC driver, for running the server and its
+/// benchmarks without a database server. ConnectionInformation::database is the file path.
+/// </summary>
+class SQLiteBackend : public DBBackend
+{
+public:
+	static const std::string DEFAULT_DRIVER;
+	//How long a connection waits on another connection's write lock before failing with SQLITE_BUSY
+	static const int BUSY_TIMEOUT_MILLIS = 5000;
+
+	DBBackendType getType() const override {
+		return BACKEND_SQLITE;
+	}
+
+	const char* getName() const override {
+		return "sqlite";
+	}
+
+	std::string makeConnectStr(const ConnectionInformation& connectionInfo) const override;
+
+	/// <summary>
+	/// An embedded database has no connection to lose
+	/// </summary>
+	bool isConnectionLost(const otl_exception& ex) const override {
+		return false;
+	}
+
+	bool supportsReplicas() const override {
+		return false;
+	}
+
+	/// <summary>
+	/// A SQLite read left open would pin its snapshot and hold off other connections' writes
+	/// </summary>
+	bool autoCommits() const override {
+		return true;
+	}
+
+	bool createSchema(otl_connect& connection) const override;
+
+	bool createIndex(otl_connect& connection, const std::string& indexName, const std::string& table, const std::string& columns) const override;
+};
@@ -0,0 +1,71 @@
+#include "SessionCache.h"
+#include <cstring>
+
+SessionCache::SessionCache(size_t capacity)
+	:capacity(capacity > 0 ? capacity : 1)
+{
+	stats = SessionCacheStats();
+}
+
+bool SessionCache::find(IDType eID, DeviceID devID, BYTE * tokenHash, OTL_BIGINT & tokenTime)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	auto sessionIter = sessions.find(MakeKey(eID, devID));
+	if (sessionIter == sessions.end()) {
+		stats.misses++;
+		return false;
+	}
+	recentSessions.splice(recentSessions.begin(), recentSessions, sessionIter->second);
+	std::memcpy(tokenHash, sessionIter->second->tokenHash, TOKEN_SIZE);
+	tokenTime = sessionIter->second->tokenTime;
+	stats.hits++;
+	return true;
+}
+
+void SessionCache::put(IDType eID, DeviceID devID, const BYTE * tokenHash, OTL_BIGINT tokenTime)
+{
+	uint64_t key = MakeKey(eID, devID);
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	auto sessionIter = sessions.find(key);
+	if (sessionIter != sessions.end()) {
+		recentSessions.splice(recentSessions.begin(), recentSessions, sessionIter->second);
+	}
+	else
+	{
+		if (sessions.size() >= capacity) {
+			sessions.erase(recentSessions.back().key);
+			recentSessions.pop_back();
+			stats.evictions++;
+		}
+		recentSessions.push_front(Session());
+		recentSessions.front().key = key;
+		sessionIter = sessions.insert(std::make_pair(key, recentSessions.begin())).first;
+	}
+	std::memcpy(sessionIter->second->tokenHash, tokenHash, TOKEN_SIZE);
+	sessionIter->second->tokenTime = tokenTime;
+}
+
+void SessionCache::remove(IDType eID)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	auto sessionIter = sessions.lower_bound(MakeKey(eID, 0));
+	auto endIter = sessions.lower_bound(MakeKey(eID + 1, 0));
+	while (sessionIter != endIter) {
+		recentSessions.erase(sessionIter->second);
+		sessionIter = sessions.erase(sessionIter);
+		stats.invalidations++;
+	}
+}
+
+SessionCacheStats SessionCache::getStats()
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	SessionCacheStats cacheStats = stats;
+	cacheStats.entries = sessions.size();
+	cacheStats.capacity = capacity;
+	return cacheStats;
+}
+
+SessionCache::~SessionCache()
+{
+}
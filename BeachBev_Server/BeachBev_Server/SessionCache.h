@@ -0,0 +1,70 @@
+#pragma once
+#include "stdafx.h"
+#include "EmployeeManager.h"
+#include <map>
+#include <list>
+#include <mutex>
+
+struct SessionCacheStats {
+	size_t entries;
+	size_t capacity;
+	uint64_t hits;
+	//Token logins that had to read the pwdToken from the database
+	uint64_t misses;
+	//Least recently used sessions dropped to stay within capacity
+	uint64_t evictions;
+	//Sessions dropped because their employee's pwdTokens were cleared
+	uint64_t invalidations;
+};
+
+/// <summary>
+/// Bounded LRU copy of the current pwdToken hash and time for each (eID, deviceID) that logged in
+/// recently, so a reconnecting device's A2 is checked without a database round trip. Filled when a
+/// token is issued or rotated and dropped whenever the employee's pwdTokens are cleared.
+/// </summary>
+class SessionCache
+{
+public:
+	static const int DEFAULT_CAPACITY = 1 << 16;
+
+	SessionCache(size_t capacity = DEFAULT_CAPACITY);
+
+	/// <summary>
+	/// Copies the token cached for the device and marks it recently used
+	/// </summary>
+	/// <returns>False if the device is not cached, the caller falls back to the database</returns>
+	bool find(IDType eID, DeviceID devID, BYTE* tokenHash, OTL_BIGINT& tokenTime);
+
+	/// <summary>
+	/// Caches the device's current token, evicting the least recently used session if full
+	/// </summary>
+	void put(IDType eID, DeviceID devID, const BYTE* tokenHash, OTL_BIGINT tokenTime);
+
+	/// <summary>
+	/// Drops every cached device of eID
+	/// </summary>
+	void remove(IDType eID);
+
+	SessionCacheStats getStats();
+
+	~SessionCache();
+
+private:
+	struct Session {
+		uint64_t key;
+		BYTE tokenHash[TOKEN_SIZE];
+		OTL_BIGINT tokenTime;
+	};
+
+	//Same layout as PwdTokenWriter's keys, so an employee's devices are one contiguous range
+	static uint64_t MakeKey(IDType eID, DeviceID devID) {
+		return ((uint64_t)eID << 16) | devID;
+	}
+
+	size_t capacity;
+	//Most recently used at the front
+	std::list <Session> recentSessions;
+	std::map <uint64_t, std::list<Session>::iterator> sessions;
+	std::mutex cacheMutex;
+	SessionCacheStats stats;
+};
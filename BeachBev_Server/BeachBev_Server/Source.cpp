@@ -6,6 +6,10 @@
 #include <iostream>
 
 static const int SERVER_PORT = 8443;
+static const int DB_POOL_SIZE = 8;
+static const int ROLE_REFRESH_SECONDS = 300;
+//Write jobs a DB worker may commit together, 1 commits every signup and reset on its own
+static const int DB_GROUP_COMMIT_SIZE = 8;
 
 #ifdef _WIN32
 static const std::string CERT_PATH = "C:\\Users\\ajcra\\Desktop\\aws\\SSL\\local.crt";
@@ -23,15 +27,24 @@ bool InitAws()
 	Aws::InitAPI(options);
 }
 
-int main()
+int main(int argc, char** argv)
 {
 	InitAws();
 	BB_Server server;
 	server.setCertPath(CERT_PATH);
 	server.setPemPath(PEM_PATH);
 	ConnectionInformation conInfo(CONNECT_INFORMATION_PATH);
+	//--sqlite <file> runs against a local database file instead of the configured MySQL server
+	if (argc > 2 && std::string(argv[1]) == "--sqlite") {
+		conInfo = ConnectionInformation();
+		conInfo.backend = BACKEND_SQLITE;
+		conInfo.database = argv[2];
+	}
 	server.setDBConnectionInformation(conInfo);
+	server.setDBPoolSize(DB_POOL_SIZE);
+	server.setRoleRefreshSeconds(ROLE_REFRESH_SECONDS);
 	server.createManagers();
+	server.getDBExecutor()->setGroupCommitSize(DB_GROUP_COMMIT_SIZE);
 	server.run(SERVER_PORT);
 	system("pause");
 }
\ No newline at end of file
@@ -0,0 +1,228 @@
+#pragma once
+#include "stdafx.h"
+#include <stdint.h>
+#include <string>
+#include <tuple>
+#include <bitset>
+
+typedef unsigned char BYTE;
+
+/// <summary>
+/// Binds a caller-owned fixed-size buffer to a raw[] or binary column. OTL copies straight between
+/// data and its bind buffer, so nothing is allocated and there is no intermediate copy.
+/// Only for binary columns, a text column would be null terminated one byte past data.
+/// </summary>
+class RawBytes : public otl_long_string
+{
+public:
+	RawBytes(const BYTE* data, uint16_t size)
+		:otl_long_string(data, size, size)
+	{
+	}
+};
+
+/// <summary>
+/// Reads OTL placeholders out of a query literal at compile time. pos is always the index of the
+/// '<' that opens a placeholder's type, 0 means there is no placeholder since queries start with a keyword.
+/// </summary>
+struct QueryText
+{
+	static constexpr bool IsDigit(char c) {
+		return c >= '0' && c <= '9';
+	}
+
+	static constexpr size_t SkipDigits(const char* query, size_t pos) {
+		return IsDigit(query[pos]) ? SkipDigits(query, pos + 1) : pos;
+	}
+
+	static constexpr int ParseInt(const char* query, size_t pos, int value) {
+		return IsDigit(query[pos]) ? ParseInt(query, pos + 1, value * 10 + (query[pos] - '0')) : value;
+	}
+
+	static constexpr bool StartsWith(const char* query, size_t pos, const char* prefix) {
+		return *prefix == '\0' || (query[pos] == *prefix && StartsWith(query, pos + 1, prefix + 1));
+	}
+
+	/// <summary>
+	/// The type of the first :fN<...> placeholder at or after pos
+	/// </summary>
+	static constexpr size_t FindPlaceholder(const char* query, size_t pos) {
+		return query[pos] == '\0' ? 0
+			: (query[pos] == ':' && query[pos + 1] == 'f' && IsDigit(query[pos + 2]) && query[SkipDigits(query, pos + 2)] == '<')
+			? SkipDigits(query, pos + 2)
+			: FindPlaceholder(query, pos + 1);
+	}
+
+	/// <summary>
+	/// True if the type at pos is prefix, then size, then "]>"
+	/// </summary>
+	static constexpr bool IsSizedType(const char* query, size_t pos, const char* prefix, size_t prefixSize, int size) {
+		return StartsWith(query, pos, prefix) && ParseInt(query, pos + prefixSize, 0) == size
+			&& StartsWith(query, SkipDigits(query, pos + prefixSize), "]>");
+	}
+};
+
+//Column types for StatementTraits. In is what a bind takes, Out is what a fetch fills,
+//Read returns false for a null column and Matches checks the placeholder type at pos.
+
+struct SqlInt {
+	typedef int In;
+	typedef int& Out;
+
+	static void Write(otl_stream& otlStream, In value) {
+		otlStream << value;
+	}
+
+	static bool Read(otl_stream& otlStream, Out value) {
+		otlStream >> value;
+		return !otlStream.is_null();
+	}
+
+	static constexpr bool Matches(const char* query, size_t pos) {
+		return QueryText::StartsWith(query, pos, "<int>");
+	}
+};
+
+struct SqlBigInt {
+	typedef OTL_BIGINT In;
+	typedef OTL_BIGINT& Out;
+
+	static void Write(otl_stream& otlStream, In value) {
+		otlStream << value;
+	}
+
+	static bool Read(otl_stream& otlStream, Out value) {
+		otlStream >> value;
+		return !otlStream.is_null();
+	}
+
+	static constexpr bool Matches(const char* query, size_t pos) {
+		return QueryText::StartsWith(query, pos, "<bigint>");
+	}
+};
+
+/// <summary>
+/// VARCHAR column of at most SIZE characters, a null reads as an empty string
+/// </summary>
+template<int SIZE>
+struct SqlChar {
+	typedef const std::string& In;
+	typedef std::string& Out;
+
+	static void Write(otl_stream& otlStream, In value) {
+		otlStream << value;
+	}
+
+	static bool Read(otl_stream& otlStream, Out value) {
+		otlStream >> value;
+		if (otlStream.is_null()) {
+			value.clear();
+			return false;
+		}
+		return true;
+	}
+
+	static constexpr bool Matches(const char* query, size_t pos) {
+		return QueryText::IsSizedType(query, pos, "<char[", 6, SIZE);
+	}
+};
+
+/// <summary>
+/// BINARY column of exactly SIZE bytes, bound through RawBytes. A null leaves the buffer as it was.
+/// </summary>
+template<int SIZE>
+struct SqlRaw {
+	typedef const BYTE* In;
+	typedef BYTE* Out;
+
+	static void Write(otl_stream& otlStream, In value) {
+		otlStream << RawBytes(value, SIZE);
+	}
+
+	static bool Read(otl_stream& otlStream, Out value) {
+		RawBytes rawBytes(value, SIZE);
+		otlStream >> rawBytes;
+		return !otlStream.is_null();
+	}
+
+	static constexpr bool Matches(const char* query, size_t pos) {
+		return QueryText::IsSizedType(query, pos, "<raw[", 5, SIZE);
+	}
+};
+
+/// <summary>
+/// Check is true if the placeholders in query from pos on are Columns in number, order and type
+/// </summary>
+template<typename Columns>
+struct PlaceholdersMatch;
+
+template<>
+struct PlaceholdersMatch<std::tuple<>> {
+	static constexpr bool Check(const char* query, size_t pos) {
+		return QueryText::FindPlaceholder(query, pos) == 0;
+	}
+};
+
+template<typename Column, typename... Rest>
+struct PlaceholdersMatch<std::tuple<Column, Rest...>> {
+	static constexpr bool Check(const char* query, size_t pos) {
+		return QueryText::FindPlaceholder(query, pos) != 0
+			&& Column::Matches(query, QueryText::FindPlaceholder(query, pos))
+			&& PlaceholdersMatch<std::tuple<Rest...>>::Check(query, QueryText::FindPlaceholder(query, pos) + 1);
+	}
+};
+
+template<typename Bind, typename Fetch>
+class TypedStream;
+
+/// <summary>
+/// An otl_stream that only takes the statement's Bind columns and only fills its Fetch columns,
+/// so a bind or read in the wrong order or of the wrong type does not compile
+/// </summary>
+template<typename... BindColumns, typename... FetchColumns>
+class TypedStream<std::tuple<BindColumns...>, std::tuple<FetchColumns...>>
+{
+public:
+	TypedStream(otl_stream& otlStream)
+		:otlStream(otlStream)
+	{
+	}
+
+	/// <summary>
+	/// Binds one row of parameters, the statement runs once the row is complete
+	/// </summary>
+	void bind(typename BindColumns::In... values) {
+		//Braced initializers are evaluated left to right, which keeps the columns in order
+		int order[] = { 0, (BindColumns::Write(otlStream, values), 0)... };
+		(void)order;
+	}
+
+	/// <summary>
+	/// Reads the next row into values
+	/// </summary>
+	/// <returns>False once there are no rows left, values are untouched in that case</returns>
+	bool fetch(typename FetchColumns::Out... values) {
+		if (otlStream.eof()) {
+			return false;
+		}
+		size_t column = 0;
+		int order[] = { 0, (nulls[column++] = !FetchColumns::Read(otlStream, values), 0)... };
+		(void)order;
+		return true;
+	}
+
+	/// <summary>
+	/// True if the column at index was null in the last row fetched
+	/// </summary>
+	bool isNull(size_t index) {
+		return nulls.test(index);
+	}
+
+	long getRowsAffected() {
+		return otlStream.get_rpc();
+	}
+
+private:
+	otl_stream& otlStream;
+	std::bitset<sizeof...(FetchColumns) + 1> nulls;
+};
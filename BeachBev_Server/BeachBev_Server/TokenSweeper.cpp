@@ -0,0 +1,195 @@
+#include "TokenSweeper.h"
+#include "BB_Server.h"
+#include "DBManager.h"
+#include "DBPool.h"
+#include "DBExecutor.h"
+#include "EmployeeManager.h"
+#include "EmployeeDirectory.h"
+#include <chrono>
+#include <vector>
+
+bool TokenSweeper::CreateIndexes(DBManager * dbManager)
+{
+	const char* tables[] = { "PwdTokens", "PwdResetTokens", "UnverifiedEmails" };
+	bool success = true;
+	for (const char* table : tables) {
+		if (!dbManager->getBackend()->createIndex(*dbManager->getConnection(), "sweepTime", table, "tokenTime")) {
+			success = false;
+		}
+	}
+	return success;
+}
+
+TokenSweeper::TokenSweeper(BB_Server * bbServer, EmployeeDirectory * employeeDirectory)
+	:bbServer(bbServer), employeeDirectory(employeeDirectory), sweepRequested(false), stopping(false)
+{
+	stats = TokenSweepStats();
+	sweepThread = std::thread(&TokenSweeper::sweepLoop, this);
+}
+
+void TokenSweeper::sweepNow()
+{
+	{
+		std::lock_guard<std::mutex> lock(sweepMutex);
+		sweepRequested = true;
+	}
+	sweepCondition.notify_all();
+}
+
+TokenSweepStats TokenSweeper::getStats()
+{
+	std::lock_guard<std::mutex> lock(sweepMutex);
+	return stats;
+}
+
+void TokenSweeper::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(sweepMutex);
+		stopping = true;
+	}
+	sweepCondition.notify_all();
+	if (sweepThread.joinable()) {
+		sweepThread.join();
+	}
+}
+
+TokenSweeper::~TokenSweeper()
+{
+	stop();
+}
+
+void TokenSweeper::sweepLoop()
+{
+	std::unique_lock<std::mutex> lock(sweepMutex);
+	while (!stopping) {
+		sweepCondition.wait_for(lock, std::chrono::seconds(SWEEP_INTERVAL_SECONDS), [this]() { return stopping || sweepRequested; });
+		if (stopping) {
+			return;
+		}
+		sweepRequested = false;
+		lock.unlock();
+		sweep();
+		lock.lock();
+	}
+}
+
+void TokenSweeper::sweep()
+{
+	{
+		std::lock_guard<std::mutex> lock(sweepMutex);
+		stats.lastSweepMicros = 0;
+	}
+	OTL_BIGINT cutoff = std::time(NULL) - (OTL_BIGINT)MAX_TOKEN_HOURS * 60 * 60;
+	uint64_t pwdTokensRemoved = 0;
+	uint64_t pwdResetTokensRemoved = 0;
+	bool finished = sweepTable<STMT_SWEEP_PWD_TOKENS>(cutoff, pwdTokensRemoved)
+		&& sweepTable<STMT_SWEEP_PWD_RESET_TOKENS>(cutoff, pwdResetTokensRemoved)
+		&& sweepUnverifiedEmails(cutoff);
+	std::lock_guard<std::mutex> lock(sweepMutex);
+	stats.sweeps++;
+	if (!finished) {
+		stats.abandonedSweeps++;
+	}
+	stats.pwdTokensRemoved += pwdTokensRemoved;
+	stats.pwdResetTokensRemoved += pwdResetTokensRemoved;
+	stats.lastSweepTime = std::time(NULL);
+}
+
+template<StatementID ID>
+bool TokenSweeper::sweepTable(OTL_BIGINT cutoff, uint64_t & removed)
+{
+	while (true) {
+		if (!waitForIdle()) {
+			return false;
+		}
+		long batchRemoved = 0;
+		bool success = false;
+		auto start = std::chrono::steady_clock::now();
+		{
+			DBLease dbLease(bbServer->getDBPool());
+			success = dbLease.get()->execute<ID>([&](StatementStream<ID>& stmt) {
+				stmt.bind(cutoff, (int)SWEEP_BATCH_SIZE);
+				batchRemoved = stmt.getRowsAffected();
+			});
+		}
+		addMicros(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+		if (!success) {
+			return false;
+		}
+		removed += batchRemoved;
+		if (batchRemoved < SWEEP_BATCH_SIZE) {
+			return true;
+		}
+	}
+}
+
+bool TokenSweeper::sweepUnverifiedEmails(OTL_BIGINT cutoff)
+{
+	while (true) {
+		if (!waitForIdle()) {
+			return false;
+		}
+		std::vector <std::pair<IDType, std::string>> expired;
+		uint64_t batchRemoved = 0;
+		bool success = false;
+		auto start = std::chrono::steady_clock::now();
+		{
+			DBLease dbLease(bbServer->getDBPool());
+			success = dbLease.get()->execute<STMT_GET_EXPIRED_UNVERIFIED_EMAILS>([&](StatementStream<STMT_GET_EXPIRED_UNVERIFIED_EMAILS>& stmt) {
+				expired.clear();
+				stmt.bind(cutoff, (int)SWEEP_BATCH_SIZE);
+				int eIDInt = 0;
+				std::string email;
+				while (stmt.fetch(eIDInt, email)) {
+					expired.push_back(std::make_pair((IDType)eIDInt, email));
+				}
+			});
+			for (int i = 0; success && i < expired.size(); i++) {
+				long rowsDeleted = 0;
+				success = dbLease.get()->execute<STMT_SWEEP_UNVERIFIED_EMAIL>([&](StatementStream<STMT_SWEEP_UNVERIFIED_EMAIL>& stmt) {
+					stmt.bind(expired.at(i).first, cutoff);
+					rowsDeleted = stmt.getRowsAffected();
+				});
+				if (rowsDeleted > 0) {
+					employeeDirectory->expireUnverifiedEmail(expired.at(i).first, expired.at(i).second);
+					batchRemoved++;
+				}
+			}
+		}
+		addMicros(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+		{
+			std::lock_guard<std::mutex> lock(sweepMutex);
+			stats.unverifiedEmailsRemoved += batchRemoved;
+		}
+		if (!success) {
+			return false;
+		}
+		if (expired.size() < SWEEP_BATCH_SIZE) {
+			return true;
+		}
+	}
+}
+
+bool TokenSweeper::waitForIdle()
+{
+	std::unique_lock<std::mutex> lock(sweepMutex);
+	for (int deferrals = 0; deferrals <= MAX_DEFERRALS; deferrals++) {
+		sweepCondition.wait_for(lock, std::chrono::milliseconds(BATCH_PAUSE_MILLIS), [this]() { return stopping; });
+		if (stopping) {
+			return false;
+		}
+		if (bbServer->getDBExecutor()->getStats().queueDepth == 0) {
+			return true;
+		}
+		stats.deferrals++;
+	}
+	return false;
+}
+
+void TokenSweeper::addMicros(uint64_t micros)
+{
+	std::lock_guard<std::mutex> lock(sweepMutex);
+	stats.totalMicros += micros;
+	stats.lastSweepMicros += micros;
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "stdafx.h"
+#include "DBStatements.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <ctime>
+
+class BB_Server;
+class DBManager;
+class EmployeeDirectory;
+
+struct TokenSweepStats {
+	uint64_t sweeps;
+	uint64_t pwdTokensRemoved;
+	uint64_t pwdResetTokensRemoved;
+	uint64_t unverifiedEmailsRemoved;
+	//Batches put off because handlers had work queued for the DB workers
+	uint64_t deferrals;
+	//Sweeps that stopped early because a statement failed or the workers stayed busy for MAX_DEFERRALS pauses
+	uint64_t abandonedSweeps;
+	//Time spent holding a DBManager, pauses between batches are not counted
+	uint64_t totalMicros;
+	uint64_t lastSweepMicros;
+	std::time_t lastSweepTime;
+};
+
+/// <summary>
+/// Deletes rows from PwdTokens, PwdResetTokens and UnverifiedEmails whose tokens are older than
+/// MAX_TOKEN_HOURS, SWEEP_BATCH_SIZE rows per statement. It pauses between batches and waits
+/// whenever the DB workers have a queue so login traffic always gets the connections first.
+/// </summary>
+class TokenSweeper
+{
+public:
+	static const int SWEEP_INTERVAL_SECONDS = 600;
+	static const int SWEEP_BATCH_SIZE = 100;
+	static const int BATCH_PAUSE_MILLIS = 50;
+	static const int MAX_DEFERRALS = 100;
+
+	/// <summary>
+	/// Adds the tokenTime indexes the sweeps use, an index that already exists is left alone
+	/// </summary>
+	static bool CreateIndexes(DBManager* dbManager);
+
+	TokenSweeper(BB_Server* bbServer, EmployeeDirectory* employeeDirectory);
+
+	/// <summary>
+	/// Starts a sweep now instead of waiting for the interval
+	/// </summary>
+	void sweepNow();
+
+	TokenSweepStats getStats();
+
+	void stop();
+
+	~TokenSweeper();
+
+private:
+	void sweepLoop();
+
+	void sweep();
+
+	/// <summary>
+	/// Deletes expired rows with statement ID until a batch comes back short
+	/// </summary>
+	template<StatementID ID>
+	bool sweepTable(OTL_BIGINT cutoff, uint64_t& removed);
+
+	/// <summary>
+	/// Deletes expired unverified emails one eID at a time so the directory can be told about each
+	/// </summary>
+	bool sweepUnverifiedEmails(OTL_BIGINT cutoff);
+
+	/// <summary>
+	/// Waits out a nonempty DB worker queue and the pause between batches
+	/// </summary>
+	/// <returns>False if stopping or the workers never went idle</returns>
+	bool waitForIdle();
+
+	void addMicros(uint64_t micros);
+
+	BB_Server* bbServer;
+	EmployeeDirectory* employeeDirectory;
+	std::thread sweepThread;
+	std::mutex sweepMutex;
+	std::condition_variable sweepCondition;
+	TokenSweepStats stats;
+	bool sweepRequested;
+	bool stopping;
+};
@@ -4,6 +4,7 @@ var BUCKET_REGION = 'us-west-1';
 var BUCKET_NAME = 'beachbev-resumes'
 
 var ACCEPT_ASTATE = 1;
+var E1_PAGE_SIZE = 100;
 
 var setman = null;
 var masterManager = null;
@@ -79,7 +80,9 @@ function MasterManager() {
 					masterManager.addEmp('#unacceptEmpDiv', packE1.unacceptedEIDs[i].toString());
 					$('#' + packE1.unacceptedEIDs[i].toString() + ' > div > .acceptButton').removeClass('hidden');
 				}
-				masterManager.sendD2();
+				if (!packE1.morePages) {
+					masterManager.sendD2();
+				}
 			}
 			else
 			{
@@ -217,7 +220,7 @@ function MasterManager() {
 	}
 
 	this.sendE0 = function () {
-		var packE0 = masterManager.PacketE0.create({});
+		var packE0 = masterManager.PacketE0.create({ pageSize: E1_PAGE_SIZE });
 		setman.client.tcpConnection.sendPack(new OPacket("E0", true, [0], packE0, masterManager.PacketE0));
 	}
 